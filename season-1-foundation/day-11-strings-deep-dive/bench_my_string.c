@@ -0,0 +1,730 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  bench_my_string.c — Throughput vs glibc
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Measure before you believe."
+ *
+ *  Every implementation of each function, plus glibc's, on strings from
+ *  1 B to 1 MB. Each cell is GB/s of string processed (bytes read from
+ *  src), best of a few runs.
+ *
+ *  Build & run:  make bench
+ *
+ *  Small sizes measure call overhead and the head/tail code; large ones
+ *  measure the main loop. 1 MB is past most L2 caches, so that row is
+ *  partly memory bandwidth.
+ *
+ *  strrev has no glibc column (there is no strrev); its last column is
+ *  my_strrev_utf8 on the same ASCII text.
+ *
+ *  strstr runs on a fixed 1 MB haystack instead, one row per needle
+ *  length (ref's periodic row is its O(n·m) worst case). Then
+ *  my_matcher finds 24 keywords in a 100 MB corpus in one pass.
+ *
+ *  The length-distribution rows are closer to real programs: thousands
+ *  of strings of varying length and alignment, one call each, reported
+ *  Google Benchmark style (time per call, calls, bytes per second).
+ *
+ *  "unchecked vs safe_str" puts each bounds-checked function next to
+ *  the my_str* function it replaces.
+ *
+ *  The last table is the reason hunter_str exists: building a string by
+ *  repeated my_strcat against appending to a hunter_str.
+ *
+ *  Don't be surprised by a fast "ref" strlen: GCC at -O2 recognizes the
+ *  byte loop as strlen and calls glibc's.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#define _POSIX_C_SOURCE 200809L     /* clock_gettime, open */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "hunter_builder.h"
+#include "hunter_str.h"
+#include "my_string.h"
+#include "safe_str.h"
+
+#define MAX_LEN      (1u << 20)
+#define BYTES_PER    (16u << 20)    /* String bytes per timed run */
+#define RUNS         3
+#define MAX_IMPLS    8
+
+/* Keeps the compiler from hoisting or dropping calls */
+#define BARRIER() __asm__ __volatile__("" ::: "memory")
+
+static const size_t LENGTHS[] = {
+    1, 4, 16, 64, 256, 1024, 4096, 16384, 65536, 262144, 1048576
+};
+#define LENGTH_COUNT (sizeof(LENGTHS) / sizeof(LENGTHS[0]))
+
+static unsigned char *src_buf;
+static unsigned char *src2_buf;
+static unsigned char *dst_buf;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Any function pointer (C allows casts between function pointer types,
+ * not to void *); each op casts back to the real type before calling.
+ */
+typedef void (*any_fn)(void);
+
+/* Same-shaped call for every function: run the operation once on len */
+typedef void (*bench_op)(any_fn fn, size_t len);
+
+static void op_strlen(any_fn fn, size_t len)
+{
+    volatile size_t sink = ((size_t (*)(const char *))fn)((const char *)src_buf);
+    (void)sink;
+    (void)len;
+}
+
+static void op_strcmp(any_fn fn, size_t len)
+{
+    volatile int sink = ((int (*)(const char *, const char *))fn)(
+        (const char *)src_buf, (const char *)src2_buf);
+    (void)sink;
+    (void)len;
+}
+
+static void op_strcpy(any_fn fn, size_t len)
+{
+    ((char *(*)(char *, const char *))fn)((char *)dst_buf, (const char *)src_buf);
+    (void)len;
+}
+
+/* n = 2 * len: half copy, half padding */
+static void op_strncpy(any_fn fn, size_t len)
+{
+    ((char *(*)(char *, const char *, size_t))fn)(
+        (char *)dst_buf, (const char *)src_buf, 2 * len);
+}
+
+/* dest holds len bytes; src is appended, then dest is cut back */
+static void op_strcat(any_fn fn, size_t len)
+{
+    ((char *(*)(char *, const char *))fn)((char *)dst_buf, (const char *)src_buf);
+    dst_buf[len] = '\0';
+}
+
+/* Reversed in place: the buffer alternates, its length doesn't */
+static void op_strrev(any_fn fn, size_t len)
+{
+    ((char *(*)(char *))fn)((char *)src_buf);
+    (void)len;
+}
+
+/* haystack = src, needle = src2 */
+static void op_strstr(any_fn fn, size_t len)
+{
+    volatile const char *sink = ((char *(*)(const char *, const char *))fn)(
+        (const char *)src_buf, (const char *)src2_buf);
+    (void)sink;
+    (void)len;
+}
+
+/* Bounds-checked versions, on exactly-sized buffers (fn is unused) */
+static void op_safe_strlen(any_fn fn, size_t len)
+{
+    size_t n;
+    volatile error_t sink = safe_strlen((const char *)src_buf, len, &n);
+    (void)sink;
+    (void)fn;
+}
+
+static void op_safe_strcpy(any_fn fn, size_t len)
+{
+    safe_strcpy((char *)dst_buf, len + 1, (const char *)src_buf, NULL);
+    (void)fn;
+}
+
+static void op_safe_strcat(any_fn fn, size_t len)
+{
+    safe_strcat((char *)dst_buf, 2 * len + 1, (const char *)src_buf, NULL);
+    dst_buf[len] = '\0';
+    (void)fn;
+}
+
+/* GB/s of one implementation at one length */
+static double measure(bench_op op, any_fn fn, size_t len)
+{
+    size_t reps = BYTES_PER / len;
+    double best = 0.0;
+
+    for (int run = 0; run < RUNS; run++) {
+        double start = now(), secs;
+
+        for (size_t r = 0; r < reps; r++) {
+            op(fn, len);
+            BARRIER();
+        }
+        secs = now() - start;
+        if (secs > 0.0 && (double)(reps * len) / secs / 1e9 > best) {
+            best = (double)(reps * len) / secs / 1e9;
+        }
+    }
+    return best;
+}
+
+/*
+ * One table: rows are lengths, columns implementations. The string
+ * buffers are set up for each length before any timing.
+ */
+static void bench_table(const char *title, bench_op op, size_t count,
+                        const char *const *names, const any_fn *fns,
+                        int cat)
+{
+    printf("\n━━━ %s (GB/s) ━━━\n%10s", title, "length");
+    for (size_t v = 0; v < count; v++) {
+        printf("%9s", names[v]);
+    }
+    printf("\n");
+
+    for (size_t l = 0; l < LENGTH_COUNT; l++) {
+        size_t len = LENGTHS[l];
+
+        memset(src_buf, 'x', len);
+        src_buf[len] = '\0';
+        memcpy(src2_buf, src_buf, len + 1);
+        memset(dst_buf, 'y', len);
+        dst_buf[cat ? len : 0] = '\0';
+
+        printf("%10zu", len);
+        for (size_t v = 0; v < count; v++) {
+            printf("%9.2f", measure(op, fns[v], len));
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+}
+
+/*
+ * Substring search through 1 MB, needle absent (every byte examined).
+ * Text is random letters and spaces, needles are random bytes of it
+ * (redrawn until absent; the 1-byte needle is 'z', which the text
+ * never has). "periodic" is the naive search's worst case:
+ * "aaa..." searched for "aaa...ab".
+ */
+static void bench_strstr(size_t count, const char *const *names, const any_fn *fns)
+{
+    static const struct {
+        const char *label;
+        size_t m;
+        int periodic;
+    } CASES[] = {
+        { "1 B",             1, 0 },
+        { "8 B",             8, 0 },
+        { "32 B",           32, 0 },
+        { "64 B",           64, 0 },
+        { "256 B",         256, 0 },
+        { "periodic 64 B",  64, 1 },
+    };
+
+    printf("\n━━━ strstr, 1 MB haystack, no match (GB/s) ━━━\n%14s", "needle");
+    for (size_t v = 0; v < count; v++) {
+        printf("%9s", names[v]);
+    }
+    printf("\n");
+
+    for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); c++) {
+        size_t m = CASES[c].m;
+
+        for (size_t i = 0; i < MAX_LEN; i++) {
+            src_buf[i] = CASES[c].periodic ? 'a'
+                       : (rand() % 6 == 0) ? ' ' : (unsigned char)('a' + rand() % 25);
+        }
+        src_buf[MAX_LEN] = '\0';
+        do {
+            for (size_t i = 0; i < m; i++) {
+                src2_buf[i] = src_buf[(size_t)rand() % MAX_LEN];
+            }
+            src2_buf[m - 1] = CASES[c].periodic ? 'b'
+                            : (m == 1) ? 'z' : src2_buf[m - 1];     /* 'z': not in the text */
+            src2_buf[m] = '\0';
+        } while (strstr((const char *)src_buf, (const char *)src2_buf) != NULL);
+
+        printf("%14s", CASES[c].label);
+        for (size_t v = 0; v < count; v++) {
+            printf("%9.2f", measure(op_strstr, fns[v], MAX_LEN));
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+}
+
+/*
+ * Keyword highlighting over a synthetic 100 MB corpus of quest text:
+ * about one word in 50 is a keyword. One my_strstr pass per keyword
+ * against one my_matcher pass (DFA alone, then with Teddy).
+ */
+#define CORPUS_BYTES (100u << 20)
+
+static const char *const KEYWORDS[] = {
+    "malloc", "CUDA", "pointer", "segfault", "mutex", "kernel", "cache",
+    "SIMD", "struct", "free", "stack", "heap", "thread", "atomic", "inline",
+    "syscall", "mmap", "buffer", "Valgrind", "linker", "register", "vector",
+    "branch", "shadow",
+};
+#define KEYWORD_COUNT (sizeof(KEYWORDS) / sizeof(KEYWORDS[0]))
+
+static const char *const FILLER[] = {
+    "the", "hunter", "must", "clear", "dungeon", "before", "dawn", "and",
+    "defeat", "every", "boss", "with", "quest", "rank", "gate", "daily",
+    "training", "reward", "level", "up", "monarch", "system", "arise",
+};
+#define FILLER_COUNT (sizeof(FILLER) / sizeof(FILLER[0]))
+
+static void bench_keywords(void)
+{
+    char *corpus = malloc(CORPUS_BYTES + 64);
+    my_matcher *mm = my_matcher_new(KEYWORDS, KEYWORD_COUNT);
+    size_t len = 0, found;
+    double start, ms;
+
+    if (corpus == NULL || mm == NULL) {
+        printf("\n  (keyword bench skipped: out of memory)\n");
+        free(corpus);
+        my_matcher_free(mm);
+        return;
+    }
+
+    while (len < CORPUS_BYTES) {
+        const char *w = (rand() % 50 == 0) ? KEYWORDS[(size_t)rand() % KEYWORD_COUNT]
+                                           : FILLER[(size_t)rand() % FILLER_COUNT];
+        size_t wl = strlen(w);
+
+        memcpy(corpus + len, w, wl);
+        len += wl;
+        corpus[len++] = (rand() % 12 == 0) ? '\n' : ' ';
+    }
+    corpus[len] = '\0';
+
+    printf("\n━━━ %zu keywords over %zu MB ━━━\n%26s%10s%10s%12s\n",
+           KEYWORD_COUNT, len >> 20, "", "ms", "GB/s", "matches");
+
+    start = now();
+    found = 0;
+    for (size_t k = 0; k < KEYWORD_COUNT; k++) {
+        for (const char *p = my_strstr(corpus, KEYWORDS[k]); p != NULL;
+             p = my_strstr(p + 1, KEYWORDS[k])) {
+            found++;
+        }
+    }
+    ms = (now() - start) * 1e3;
+    printf("%26s%10.1f%10.2f%12zu\n", "my_strstr per keyword", ms, (double)len / ms / 1e6, found);
+
+    start = now();
+    found = my_matcher_scan_dfa(mm, corpus, len, NULL, NULL);
+    ms = (now() - start) * 1e3;
+    printf("%26s%10.1f%10.2f%12zu\n", "my_matcher, DFA only", ms, (double)len / ms / 1e6, found);
+
+    start = now();
+    found = my_matcher_scan(mm, corpus, len, NULL, NULL);
+    ms = (now() - start) * 1e3;
+    printf("%26s%10.1f%10.2f%12zu\n",
+           my_matcher_prefiltered(mm) ? "my_matcher + Teddy" : "my_matcher (no SSSE3)",
+           ms, (double)len / ms / 1e6, found);
+
+    my_matcher_free(mm);
+    free(corpus);
+}
+
+/*
+ * Length distributions: instead of one length over and over (which
+ * the branch predictor learns), a pool of 4096 strings with lengths
+ * drawn from a distribution, each at a random alignment, called in
+ * turn. Output follows Google Benchmark: time per call, calls made,
+ * bytes per second.
+ */
+#define POOL_STRINGS 4096
+#define POOL_SECONDS 0.05           /* Per timed run */
+
+typedef struct {
+    char *a[POOL_STRINGS];          /* Sources */
+    char *b[POOL_STRINGS];          /* Equal copies of a (strcmp) */
+    char *d[POOL_STRINGS];          /* Destinations (strcpy) */
+    size_t bytes;                   /* Sum of the lengths */
+    unsigned char *mem;
+} string_pool;
+
+static size_t draw_tiny(void)
+{
+    return (size_t)rand() % 16;
+}
+
+static size_t draw_short(void)
+{
+    return 16 + (size_t)rand() % 112;
+}
+
+/* Geometric, mean ~4: identifiers and words */
+static size_t draw_words(void)
+{
+    size_t len = 1;
+
+    while (len < 32 && rand() % 4 != 0) {
+        len++;
+    }
+    return len;
+}
+
+/* Log-uniform 1..4096: every size class equally often */
+static size_t draw_mixed(void)
+{
+    size_t base = (size_t)1 << (rand() % 12);
+    return base + (size_t)rand() % base;
+}
+
+static const struct {
+    const char *name;
+    size_t (*draw)(void);
+} DISTS[] = {
+    { "tiny:0-15",     draw_tiny },
+    { "words:geo4",    draw_words },
+    { "short:16-127",  draw_short },
+    { "mixed:1-4k",    draw_mixed },
+};
+
+#define DIST_COUNT (sizeof(DISTS) / sizeof(DISTS[0]))
+
+static int pool_fill(string_pool *p, size_t (*draw)(void))
+{
+    static size_t lens[POOL_STRINGS];
+    size_t total = 0, at = 0;
+
+    for (size_t i = 0; i < POOL_STRINGS; i++) {
+        lens[i] = draw();
+        total += 3 * (64 + lens[i] + 1);
+    }
+    p->mem = malloc(total);
+    if (p->mem == NULL) {
+        return -1;
+    }
+
+    p->bytes = 0;
+    for (size_t i = 0; i < POOL_STRINGS; i++) {
+        char **slots[3] = { &p->a[i], &p->b[i], &p->d[i] };
+
+        for (int k = 0; k < 3; k++) {
+            *slots[k] = (char *)p->mem + at + (size_t)rand() % 64;
+            at += 64 + lens[i] + 1;
+        }
+        memset(p->a[i], 'x', lens[i]);
+        p->a[i][lens[i]] = '\0';
+        memcpy(p->b[i], p->a[i], lens[i] + 1);
+        p->bytes += lens[i];
+    }
+    return 0;
+}
+
+/* One pass over the pool */
+typedef void (*pool_op)(any_fn fn, const string_pool *p);
+
+static void pool_strlen(any_fn fn, const string_pool *p)
+{
+    size_t (*f)(const char *) = (size_t (*)(const char *))fn;
+    size_t sum = 0;
+
+    for (size_t i = 0; i < POOL_STRINGS; i++) {
+        sum += f(p->a[i]);
+    }
+    volatile size_t sink = sum;
+    (void)sink;
+}
+
+static void pool_strcmp(any_fn fn, const string_pool *p)
+{
+    int (*f)(const char *, const char *) = (int (*)(const char *, const char *))fn;
+    int sum = 0;
+
+    for (size_t i = 0; i < POOL_STRINGS; i++) {
+        sum |= f(p->a[i], p->b[i]);
+    }
+    volatile int sink = sum;
+    (void)sink;
+}
+
+static void pool_strcpy(any_fn fn, const string_pool *p)
+{
+    char *(*f)(char *, const char *) = (char *(*)(char *, const char *))fn;
+
+    for (size_t i = 0; i < POOL_STRINGS; i++) {
+        f(p->d[i], p->a[i]);
+    }
+}
+
+static void bench_pool(const char *op_name, pool_op op, size_t count,
+                       const char *const *names, const any_fn *fns)
+{
+    for (size_t k = 0; k < DIST_COUNT; k++) {
+        string_pool pool;
+
+        if (pool_fill(&pool, DISTS[k].draw) != 0) {
+            return;
+        }
+
+        for (size_t v = 0; v < count; v++) {
+            double start = now(), best = 0.0;
+            unsigned long passes;
+            char name[64];
+
+            op(fns[v], &pool);                  /* Calibrate */
+            passes = (unsigned long)(POOL_SECONDS / (now() - start + 1e-9)) + 1;
+
+            for (int run = 0; run < RUNS; run++) {
+                double secs;
+
+                start = now();
+                for (unsigned long n = 0; n < passes; n++) {
+                    op(fns[v], &pool);
+                    BARRIER();
+                }
+                secs = now() - start;
+                if (run == 0 || secs < best) {
+                    best = secs;
+                }
+            }
+
+            snprintf(name, sizeof(name), "BM_%s/%s/%s", op_name, DISTS[k].name, names[v]);
+            printf("%-34s%9.1f ns%13lu%10.2f GB/s\n", name,
+                   best * 1e9 / ((double)passes * POOL_STRINGS),
+                   passes * POOL_STRINGS,
+                   (double)pool.bytes * (double)passes / best / 1e9);
+            fflush(stdout);
+        }
+        free(pool.mem);
+    }
+}
+
+/*
+ * The price of the bounds checks: each unchecked function beside its
+ * safe_str version, same strings, dest exactly big enough. "cost" is
+ * how much slower the checked one is.
+ */
+static void bench_safe(void)
+{
+    static const struct {
+        const char *name;
+        bench_op plain, safe;
+        any_fn fn;
+        int cat;
+    } PAIRS[] = {
+        { "strlen", op_strlen, op_safe_strlen, (any_fn)my_strlen, 0 },
+        { "strcpy", op_strcpy, op_safe_strcpy, (any_fn)my_strcpy, 0 },
+        { "strcat", op_strcat, op_safe_strcat, (any_fn)my_strcat, 1 },
+    };
+
+    printf("\n━━━ unchecked vs safe_str (GB/s) ━━━\n%10s", "length");
+    for (size_t k = 0; k < sizeof(PAIRS) / sizeof(PAIRS[0]); k++) {
+        printf("%9s%9s%7s", PAIRS[k].name, "safe", "cost");
+    }
+    printf("\n");
+
+    for (size_t l = 0; l < LENGTH_COUNT; l++) {
+        size_t len = LENGTHS[l];
+
+        printf("%10zu", len);
+        for (size_t k = 0; k < sizeof(PAIRS) / sizeof(PAIRS[0]); k++) {
+            double plain, safe;
+
+            memset(src_buf, 'x', len);
+            src_buf[len] = '\0';
+            memset(dst_buf, 'y', len);
+            dst_buf[PAIRS[k].cat ? len : 0] = '\0';
+
+            plain = measure(PAIRS[k].plain, PAIRS[k].fn, len);
+            safe = measure(PAIRS[k].safe, NULL, len);
+            printf("%9.2f%9.2f%6.0f%%", plain, safe, (plain / safe - 1.0) * 100.0);
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+}
+
+/*
+ * Concatenation loop: n words appended one at a time. my_strcat rescans
+ * dest every call (O(n²)); hunter_str knows its end (O(total)).
+ */
+static void bench_concat(void)
+{
+    static const size_t WORDS[] = { 1000, 10000, 40000 };
+    static const char WORD[] = "shadow ";       /* 7 bytes */
+
+    printf("\n━━━ concatenate n words (ms) ━━━\n%10s%12s%12s\n",
+           "n", "my_strcat", "hunter_str");
+
+    for (size_t w = 0; w < sizeof(WORDS) / sizeof(WORDS[0]); w++) {
+        size_t n = WORDS[w];
+        hunter_str s = HUNTER_STR_EMPTY;
+        double start, cat_ms, str_ms;
+
+        dst_buf[0] = '\0';
+        start = now();
+        for (size_t i = 0; i < n; i++) {
+            my_strcat((char *)dst_buf, WORD);
+        }
+        cat_ms = (now() - start) * 1e3;
+
+        start = now();
+        for (size_t i = 0; i < n; i++) {
+            hunter_str_append_cstr(&s, WORD);
+        }
+        str_ms = (now() - start) * 1e3;
+
+        printf("%10zu%12.2f%12.2f\n", n, cat_ms, str_ms);
+        hunter_str_free(&s);
+    }
+}
+
+/*
+ * A 10 MB quest report, one formatted line at a time, three ways:
+ * snprintf + my_strcat (rescans: only the first 1 MB, or it would take
+ * minutes), one growing hunter_str, and a hunter_builder written out
+ * with writev.
+ */
+#define REPORT_BYTES     (10u << 20)
+#define REPORT_CAT_BYTES (1u << 20)
+
+static const char *const RANKS[] = { "E", "D", "C", "B", "A", "S" };
+
+#define REPORT_FMT "Quest #%07u  %-7s rank %s  +%4u XP  streak %3u  [%s]\n"
+#define REPORT_ARGS(i) \
+    (i), ((i) % 3 == 0) ? "DAILY" : "DUNGEON", RANKS[(i) % 6], \
+    10 + (i) % 490, (i) % 365, ((i) % 7 == 0) ? "FAILED" : "CLEARED"
+
+static void bench_report(void)
+{
+    char line[128];
+    size_t cat_len = 0;
+    hunter_str flat = HUNTER_STR_EMPTY;
+    hunter_builder b = HUNTER_BUILDER_EMPTY;
+    double start, cat_ms, str_ms, build_ms, write_ms;
+    unsigned i;
+    int fd;
+
+    printf("\n━━━ quest report (ms) ━━━\n");
+
+    dst_buf[0] = '\0';
+    start = now();
+    for (i = 0; cat_len < REPORT_CAT_BYTES; i++) {
+        cat_len += (size_t)snprintf(line, sizeof(line), REPORT_FMT, REPORT_ARGS(i));
+        my_strcat((char *)dst_buf, line);
+    }
+    cat_ms = (now() - start) * 1e3;
+
+    start = now();
+    for (i = 0; hunter_str_len(&flat) < REPORT_BYTES; i++) {
+        hunter_str_appendf(&flat, REPORT_FMT, REPORT_ARGS(i));
+    }
+    str_ms = (now() - start) * 1e3;
+
+    start = now();
+    for (i = 0; hunter_builder_len(&b) < REPORT_BYTES; i++) {
+        hunter_builder_appendf(&b, REPORT_FMT, REPORT_ARGS(i));
+    }
+    build_ms = (now() - start) * 1e3;
+
+    fd = open("/dev/null", O_WRONLY);
+    start = now();
+    if (fd >= 0) {
+        hunter_builder_write(&b, fd);
+        close(fd);
+    }
+    write_ms = (now() - start) * 1e3;
+
+    printf("  my_strcat, 1 MB only      %10.2f   (x100 for 10 MB: quadratic)\n", cat_ms);
+    printf("  hunter_str, 10 MB         %10.2f\n", str_ms);
+    printf("  hunter_builder, 10 MB     %10.2f   (%zu chunks)\n", build_ms, b.chunks);
+    printf("  + writev to /dev/null     %10.2f\n", write_ms);
+
+    hunter_str_free(&flat);
+    hunter_builder_free(&b);
+}
+
+int main(void)
+{
+    const char *names[MAX_IMPLS];
+    any_fn fns[MAX_IMPLS];
+    size_t count;
+
+    src_buf = aligned_alloc(64, MAX_LEN + 64);
+    src2_buf = aligned_alloc(64, MAX_LEN + 64);
+    dst_buf = aligned_alloc(64, 3 * MAX_LEN + 64);
+    if (src_buf == NULL || src2_buf == NULL || dst_buf == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════════╗\n");
+    printf("║  HUNTER PROTOCOL 2.0 — DAY 11: STRING BENCHMARKS              ║\n");
+    printf("╚═══════════════════════════════════════════════════════════════╝\n");
+    printf("  dispatch: %s\n", my_strlen_selected());
+
+#define COLLECT(impls_fn, type, glibc) do { \
+    const type *impls; \
+    count = impls_fn(&impls); \
+    for (size_t v = 0; v < count; v++) { \
+        names[v] = impls[v].name; \
+        fns[v] = (any_fn)impls[v].fn; \
+    } \
+    names[count] = "glibc"; \
+    fns[count++] = (any_fn)glibc; \
+} while (0)
+
+    COLLECT(my_strlen_impls, my_strlen_impl, strlen);
+    bench_table("strlen", op_strlen, count, names, fns, 0);
+
+    COLLECT(my_strcmp_impls, my_strcmp_impl, strcmp);
+    bench_table("strcmp (equal strings)", op_strcmp, count, names, fns, 0);
+
+    COLLECT(my_strcpy_impls, my_strcpy_impl, strcpy);
+    bench_table("strcpy", op_strcpy, count, names, fns, 0);
+
+    COLLECT(my_strncpy_impls, my_strncpy_impl, strncpy);
+    bench_table("strncpy (n = 2 x length)", op_strncpy, count, names, fns, 0);
+
+    COLLECT(my_strcat_impls, my_strcpy_impl, strcat);
+    bench_table("strcat (dest holds length bytes)", op_strcat, count, names, fns, 1);
+
+    /* No strrev in glibc: the last column is the UTF-8 mode instead */
+    COLLECT(my_strrev_impls, my_strrev_impl, my_strrev_utf8);
+    names[count - 1] = "utf8";
+    bench_table("strrev (in place)", op_strrev, count, names, fns, 0);
+
+    printf("\n━━━ length distributions ━━━\n%-34s%12s%13s%15s\n",
+           "Benchmark", "Time", "Iterations", "bytes/second");
+    COLLECT(my_strlen_impls, my_strlen_impl, strlen);
+    bench_pool("strlen", pool_strlen, count, names, fns);
+    COLLECT(my_strcmp_impls, my_strcmp_impl, strcmp);
+    bench_pool("strcmp", pool_strcmp, count, names, fns);
+    COLLECT(my_strcpy_impls, my_strcpy_impl, strcpy);
+    bench_pool("strcpy", pool_strcpy, count, names, fns);
+
+    COLLECT(my_strstr_impls, my_strstr_impl, strstr);
+    bench_strstr(count, names, fns);
+    bench_keywords();
+
+#undef COLLECT
+
+    bench_safe();
+    bench_concat();
+    bench_report();
+
+    free(src_buf);
+    free(src2_buf);
+    free(dst_buf);
+    return EXIT_SUCCESS;
+}
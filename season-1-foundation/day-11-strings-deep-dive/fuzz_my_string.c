@@ -0,0 +1,945 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  fuzz_my_string.c — Differential Fuzzing Against glibc
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Let the machine find the case you didn't think of."
+ *
+ *  Every input is one test case: which function, where the strings sit,
+ *  and the string bytes themselves. Every implementation of that
+ *  function (ref, swar, sse2, avx2) runs on it and must agree with
+ *  glibc. Where glibc has no twin there is a model instead:
+ *
+ *      my_strrev         my_strrev_ref
+ *      my_strrev_utf8    same bytes out; characters built from the input
+ *                        come back in reverse order, and twice is a no-op
+ *      my_matcher_scan   brute force, as in test_my_string.c
+ *      (and _scan_dfa)
+ *
+ *  Any disagreement aborts, and so does any read or write past the
+ *  string: each string can be placed flush against a GUARD PAGE.
+ *
+ *      input:  [ op | off_a | off_b | flags | n (2) | split (2) | bytes... ]
+ *                                                               a ↑ b
+ *
+ *      flags:  1 = a ends at its guard page    4 = a has no '\0'
+ *              2 = dest/b ends at its guard    (only where legal: n-bounded)
+ *
+ *  The matcher reads patterns out of b and scans a (see fuzz_matcher).
+ *
+ *  Three ways to drive it:
+ *
+ *      make fuzz                          built-in random driver (gcc, ASan)
+ *      ./fuzz_strings FILE...             replay inputs (crashes, AFL @@)
+ *      clang -fsanitize=fuzzer,address -DFUZZ_LIBFUZZER ...
+ *                                         libFuzzer supplies main()
+ *
+ *  The built-in driver saves a failing input to fuzz_crash.bin.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#define _DEFAULT_SOURCE      /* MAP_ANONYMOUS, strnlen */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "my_string.h"
+#include "safe_str.h"
+
+#define MAX_STR     4096            /* Longest a or b */
+#define HEADER      8
+#define MAX_INPUT   (HEADER + 2 * MAX_STR)
+#define FILL        0xA5            /* Untouched dest bytes */
+
+enum {
+    OP_STRLEN, OP_STRNLEN, OP_STRCMP, OP_STRNCMP, OP_STRCPY, OP_STRNCPY,
+    OP_STRNCPY_LEN, OP_STRCAT, OP_STRSTR, OP_STRREV, OP_SAFE_STRCPY,
+    OP_SAFE_STRCAT, OP_STRREV_UTF8, OP_MATCHER, OP_COUNT
+};
+
+static const char *const OP_NAMES[] = {
+    "strlen", "strnlen", "strcmp", "strncmp", "strcpy", "strncpy",
+    "strncpy_len", "strcat", "strstr", "strrev", "safe_strcpy", "safe_strcat",
+    "strrev_utf8", "matcher"
+};
+
+/* One decoded input */
+typedef struct {
+    unsigned op;
+    size_t off_a, off_b;
+    unsigned flags;
+    size_t n;
+    const unsigned char *a, *b;
+    size_t a_len, b_len;
+} fuzz_case;
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Guarded Regions
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *      base                                 end
+ *       ↓                                    ↓
+ *      [ ......... 3 × MAX_STR bytes ....... ][ PROT_NONE ]
+ *       off ↑ or                    ↑ flush
+ */
+typedef struct {
+    unsigned char *base;
+    unsigned char *end;
+    size_t size;
+} region;
+
+static region src_a, src_b, dst;
+static unsigned char *expect;           /* What glibc left in dst */
+static const unsigned char *current;    /* For the crash file */
+static size_t current_size;
+
+static region region_new(void)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = (3 * MAX_STR + page - 1) / page * page;
+    region r = { NULL, NULL, size };
+    unsigned char *p = mmap(NULL, size + page, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (p == MAP_FAILED || mprotect(p + size, page, PROT_NONE) != 0) {
+        perror("fuzz: guard page");
+        exit(EXIT_FAILURE);
+    }
+    r.base = p;
+    r.end = p + size;
+    return r;
+}
+
+static void setup(void)
+{
+    if (dst.base == NULL) {
+        src_a = region_new();
+        src_b = region_new();
+        dst = region_new();
+        expect = malloc(dst.size);
+        if (expect == NULL) {
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/* n bytes of data (+ '\0' if terminate) at base + off, or ending at the guard */
+static unsigned char *put(const region *r, const unsigned char *data, size_t n,
+                          int terminate, size_t off, int flush)
+{
+    size_t total = n + (terminate ? 1 : 0);
+    unsigned char *p = flush ? r->end - total : r->base + off;
+
+    memcpy(p, data, n);
+    if (terminate) {
+        p[n] = '\0';
+    }
+    return p;
+}
+
+/* Where in dst a write of total bytes starts */
+static unsigned char *dest_at(const fuzz_case *c, size_t total)
+{
+    return (c->flags & 2) ? dst.end - total : dst.base + c->off_b;
+}
+
+/* Fill dst and expect with FILL; optionally put a string at d in both */
+static void reset_dest(unsigned char *d, const unsigned char *head, size_t len)
+{
+    memset(dst.base, FILL, dst.size);
+    if (head != NULL) {
+        memcpy(d, head, len);
+        d[len] = '\0';
+    }
+    memcpy(expect, dst.base, dst.size);
+}
+
+/* Restore dst to what reset_dest made it (expect is the result now) */
+static void redo_dest(unsigned char *d, const unsigned char *head, size_t len)
+{
+    memset(dst.base, FILL, dst.size);
+    if (head != NULL) {
+        memcpy(d, head, len);
+        d[len] = '\0';
+    }
+}
+
+static unsigned char *in_expect(const unsigned char *d)
+{
+    return expect + (d - dst.base);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Failure
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+static void fail(const fuzz_case *c, const char *impl, const char *what)
+{
+    fprintf(stderr, "\n  ✗ %s/%s: %s (a_len=%zu b_len=%zu n=%zu flags=%u off=%zu,%zu)\n",
+            OP_NAMES[c->op], impl, what, c->a_len, c->b_len, c->n, c->flags,
+            c->off_a, c->off_b);
+#ifndef FUZZ_LIBFUZZER
+    {
+        FILE *f = fopen("fuzz_crash.bin", "wb");
+        if (f != NULL) {
+            fwrite(current, 1, current_size, f);
+            fclose(f);
+            fprintf(stderr, "  input saved: ./fuzz_strings fuzz_crash.bin\n");
+        }
+    }
+#endif
+    abort();
+}
+
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Length and Compare
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+static void fuzz_strlen(const fuzz_case *c)
+{
+    const my_strlen_impl *impls;
+    size_t count = my_strlen_impls(&impls);
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    size_t want = strlen(s);
+
+    for (size_t v = 0; v < count; v++) {
+        if (impls[v].fn(s) != want) {
+            fail(c, impls[v].name, "length differs from strlen");
+        }
+    }
+}
+
+/* Also safe_strlen, whose answer follows from strnlen */
+static void fuzz_strnlen(const fuzz_case *c)
+{
+    const my_strnlen_impl *impls;
+    size_t count = my_strnlen_impls(&impls);
+    int bare = (c->flags & 4) != 0;
+    size_t n = bare ? c->n % (c->a_len + 1) : c->n;
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, !bare, c->off_a, c->flags & 1);
+    size_t want = strnlen(s, n), len = 0;
+    error_t err;
+
+    for (size_t v = 0; v < count; v++) {
+        if (impls[v].fn(s, n) != want) {
+            fail(c, impls[v].name, "length differs from strnlen");
+        }
+    }
+
+    /* safe_strlen(s, m) looks at m + 1 bytes: only legal below n */
+    if (n > 0) {
+        err = safe_strlen(s, n - 1, &len);
+        if ((want < n) ? (err != ERR_OK || len != want) : err != ERR_OVERFLOW) {
+            fail(c, "safe_strlen", "wrong result");
+        }
+    }
+}
+
+static void fuzz_strcmp(const fuzz_case *c)
+{
+    const my_strcmp_impl *impls;
+    size_t count = my_strcmp_impls(&impls);
+    const char *a = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    const char *b = (const char *)put(&src_b, c->b, c->b_len, 1, c->off_b, c->flags & 2);
+    int want = sign(strcmp(a, b));
+
+    for (size_t v = 0; v < count; v++) {
+        if (sign(impls[v].fn(a, b)) != want) {
+            fail(c, impls[v].name, "sign differs from strcmp");
+        }
+    }
+}
+
+static void fuzz_strncmp(const fuzz_case *c)
+{
+    const my_strncmp_impl *impls;
+    size_t count = my_strncmp_impls(&impls);
+    int bare = (c->flags & 4) != 0;
+    size_t shorter = (c->a_len < c->b_len) ? c->a_len : c->b_len;
+    size_t n = bare ? c->n % (shorter + 1) : c->n;
+    const char *a = (const char *)put(&src_a, c->a, c->a_len, !bare, c->off_a, c->flags & 1);
+    const char *b = (const char *)put(&src_b, c->b, c->b_len, !bare, c->off_b, c->flags & 2);
+    int want = sign(strncmp(a, b, n));
+
+    for (size_t v = 0; v < count; v++) {
+        if (sign(impls[v].fn(a, b, n)) != want) {
+            fail(c, impls[v].name, "sign differs from strncmp");
+        }
+    }
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Copies
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  glibc writes into expect, each implementation into dst (which ends
+ *  at a guard page when flag 2 is set); then all of dst must equal
+ *  expect, so a stray write anywhere in the region is caught too.
+ */
+static void check_dest(const fuzz_case *c, const char *impl)
+{
+    if (memcmp(dst.base, expect, dst.size) != 0) {
+        fail(c, impl, "dest differs from the expected bytes");
+    }
+}
+
+static void fuzz_strcpy(const fuzz_case *c)
+{
+    const my_strcpy_impl *impls;
+    size_t count = my_strcpy_impls(&impls);
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    char *d = (char *)dest_at(c, strlen(s) + 1);
+
+    reset_dest((unsigned char *)d, NULL, 0);
+    strcpy((char *)in_expect((unsigned char *)d), s);
+
+    for (size_t v = 0; v < count; v++) {
+        redo_dest((unsigned char *)d, NULL, 0);
+        if (impls[v].fn(d, s) != d) {
+            fail(c, impls[v].name, "wrong return value");
+        }
+        check_dest(c, impls[v].name);
+    }
+}
+
+static void fuzz_strncpy(const fuzz_case *c)
+{
+    const my_strncpy_impl *impls;
+    size_t count = my_strncpy_impls(&impls);
+    int bare = (c->flags & 4) != 0;
+    size_t n = bare ? c->n % (c->a_len + 1) : c->n;
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, !bare, c->off_a, c->flags & 1);
+    char *d = (char *)dest_at(c, n);
+
+    reset_dest((unsigned char *)d, NULL, 0);
+    strncpy((char *)in_expect((unsigned char *)d), s, n);
+
+    for (size_t v = 0; v < count; v++) {
+        redo_dest((unsigned char *)d, NULL, 0);
+        if (impls[v].fn(d, s, n) != d) {
+            fail(c, impls[v].name, "wrong return value");
+        }
+        check_dest(c, impls[v].name);
+    }
+}
+
+/* No glibc twin: strnlen + memcpy + one '\0' is the same contract */
+static void fuzz_strncpy_len(const fuzz_case *c)
+{
+    const my_strncpy_len_impl *impls;
+    size_t count = my_strncpy_len_impls(&impls);
+    int bare = (c->flags & 4) != 0;
+    size_t n = bare ? c->n % (c->a_len + 1) : c->n;
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, !bare, c->off_a, c->flags & 1);
+    size_t len = strnlen(s, n);
+    char *d = (char *)dest_at(c, len + (len < n));
+    unsigned char *e = in_expect((unsigned char *)d);
+
+    reset_dest((unsigned char *)d, NULL, 0);
+    memcpy(e, s, len);
+    if (len < n) {
+        e[len] = '\0';
+    }
+
+    for (size_t v = 0; v < count; v++) {
+        redo_dest((unsigned char *)d, NULL, 0);
+        if (impls[v].fn(d, s, n) != len) {
+            fail(c, impls[v].name, "wrong length");
+        }
+        check_dest(c, impls[v].name);
+    }
+}
+
+/* dest starts as b, a is appended */
+static void fuzz_strcat(const fuzz_case *c)
+{
+    const my_strcpy_impl *impls;
+    size_t count = my_strcat_impls(&impls);
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    size_t head = strnlen((const char *)c->b, c->b_len);
+    char *d = (char *)dest_at(c, head + strlen(s) + 1);
+
+    reset_dest((unsigned char *)d, c->b, head);
+    strcat((char *)in_expect((unsigned char *)d), s);
+
+    for (size_t v = 0; v < count; v++) {
+        redo_dest((unsigned char *)d, c->b, head);
+        if (impls[v].fn(d, s) != d) {
+            fail(c, impls[v].name, "wrong return value");
+        }
+        check_dest(c, impls[v].name);
+    }
+}
+
+/* No glibc twin: the reference is the model */
+static void fuzz_strrev(const fuzz_case *c)
+{
+    const my_strrev_impl *impls;
+    size_t count = my_strrev_impls(&impls);
+    size_t len = strnlen((const char *)c->a, c->a_len);
+    char *d = (char *)dest_at(c, len + 1);
+
+    reset_dest((unsigned char *)d, c->a, len);
+    my_strrev_ref((char *)in_expect((unsigned char *)d));
+
+    for (size_t v = 0; v < count; v++) {
+        redo_dest((unsigned char *)d, c->a, len);
+        if (impls[v].fn(d) != d) {
+            fail(c, impls[v].name, "wrong return value");
+        }
+        check_dest(c, impls[v].name);
+    }
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  UTF-8 Reverse
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Random bytes are almost never valid UTF-8, so a is used twice:
+ *
+ *    as is      my_strrev_utf8 may only move bytes around, and only
+ *               inside the string
+ *    as seeds   each byte picks a character (ASCII, or 2-4 bytes,
+ *               surrogates excluded); the result must be those
+ *               characters in reverse order, and reversing it again
+ *               must give the original back
+ */
+static size_t put_utf8(unsigned char *out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out[0] = (unsigned char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (unsigned char)(0xC0 | cp >> 6);
+        out[1] = (unsigned char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (unsigned char)(0xE0 | cp >> 12);
+        out[1] = (unsigned char)(0x80 | (cp >> 6 & 0x3F));
+        out[2] = (unsigned char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (unsigned char)(0xF0 | cp >> 18);
+    out[1] = (unsigned char)(0x80 | (cp >> 12 & 0x3F));
+    out[2] = (unsigned char)(0x80 | (cp >> 6 & 0x3F));
+    out[3] = (unsigned char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+/*
+ * make_utf8 — Valid UTF-8 from seed bytes, and its reverse by character
+ *
+ * Returns:
+ *   Length of both (at most MAX_STR)
+ */
+static size_t make_utf8(const unsigned char *seed, size_t n,
+                        unsigned char *fwd, unsigned char *rev)
+{
+    static size_t start[MAX_STR];
+    size_t chars = 0, len = 0;
+
+    for (size_t i = 0; i < n && len + 4 <= MAX_STR; i++) {
+        uint32_t b = seed[i], x, cp;
+
+        if (b == 0) {
+            continue;
+        }
+        x = b << 8 | ((i + 1 < n) ? seed[i + 1] : 0);
+        if (b < 0x80) {
+            cp = b;
+        } else if (b % 3 == 0) {
+            cp = 0x80 + x % (0x800 - 0x80);
+        } else if (b % 3 == 1) {
+            cp = 0x800 + x % (0x10000 - 0x800);
+            if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp += 0x800;
+            }
+        } else {
+            cp = 0x10000 + x * 17 % 0x100000;
+        }
+
+        start[chars++] = len;
+        len += put_utf8(fwd + len, cp);
+    }
+
+    for (size_t k = chars, at = 0; k-- > 0;) {
+        size_t end = (k + 1 < chars) ? start[k + 1] : len;
+        memcpy(rev + at, fwd + start[k], end - start[k]);
+        at += end - start[k];
+    }
+    return len;
+}
+
+/* Nothing outside d[0, len) may change, and d[len] stays '\0' */
+static void check_outside(const fuzz_case *c, const unsigned char *d, size_t len)
+{
+    size_t before = (size_t)(d - dst.base);
+
+    if (memcmp(dst.base, expect, before) != 0 ||
+        memcmp(d + len, in_expect(d) + len, dst.size - before - len) != 0) {
+        fail(c, "my_strrev_utf8", "wrote outside the string");
+    }
+}
+
+static void fuzz_strrev_utf8(const fuzz_case *c)
+{
+    static unsigned char fwd[MAX_STR + 1], rev[MAX_STR + 1];
+    size_t len = strnlen((const char *)c->a, c->a_len);
+    size_t count_in[256] = { 0 }, count_out[256] = { 0 };
+    unsigned char *d = dest_at(c, len + 1);
+
+    /* Any bytes: a permutation, in place */
+    reset_dest(d, c->a, len);
+    if (my_strrev_utf8((char *)d) != (char *)d) {
+        fail(c, "my_strrev_utf8", "wrong return value");
+    }
+    check_outside(c, d, len);
+    for (size_t i = 0; i < len; i++) {
+        count_in[c->a[i]]++;
+        count_out[d[i]]++;
+    }
+    if (memcmp(count_in, count_out, sizeof(count_in)) != 0) {
+        fail(c, "my_strrev_utf8", "output isn't the input's bytes");
+    }
+
+    /* Valid UTF-8: exact result, and an involution */
+    len = make_utf8(c->a, c->a_len, fwd, rev);
+    d = dest_at(c, len + 1);
+    reset_dest(d, fwd, len);
+    my_strrev_utf8((char *)d);
+    if (memcmp(d, rev, len) != 0) {
+        fail(c, "my_strrev_utf8", "characters not reversed");
+    }
+    check_outside(c, d, len);
+    my_strrev_utf8((char *)d);
+    if (memcmp(d, fwd, len) != 0) {
+        fail(c, "my_strrev_utf8", "reversing twice changed the text");
+    }
+}
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  safe_str
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  n is the buffer size; flag 2 puts the END OF THE BUFFER (not the
+ *  string) at the guard page, so nothing may be written past size.
+ */
+static void fuzz_safe_strcpy(const fuzz_case *c)
+{
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    size_t size = c->n;
+    size_t slen = strlen(s);
+    char *d = (char *)dest_at(c, size);
+    unsigned char *e = in_expect((unsigned char *)d);
+    error_t want = ERR_INVALID_ARG, err;
+    size_t len = 0;
+
+    reset_dest((unsigned char *)d, NULL, 0);
+    if (size > 0) {
+        size_t copy = (slen < size - 1) ? slen : size - 1;
+        memcpy(e, s, copy);
+        e[copy] = '\0';
+        want = (slen > size - 1) ? ERR_OVERFLOW : ERR_OK;
+    }
+
+    redo_dest((unsigned char *)d, NULL, 0);
+    err = safe_strcpy(d, size, s, &len);
+    if (err != want || (size > 0 && len != strlen((const char *)e))) {
+        fail(c, "safe_strcpy", "wrong result");
+    }
+    check_dest(c, "safe_strcpy");
+}
+
+/* dest starts as b (maybe cut off by the size: then it has no '\0') */
+static void fuzz_safe_strcat(const fuzz_case *c)
+{
+    const char *s = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    size_t size = c->n;
+    size_t head = strnlen((const char *)c->b, c->b_len);
+    size_t fill = (head < size) ? head : size;
+    char *d = (char *)dest_at(c, size);
+    unsigned char *e = in_expect((unsigned char *)d);
+    error_t want = ERR_INVALID_ARG, err;
+    size_t len = 0;
+
+    memset(dst.base, FILL, dst.size);
+    memcpy(d, c->b, fill);
+    if (fill < size) {
+        d[fill] = '\0';
+    }
+    memcpy(expect, dst.base, dst.size);
+
+    if (size > 0 && fill == size) {
+        want = ERR_OUT_OF_BOUNDS;
+    } else if (size > 0) {
+        size_t room = size - 1 - head;
+        size_t slen = strlen(s);
+        size_t copy = (slen < room) ? slen : room;
+        memcpy(e + head, s, copy);
+        e[head + copy] = '\0';
+        want = (slen > room) ? ERR_OVERFLOW : ERR_OK;
+    }
+
+    memset(dst.base, FILL, dst.size);
+    memcpy(d, c->b, fill);
+    if (fill < size) {
+        d[fill] = '\0';
+    }
+    err = safe_strcat(d, size, s, &len);
+    if (err != want ||
+        ((want == ERR_OK || want == ERR_OVERFLOW) && len != strlen((const char *)e))) {
+        fail(c, "safe_strcat", "wrong result");
+    }
+    check_dest(c, "safe_strcat");
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Search
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+static void fuzz_strstr(const fuzz_case *c)
+{
+    const my_strstr_impl *impls;
+    size_t count = my_strstr_impls(&impls);
+    const char *h = (const char *)put(&src_a, c->a, c->a_len, 1, c->off_a, c->flags & 1);
+    const char *n = (const char *)put(&src_b, c->b, c->b_len, 1, c->off_b, c->flags & 2);
+    const char *want = strstr(h, n);
+
+    for (size_t v = 0; v < count; v++) {
+        if (impls[v].fn(h, n) != want) {
+            fail(c, impls[v].name, "match differs from strstr");
+        }
+    }
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Multi-Pattern Search
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  b is cut into patterns of at most 1 + n % MATCH_MAX_PLEN bytes
+ *  (at '\0' too: patterns are C strings), up to 8 of them, or 64 with
+ *  flag 4 (past the Teddy prefilter's limit). The text is the first
+ *  MATCH_MAX_TEXT bytes of a, '\0's included, flush against the guard
+ *  with flag 1. Flag 8 makes the callback stop the scan early.
+ */
+#define MATCH_MAX_TEXT  1024
+#define MATCH_MAX_PLEN  8
+#define MATCH_MAX_PATS  64
+#define MATCH_MAX       (MATCH_MAX_TEXT * MATCH_MAX_PLEN)
+
+typedef struct {
+    size_t start[MATCH_MAX];
+    size_t pattern[MATCH_MAX];
+    size_t n;
+    size_t stop_after;          /* Stop the scan at this many (0: never) */
+} match_log;
+
+static int log_match(size_t start, size_t pattern, void *ctx)
+{
+    match_log *log = ctx;
+
+    if (log->n < MATCH_MAX) {
+        log->start[log->n] = start;
+        log->pattern[log->n] = pattern;
+    }
+    log->n++;
+    return log->stop_after != 0 && log->n >= log->stop_after;
+}
+
+/*
+ * brute_matches — test_my_string.c's model: by end position, longest
+ * first, a repeated pattern only under its first index (lengths are
+ * capped here, so the scan per end is short)
+ */
+static void brute_matches(const char *const *pats, size_t count,
+                          const char *text, size_t len, match_log *log)
+{
+    log->n = 0;
+    for (size_t end = 0; end < len; end++) {
+        size_t longest = (end + 1 < MATCH_MAX_PLEN) ? end + 1 : MATCH_MAX_PLEN;
+
+        for (size_t plen = longest; plen > 0; plen--) {
+            for (size_t p = 0; p < count; p++) {
+                int first = 1;
+
+                if (strlen(pats[p]) != plen ||
+                    memcmp(text + end + 1 - plen, pats[p], plen) != 0) {
+                    continue;
+                }
+                for (size_t q = 0; q < p; q++) {
+                    first = first && strcmp(pats[q], pats[p]) != 0;
+                }
+                if (first && log->n < MATCH_MAX) {
+                    log->start[log->n] = end + 1 - plen;
+                    log->pattern[log->n++] = p;
+                }
+            }
+        }
+    }
+}
+
+static void check_matches(const fuzz_case *c, const char *impl, size_t reported,
+                          const match_log *got, const match_log *want)
+{
+    size_t n = want->n;
+
+    if (got->stop_after != 0 && n > got->stop_after) {
+        n = got->stop_after;
+    }
+    if (reported != n || got->n != n ||
+        memcmp(got->start, want->start, n * sizeof(size_t)) != 0 ||
+        memcmp(got->pattern, want->pattern, n * sizeof(size_t)) != 0) {
+        fail(c, impl, "matches differ from brute force");
+    }
+}
+
+static void fuzz_matcher(const fuzz_case *c)
+{
+    static char storage[MATCH_MAX_PATS][MATCH_MAX_PLEN + 1];
+    static match_log got, want;
+    const char *pats[MATCH_MAX_PATS];
+    size_t plen = 1 + c->n % MATCH_MAX_PLEN;
+    size_t max_pats = (c->flags & 4) ? MATCH_MAX_PATS : 8;
+    size_t count = 0, len = (c->a_len < MATCH_MAX_TEXT) ? c->a_len : MATCH_MAX_TEXT;
+    size_t stop = (c->flags & 8) ? 1 + c->n % 4 : 0;
+    const char *text = (const char *)put(&src_a, c->a, len, 0, c->off_a, c->flags & 1);
+    my_matcher *mm;
+
+    for (size_t i = 0; i < c->b_len && count < max_pats;) {
+        size_t k = 0;
+
+        while (k < plen && i + k < c->b_len && c->b[i + k] != '\0') {
+            storage[count][k] = (char)c->b[i + k];
+            k++;
+        }
+        storage[count][k] = '\0';
+        if (k > 0) {
+            pats[count] = storage[count];
+            count++;
+        }
+        i += (k > 0) ? k : 1;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    mm = my_matcher_new(pats, count);
+    if (mm == NULL) {
+        fail(c, "my_matcher_new", "valid patterns rejected");
+    }
+    brute_matches(pats, count, text, len, &want);
+
+    got.n = 0;
+    got.stop_after = stop;
+    check_matches(c, "my_matcher_scan_dfa",
+                  my_matcher_scan_dfa(mm, text, len, log_match, &got), &got, &want);
+    got.n = 0;
+    check_matches(c, "my_matcher_scan",
+                  my_matcher_scan(mm, text, len, log_match, &got), &got, &want);
+    my_matcher_free(mm);
+}
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Entry Point
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+typedef void (*fuzz_op)(const fuzz_case *c);
+
+static const fuzz_op OPS[OP_COUNT] = {
+    fuzz_strlen, fuzz_strnlen, fuzz_strcmp, fuzz_strncmp, fuzz_strcpy,
+    fuzz_strncpy, fuzz_strncpy_len, fuzz_strcat, fuzz_strstr, fuzz_strrev,
+    fuzz_safe_strcpy, fuzz_safe_strcat, fuzz_strrev_utf8, fuzz_matcher
+};
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    fuzz_case c;
+    size_t rest, split;
+
+    if (size < HEADER || size > MAX_INPUT) {
+        return 0;
+    }
+    setup();
+    current = data;
+    current_size = size;
+
+    rest = size - HEADER;
+    split = ((size_t)data[6] | (size_t)data[7] << 8) % (rest + 1);
+    if (split > MAX_STR || rest - split > MAX_STR) {
+        return 0;
+    }
+
+    c.op = data[0] % OP_COUNT;
+    c.off_a = data[1] % 64;
+    c.off_b = data[2] % 64;
+    c.flags = data[3];
+    c.n = ((size_t)data[4] | (size_t)data[5] << 8) % (MAX_STR + 64);
+    c.a = data + HEADER;
+    c.a_len = split;
+    c.b = data + HEADER + split;
+    c.b_len = rest - split;
+
+    OPS[c.op](&c);
+    return 0;
+}
+
+
+#ifndef FUZZ_LIBFUZZER
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Standalone Driver
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  ./fuzz_strings [iterations [seed]]   random inputs
+ *  ./fuzz_strings FILE...               replay saved inputs ("-" = stdin)
+ *
+ *  Random bytes almost never make equal strings or a needle that's
+ *  present, so b is often built from a: a copy with one byte changed,
+ *  or a piece of it. Bytes come mostly from a 4-letter alphabet, with
+ *  some 0x80-0xFF and the odd '\0'.
+ */
+static unsigned char random_byte(void)
+{
+    int r = rand() % 64;
+
+    if (r == 0) {
+        return '\0';
+    }
+    if (r < 8) {
+        return (unsigned char)(0x80 + rand() % 128);
+    }
+    return (unsigned char)('a' + r % 4);
+}
+
+/* Mostly short, sometimes long (the wide loops need a few blocks) */
+static size_t random_len(void)
+{
+    switch (rand() % 4) {
+    case 0:  return (size_t)rand() % 16;
+    case 1:  return (size_t)rand() % 100;
+    case 2:  return (size_t)rand() % 400;
+    default: return (size_t)rand() % (MAX_STR + 1);
+    }
+}
+
+static size_t random_input(unsigned char *in)
+{
+    size_t a_len = random_len(), b_len;
+    unsigned char *a = in + HEADER, *b = a + a_len;
+
+    for (size_t i = 0; i < a_len; i++) {
+        a[i] = random_byte();
+    }
+
+    switch (rand() % 3) {
+    case 0:                                     /* Copy, maybe changed */
+        b_len = a_len;
+        memcpy(b, a, a_len);
+        if (b_len > 0 && rand() % 2) {
+            b[(size_t)rand() % b_len] = random_byte();
+        }
+        break;
+    case 1:                                     /* Piece */
+        b_len = (a_len > 0) ? 1 + (size_t)rand() % ((a_len < 64) ? a_len : 64) : 0;
+        memcpy(b, a + (a_len > b_len ? (size_t)rand() % (a_len - b_len + 1) : 0), b_len);
+        break;
+    default:
+        b_len = random_len();
+        for (size_t i = 0; i < b_len; i++) {
+            b[i] = random_byte();
+        }
+    }
+
+    for (size_t i = 0; i < HEADER; i++) {
+        in[i] = (unsigned char)rand();
+    }
+    in[4] = (unsigned char)(rand() % 2 ? a_len + (size_t)rand() % 3 - 1 : (size_t)rand());
+    in[5] = (unsigned char)((rand() % 2 ? a_len : (size_t)rand() % (MAX_STR + 1)) >> 8);
+    in[6] = (unsigned char)a_len;
+    in[7] = (unsigned char)(a_len >> 8);
+    return HEADER + a_len + b_len;
+}
+
+static int replay(const char *path)
+{
+    static unsigned char in[MAX_INPUT];
+    FILE *f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    size_t size;
+
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    size = fread(in, 1, sizeof(in), f);
+    if (f != stdin) {
+        fclose(f);
+    }
+    LLVMFuzzerTestOneInput(in, size);
+    return 0;
+}
+
+static int is_number(const char *s)
+{
+    return s[0] != '\0' && strspn(s, "0123456789") == strlen(s);
+}
+
+int main(int argc, char **argv)
+{
+    static unsigned char in[MAX_INPUT];
+    unsigned long iterations = 200000;
+    unsigned seed = (unsigned)getpid();
+
+    if (argc > 1 && !is_number(argv[1])) {
+        for (int i = 1; i < argc; i++) {
+            if (replay(argv[i]) != 0) {
+                return EXIT_FAILURE;
+            }
+        }
+        printf("  %d input(s) replayed, no differences\n", argc - 1);
+        return EXIT_SUCCESS;
+    }
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        seed = (unsigned)strtoul(argv[2], NULL, 10);
+    }
+
+    printf("\n━━━ Differential fuzzing: %lu inputs, seed %u ━━━\n", iterations, seed);
+    srand(seed);
+    for (unsigned long i = 0; i < iterations; i++) {
+        LLVMFuzzerTestOneInput(in, random_input(in));
+    }
+    printf("  ✓ every implementation agreed with glibc or its model on every input\n\n");
+    return EXIT_SUCCESS;
+}
+#endif /* FUZZ_LIBFUZZER */
@@ -0,0 +1,256 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  hunter_builder.c — Chunked String Builder Implementation
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Write it down once. Never copy it again."
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#define _POSIX_C_SOURCE 200809L     /* writev, ssize_t */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "hunter_builder.h"
+
+/* iovecs per writev call (POSIX guarantees at least 16 are allowed) */
+#define IOV_BATCH 64
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Chunks
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void hunter_builder_init(hunter_builder *b)
+{
+    b->head = NULL;
+    b->tail = NULL;
+    b->total = 0;
+    b->chunks = 0;
+}
+
+void hunter_builder_free(hunter_builder *b)
+{
+    hunter_chunk *c = b->head;
+
+    while (c != NULL) {
+        hunter_chunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    hunter_builder_init(b);
+}
+
+/* Free space in the tail chunk */
+static size_t room(const hunter_builder *b)
+{
+    return (b->tail != NULL) ? b->tail->cap - b->tail->len : 0;
+}
+
+/*
+ * new_chunk — Allocate (not link) a chunk for at least need bytes
+ *
+ * Normal size doubles with each chunk up to the max; a bigger piece
+ * gets a chunk of exactly its size.
+ */
+static hunter_chunk *new_chunk(const hunter_builder *b, size_t need)
+{
+    size_t cap = HUNTER_BUILDER_FIRST_CHUNK;
+    hunter_chunk *c;
+
+    if (b->tail != NULL) {
+        cap = b->tail->cap * 2;
+        if (cap > HUNTER_BUILDER_MAX_CHUNK) {
+            cap = HUNTER_BUILDER_MAX_CHUNK;
+        }
+    }
+    if (cap < need) {
+        cap = need;
+    }
+    if (cap > SIZE_MAX - sizeof(hunter_chunk)) {
+        return NULL;
+    }
+
+    c = malloc(sizeof(hunter_chunk) + cap);
+    if (c != NULL) {
+        c->next = NULL;
+        c->len = 0;
+        c->cap = cap;
+    }
+    return c;
+}
+
+static void link_chunk(hunter_builder *b, hunter_chunk *c)
+{
+    if (b->tail != NULL) {
+        b->tail->next = c;
+    } else {
+        b->head = c;
+    }
+    b->tail = c;
+    b->chunks++;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Appending
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Allocate first, copy second: if malloc fails, nothing has been
+ *  written and the builder is exactly as it was.
+ *
+ *      tail: [ ......used...... | 10 free ]   append 25 bytes
+ *      →     [ ......used......   10 here ] → [ 15 here | ... free ]
+ */
+int hunter_builder_append(hunter_builder *b, hunter_view v)
+{
+    size_t first = room(b);
+    hunter_chunk *c = NULL;
+
+    if (first > v.len) {
+        first = v.len;
+    }
+    if (v.len > first) {
+        c = new_chunk(b, v.len - first);
+        if (c == NULL) {
+            return -1;
+        }
+    }
+
+    if (first > 0) {
+        memcpy(b->tail->data + b->tail->len, v.ptr, first);
+        b->tail->len += first;
+    }
+    if (c != NULL) {
+        memcpy(c->data, v.ptr + first, v.len - first);
+        c->len = v.len - first;
+        link_chunk(b, c);
+    }
+
+    b->total += v.len;
+    return 0;
+}
+
+int hunter_builder_append_cstr(hunter_builder *b, const char *cstr)
+{
+    return hunter_builder_append(b, hunter_view_of(cstr));
+}
+
+/*
+ *  vsnprintf always writes a '\0', so it needs one byte more than the
+ *  text. Chunks don't store terminators: the '\0' lands in the byte
+ *  after the text, which is either free space or is overwritten by the
+ *  next append. A new chunk is sized n + 1 for the same reason.
+ */
+int hunter_builder_appendf(hunter_builder *b, const char *fmt, ...)
+{
+    va_list ap, again;
+    size_t free_bytes = room(b);
+    char scratch[1];
+    int n;
+
+    va_start(ap, fmt);
+    va_copy(again, ap);
+
+    n = (free_bytes > 0)
+        ? vsnprintf(b->tail->data + b->tail->len, free_bytes, fmt, ap)
+        : vsnprintf(scratch, sizeof(scratch), fmt, ap);
+    va_end(ap);
+
+    if (n > 0 && (size_t)n < free_bytes) {
+        b->tail->len += (size_t)n;                /* Fit (with its '\0') */
+    } else if (n > 0) {
+        hunter_chunk *c = new_chunk(b, (size_t)n + 1);
+
+        if (c == NULL) {
+            n = -1;
+        } else {
+            vsnprintf(c->data, (size_t)n + 1, fmt, again);
+            c->len = (size_t)n;
+            link_chunk(b, c);
+        }
+    }
+    va_end(again);
+
+    if (n < 0) {
+        return -1;
+    }
+    b->total += (size_t)n;
+    return 0;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Output
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+int hunter_builder_flatten(const hunter_builder *b, hunter_str *out)
+{
+    size_t at = hunter_str_len(out);
+
+    if (b->total > SIZE_MAX / 2 - at ||
+        hunter_str_reserve(out, at + b->total) != 0) {
+        return -1;
+    }
+
+    /* Capacity is final: each append below is a plain memcpy */
+    for (const hunter_chunk *c = b->head; c != NULL; c = c->next) {
+        hunter_view v = { c->data, c->len };
+        hunter_str_append(out, v);
+    }
+    return 0;
+}
+
+/*
+ *  writev takes an array of (pointer, length) pairs and writes them in
+ *  order with one system call. Up to IOV_BATCH chunks go per call; a
+ *  short write is resumed from the exact byte it stopped at.
+ */
+int hunter_builder_write(const hunter_builder *b, int fd)
+{
+    const hunter_chunk *c = b->head;
+    size_t skip = 0;            /* Bytes of c already written */
+
+    while (c != NULL) {
+        struct iovec iov[IOV_BATCH];
+        const hunter_chunk *p = c;
+        int count = 0;
+        ssize_t wrote;
+
+        for (; p != NULL && count < IOV_BATCH; p = p->next) {
+            iov[count].iov_base = (void *)(p->data + ((p == c) ? skip : 0));
+            iov[count].iov_len = p->len - ((p == c) ? skip : 0);
+            count++;
+        }
+
+        wrote = writev(fd, iov, count);
+        if (wrote < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+
+        /* Advance past what was written (maybe into the middle of a chunk) */
+        while (c != NULL && (size_t)wrote >= c->len - skip) {
+            wrote -= (ssize_t)(c->len - skip);
+            skip = 0;
+            c = c->next;
+        }
+        if (c != NULL) {
+            skip += (size_t)wrote;
+        }
+    }
+    return 0;
+}
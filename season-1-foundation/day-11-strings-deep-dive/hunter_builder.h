@@ -0,0 +1,137 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  hunter_builder.h — Building Big Text Without Moving It
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Write it down once. Never copy it again."
+ *
+ *  hunter_str makes appends O(appended bytes), but one contiguous buffer
+ *  still has to MOVE when it grows: a 10 MB report gets copied at 4 KB,
+ *  8 KB, ... 8 MB on the way. And nobody needs it contiguous if it's
+ *  just going to a file.
+ *
+ *  A hunter_builder is a linked list of chunks. Text fills the last one;
+ *  when it's full, a new (bigger) chunk is linked on. Nothing already
+ *  written ever moves.
+ *
+ *      head                                      tail
+ *       ↓                                         ↓
+ *      [ 4 KB full ] → [ 8 KB full ] → ... → [ 1 MB, part full ]
+ *
+ *      total = sum of lengths, kept as we go: O(1) to ask
+ *
+ *  At the end, either
+ *      hunter_builder_flatten  — one copy into a hunter_str, or
+ *      hunter_builder_write    — writev() the chunks to a file
+ *                                descriptor: zero copies
+ *
+ *  Error handling: 0 on success, -1 if memory ran out (the builder is
+ *  unchanged) or on a write error (errno is set).
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef HUNTER_BUILDER_H
+#define HUNTER_BUILDER_H
+
+#include <stddef.h>  /* size_t */
+
+#include "hunter_str.h"
+
+/* First chunk's capacity; each new chunk doubles, up to the max */
+#define HUNTER_BUILDER_FIRST_CHUNK  4096
+#define HUNTER_BUILDER_MAX_CHUNK    (1u << 20)
+
+/**
+ * hunter_chunk - One block of text (allocated with its data inline)
+ */
+typedef struct hunter_chunk {
+    struct hunter_chunk *next;
+    size_t len;
+    size_t cap;
+    char data[];
+} hunter_chunk;
+
+/**
+ * hunter_builder - Append-only text in chunks
+ *
+ * Initialize with hunter_builder_init (or = HUNTER_BUILDER_EMPTY),
+ * release with hunter_builder_free.
+ */
+typedef struct {
+    hunter_chunk *head;
+    hunter_chunk *tail;             /* Where appends go: no list walk */
+    size_t total;                   /* Bytes in all chunks */
+    size_t chunks;
+} hunter_builder;
+
+#define HUNTER_BUILDER_EMPTY { NULL, NULL, 0, 0 }
+
+/**
+ * hunter_builder_init - Empty builder (allocates nothing until used)
+ */
+void hunter_builder_init(hunter_builder *b);
+
+/**
+ * hunter_builder_free - Release every chunk; b is empty and reusable after
+ */
+void hunter_builder_free(hunter_builder *b);
+
+/**
+ * hunter_builder_len - Total bytes appended, O(1)
+ */
+static inline size_t hunter_builder_len(const hunter_builder *b)
+{
+    return b->total;
+}
+
+/**
+ * hunter_builder_append - Add bytes, amortized O(v.len)
+ *
+ * Fills the tail chunk, then links new ones. A piece may be split
+ * across chunks.
+ *
+ * @return: 0, or -1 if out of memory (nothing is appended)
+ */
+int hunter_builder_append(hunter_builder *b, hunter_view v);
+
+/**
+ * hunter_builder_append_cstr - hunter_builder_append(b, hunter_view_of(cstr))
+ */
+int hunter_builder_append_cstr(hunter_builder *b, const char *cstr);
+
+/**
+ * hunter_builder_appendf - Append printf-style output
+ *
+ * Formats into the tail chunk's free space. Output that doesn't fit
+ * goes whole into a new chunk (never split), so a chunk may end with
+ * some unused space.
+ *
+ * @return: 0, or -1 if out of memory or on a formatting error
+ */
+int hunter_builder_appendf(hunter_builder *b, const char *fmt, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+/**
+ * hunter_builder_flatten - Append everything to out, one copy per byte
+ *
+ * out is grown once, to its final size.
+ *
+ * @return: 0, or -1 if out of memory (out is unchanged)
+ */
+int hunter_builder_flatten(const hunter_builder *b, hunter_str *out);
+
+/**
+ * hunter_builder_write - Write everything to a file descriptor
+ *
+ * Uses writev: many chunks per system call, none copied. Short writes
+ * and EINTR are retried.
+ *
+ * @return: 0, or -1 on a write error (errno set; part may be written)
+ */
+int hunter_builder_write(const hunter_builder *b, int fd);
+
+#endif /* HUNTER_BUILDER_H */
@@ -0,0 +1,254 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  hunter_str.c — Length-Tracking String Implementation
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Count once. Remember forever."
+ *
+ *  Nothing in here looks for a '\0' in text it already owns. The only
+ *  scan is hunter_view_of, once per C string that comes in from
+ *  outside, and it uses the dispatched my_strlen.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hunter_str.h"
+#include "my_string.h"
+
+/* Writable text buffer (cap + 1 bytes) */
+static char *data(hunter_str *s)
+{
+    return (s->ptr != NULL) ? s->ptr : s->small;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Lifetime
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void hunter_str_init(hunter_str *s)
+{
+    s->ptr = NULL;
+    s->len = 0;
+    s->cap = HUNTER_STR_INLINE;
+    s->small[0] = '\0';
+}
+
+void hunter_str_free(hunter_str *s)
+{
+    free(s->ptr);
+    hunter_str_init(s);
+}
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  hunter_str_reserve — Grow Geometrically
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Growing to exactly what's needed would make n one-byte appends cost
+ *  n reallocations, each copying everything so far: O(n²) again.
+ *  Doubling means each byte is copied O(1) times on average.
+ *
+ *      cap:  23 (inline) → 46 → 92 → 184 → ...
+ */
+int hunter_str_reserve(hunter_str *s, size_t cap)
+{
+    size_t grown;
+    char *p;
+
+    if (cap <= s->cap) {
+        return 0;
+    }
+    if (cap >= SIZE_MAX / 2) {
+        return -1;                      /* cap + 1 and 2 * cap must fit */
+    }
+
+    grown = (s->cap * 2 > cap) ? s->cap * 2 : cap;
+
+    if (s->ptr == NULL) {
+        p = malloc(grown + 1);
+        if (p == NULL) {
+            return -1;
+        }
+        memcpy(p, s->small, s->len + 1);
+    } else {
+        p = realloc(s->ptr, grown + 1);
+        if (p == NULL) {
+            return -1;
+        }
+    }
+
+    s->ptr = p;
+    s->cap = grown;
+    return 0;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Views
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+hunter_view hunter_view_of(const char *cstr)
+{
+    hunter_view v = { cstr, my_strlen(cstr) };
+    return v;
+}
+
+hunter_view hunter_view_slice(hunter_view v, size_t start, size_t len)
+{
+    hunter_view out;
+
+    if (start > v.len) {
+        start = v.len;
+    }
+    if (len > v.len - start) {
+        len = v.len - start;
+    }
+
+    out.ptr = v.ptr + start;
+    out.len = len;
+    return out;
+}
+
+hunter_view hunter_str_slice(const hunter_str *s, size_t start, size_t len)
+{
+    return hunter_view_slice(hunter_str_view(s), start, len);
+}
+
+int hunter_view_cmp(hunter_view a, hunter_view b)
+{
+    size_t n = (a.len < b.len) ? a.len : b.len;
+    int c = (n > 0) ? memcmp(a.ptr, b.ptr, n) : 0;
+
+    if (c != 0) {
+        return c;
+    }
+    return (a.len > b.len) - (a.len < b.len);
+}
+
+int hunter_view_eq(hunter_view a, hunter_view b)
+{
+    return a.len == b.len && (a.len == 0 || memcmp(a.ptr, b.ptr, a.len) == 0);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Building
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void hunter_str_clear(hunter_str *s)
+{
+    s->len = 0;
+    data(s)[0] = '\0';
+}
+
+/*
+ *  v may be a slice of s itself. It is then no longer than s, so the
+ *  reserve doesn't move the buffer, but source and destination can
+ *  overlap: memmove, not memcpy.
+ */
+/*
+ *  A slice of s is never longer than s, so the reserve below can't move
+ *  the buffer under it, and memmove handles the overlap.
+ */
+int hunter_str_assign(hunter_str *s, hunter_view v)
+{
+    if (hunter_str_reserve(s, v.len) != 0) {
+        return -1;
+    }
+
+    if (v.len > 0) {
+        memmove(data(s), v.ptr, v.len);
+    }
+    s->len = v.len;
+    data(s)[s->len] = '\0';
+    return 0;
+}
+
+/*
+ *  The one subtle case: v is a slice of s itself. Growing s may move
+ *  its buffer (and moving off the inline buffer always does), leaving
+ *  v pointing at freed memory. So remember v as an offset into s,
+ *  grow, then rebuild the pointer.
+ */
+int hunter_str_append(hunter_str *s, hunter_view v)
+{
+    const char *old = data(s);
+    int inside = v.len > 0 && v.ptr >= old && v.ptr <= old + s->len;
+    size_t offset = inside ? (size_t)(v.ptr - old) : 0;
+
+    if (v.len > SIZE_MAX / 2 - s->len ||
+        hunter_str_reserve(s, s->len + v.len) != 0) {
+        return -1;
+    }
+    if (inside) {
+        v.ptr = data(s) + offset;
+    }
+
+    if (v.len > 0) {
+        memcpy(data(s) + s->len, v.ptr, v.len);
+    }
+    s->len += v.len;
+    data(s)[s->len] = '\0';
+    return 0;
+}
+
+int hunter_str_append_cstr(hunter_str *s, const char *cstr)
+{
+    return hunter_str_append(s, hunter_view_of(cstr));
+}
+
+int hunter_str_append_char(hunter_str *s, char c)
+{
+    if (s->len == s->cap && hunter_str_reserve(s, s->len + 1) != 0) {
+        return -1;
+    }
+
+    data(s)[s->len++] = c;
+    data(s)[s->len] = '\0';
+    return 0;
+}
+
+/*
+ *  vsnprintf tells us how long the output WOULD be even when it doesn't
+ *  fit, so the common case is one pass straight into spare capacity.
+ *  Only a too-small buffer costs a second pass (va_copy: a va_list can
+ *  be walked only once).
+ */
+int hunter_str_appendf(hunter_str *s, const char *fmt, ...)
+{
+    va_list ap, again;
+    int n;
+
+    va_start(ap, fmt);
+    va_copy(again, ap);
+
+    n = vsnprintf(data(s) + s->len, s->cap - s->len + 1, fmt, ap);
+    va_end(ap);
+
+    if (n >= 0 && (size_t)n > s->cap - s->len) {
+        if (hunter_str_reserve(s, s->len + (size_t)n) != 0) {
+            n = -1;
+        } else {
+            n = vsnprintf(data(s) + s->len, (size_t)n + 1, fmt, again);
+        }
+    }
+    va_end(again);
+
+    if (n < 0) {
+        data(s)[s->len] = '\0';         /* Undo any partial output */
+        return -1;
+    }
+
+    s->len += (size_t)n;
+    return 0;
+}
@@ -0,0 +1,209 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  hunter_str.h — Strings That Know Their Length
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Count once. Remember forever."
+ *
+ *  A C string only knows where it starts. Every my_strcat has to walk
+ *  dest to find its end, so appending n pieces costs
+ *
+ *      1 + 2 + 3 + ... + n   =   O(n²)
+ *
+ *  A hunter_str carries its length and capacity, so appending is a copy
+ *  of the new bytes and nothing else: O(total) for the whole loop.
+ *
+ *      hunter_str
+ *      ┌───────┬─────┬─────┬───────────────────────────┐
+ *      │ ptr   │ len │ cap │ small[24]  "Shadow Monarch\0"
+ *      └───┬───┴─────┴─────┴───────────────────────────┘
+ *          └─ NULL while the text fits in small (no malloc at all),
+ *             else a heap buffer of cap + 1 bytes
+ *
+ *  The text is always followed by '\0', so hunter_str_cstr() can hand it
+ *  to any C function without copying.
+ *
+ *  A hunter_view is a pointer and a length into someone else's bytes:
+ *  a substring without a copy. It is NOT '\0'-terminated.
+ *
+ *  my_string.h ↔ hunter_str:
+ *
+ *      my_strlen(s)          hunter_str_len(s)           O(1)
+ *      my_strcpy(d, s)       hunter_str_assign(d, v)     O(len(s))
+ *      my_strcat(d, s)       hunter_str_append(d, v)     O(len(s))
+ *      my_strcmp(a, b)       hunter_view_cmp(a, b)       memcmp, no '\0' scan
+ *      snprintf(d, ...)      hunter_str_appendf(d, ...)  grows to fit
+ *
+ *  Error handling: functions that may allocate return 0 on success and
+ *  -1 if memory ran out (or a size would overflow). The string is then
+ *  unchanged.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef HUNTER_STR_H
+#define HUNTER_STR_H
+
+#include <stddef.h>  /* size_t */
+
+/* Longest text kept inside the struct (without the '\0') */
+#define HUNTER_STR_INLINE 23
+
+/**
+ * hunter_str - Owned, growable, length-tracking string
+ *
+ * Initialize with hunter_str_init (or = HUNTER_STR_EMPTY), release with
+ * hunter_str_free. Don't copy one by assignment: two copies would share
+ * (and both free) one heap buffer.
+ */
+typedef struct {
+    char *ptr;                          /* Heap text, or NULL: text is in small */
+    size_t len;                         /* Bytes of text */
+    size_t cap;                         /* Text that fits without growing */
+    char small[HUNTER_STR_INLINE + 1];
+} hunter_str;
+
+#define HUNTER_STR_EMPTY { NULL, 0, HUNTER_STR_INLINE, { 0 } }
+
+/**
+ * hunter_view - Borrowed bytes: a substring without a copy
+ *
+ * Valid only while the bytes it points at are. A view into a hunter_str
+ * is invalidated by anything that may grow that string.
+ */
+typedef struct {
+    const char *ptr;
+    size_t len;
+} hunter_view;
+
+/* ──── Lifetime ──── */
+
+/**
+ * hunter_str_init - Make s the empty string (no allocation)
+ */
+void hunter_str_init(hunter_str *s);
+
+/**
+ * hunter_str_free - Release s's buffer; s is empty and reusable after
+ */
+void hunter_str_free(hunter_str *s);
+
+/**
+ * hunter_str_reserve - Make room for at least cap bytes of text
+ *
+ * Capacity grows at least geometrically (x2), so a loop of appends does
+ * O(log n) reallocations.
+ *
+ * @return: 0, or -1 if out of memory
+ */
+int hunter_str_reserve(hunter_str *s, size_t cap);
+
+/* ──── Access ──── */
+
+/**
+ * hunter_str_cstr - The text, '\0'-terminated
+ */
+static inline const char *hunter_str_cstr(const hunter_str *s)
+{
+    return (s->ptr != NULL) ? s->ptr : s->small;
+}
+
+/**
+ * hunter_str_len - Bytes of text, O(1)
+ */
+static inline size_t hunter_str_len(const hunter_str *s)
+{
+    return s->len;
+}
+
+/**
+ * hunter_str_view - All of s as a view
+ */
+static inline hunter_view hunter_str_view(const hunter_str *s)
+{
+    hunter_view v = { hunter_str_cstr(s), s->len };
+    return v;
+}
+
+/**
+ * hunter_str_slice - s[start, start + len) as a view, no copy
+ *
+ * Clamped to the text: a slice past the end is shorter (or empty).
+ */
+hunter_view hunter_str_slice(const hunter_str *s, size_t start, size_t len);
+
+/* ──── Views ──── */
+
+/**
+ * hunter_view_of - View of a C string (its one and only length scan)
+ */
+hunter_view hunter_view_of(const char *cstr);
+
+/**
+ * hunter_view_slice - v[start, start + len), clamped like hunter_str_slice
+ */
+hunter_view hunter_view_slice(hunter_view v, size_t start, size_t len);
+
+/**
+ * hunter_view_cmp - Compare like my_strcmp, but by length, not '\0'
+ *
+ * @return: < 0, 0 or > 0. A proper prefix sorts first ("ab" < "abc").
+ *          Bytes compare as unsigned char.
+ */
+int hunter_view_cmp(hunter_view a, hunter_view b);
+
+/**
+ * hunter_view_eq - Same bytes? (lengths checked first: O(1) when they differ)
+ */
+int hunter_view_eq(hunter_view a, hunter_view b);
+
+/* ──── Building ──── */
+
+/**
+ * hunter_str_clear - Length 0, capacity kept
+ */
+void hunter_str_clear(hunter_str *s);
+
+/**
+ * hunter_str_assign - Replace the text with v
+ *
+ * v may point into s itself (e.g. keeping a slice of s).
+ *
+ * @return: 0, or -1 if out of memory
+ */
+int hunter_str_assign(hunter_str *s, hunter_view v);
+
+/**
+ * hunter_str_append - Add v to the end, O(v.len) amortized
+ *
+ * v may point into s itself (e.g. appending a slice of s).
+ *
+ * @return: 0, or -1 if out of memory
+ */
+int hunter_str_append(hunter_str *s, hunter_view v);
+
+/**
+ * hunter_str_append_cstr - hunter_str_append(s, hunter_view_of(cstr))
+ */
+int hunter_str_append_cstr(hunter_str *s, const char *cstr);
+
+/**
+ * hunter_str_append_char - Add one byte
+ */
+int hunter_str_append_char(hunter_str *s, char c);
+
+/**
+ * hunter_str_appendf - Append printf-style output
+ *
+ * Formats straight into the spare capacity; only if that's too small
+ * does it grow and format again.
+ *
+ * @return: 0, or -1 if out of memory or on a formatting error
+ */
+int hunter_str_appendf(hunter_str *s, const char *fmt, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+#endif /* HUNTER_STR_H */
@@ -0,0 +1,484 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  my_matcher.c — Many Patterns, One Pass
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Read the scroll once. Find every name in it."
+ *
+ *  Highlighting 30 keywords with my_strstr means 30 passes over the
+ *  text. Aho-Corasick makes it one: all patterns go into one trie, and
+ *  the trie becomes a DFA that reads each text byte exactly once.
+ *
+ *      patterns: he, she, his, hers
+ *
+ *      (root) ─h→ (h) ─e→ (he)* ─r→ (her) ─s→ (hers)*
+ *         │        └─i→ (hi) ─s→ (his)*
+ *         └─s→ (s) ─h→ (sh) ─e→ (she)*
+ *
+ *  A state is "the longest pattern prefix the text currently ends
+ *  with". Where the trie has no edge, the DFA follows the FAILURE link
+ *  (the next-longest suffix that is still a prefix) ahead of time, so
+ *  scanning never backs up: one lookup per byte.
+ *
+ *  Two tricks keep that one lookup cheap:
+ *
+ *    BYTE CLASSES   Bytes that appear in no pattern all behave alike,
+ *                   and so does each pattern byte. The table has one
+ *                   column per class, not per byte value: 30 keywords
+ *                   need ~30 columns instead of 256, and the whole
+ *                   table stays in L1.
+ *
+ *    ROW OFFSETS    Transitions store the next state's row offset
+ *                   (state x classes), and states that end a match
+ *                   are numbered last. The hot loop is
+ *
+ *                       s = table[s + class[byte]];
+ *                       if (s >= first_match) ...
+ *
+ *                   one add and one load per byte: the load's latency
+ *                   IS the scan speed, so nothing else may sit on
+ *                   that chain.
+ *
+ *  And for small pattern sets, Teddy (from Hyperscan) skips text where
+ *  no pattern can START, 16 positions per step. It only runs while the
+ *  DFA is back at the root, so the matches are exactly the DFA's.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "my_string.h"
+
+#if MY_STRING_X86
+#include <immintrin.h>
+#endif
+
+#define NONE UINT32_MAX
+
+/* Teddy: up to this many patterns, in 8 buckets, fingerprinted on 3 bytes */
+#define TEDDY_MAX_PATTERNS  32
+#define TEDDY_BUCKETS       8
+#define TEDDY_BYTES         3
+
+struct my_matcher {
+    uint32_t *delta;            /* [state x class]: next state's row offset */
+    uint32_t first_match;       /* Row offset of the first state that ends a match */
+    uint32_t *pattern;          /* Per state: pattern ending exactly here, or NONE */
+    uint32_t *out;              /* Per state: first state on its suffix chain with a pattern */
+    uint32_t *dict;             /* Per state: next such state after it */
+    size_t *lengths;            /* Per pattern */
+    size_t count;
+    size_t classes;
+    size_t states;
+    unsigned char cls[256];     /* Byte → class (0: in no pattern) */
+
+    int teddy;                  /* Prefilter on? */
+    size_t teddy_k;             /* Bytes fingerprinted: min(3, shortest pattern) */
+    unsigned char teddy_lo[TEDDY_BYTES][16];    /* Low nibble → buckets */
+    unsigned char teddy_hi[TEDDY_BYTES][16];    /* High nibble → buckets */
+};
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Teddy — Where Could a Pattern Start?
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Each pattern goes in one of 8 buckets (one bit of a byte). For the
+ *  first k bytes of the patterns, two 16-entry tables map a nibble to
+ *  the buckets that have that nibble there:
+ *
+ *      "CUDA", bucket 3:   lo[0]['C' & 15] |= 1 << 3,  hi[0]['C' >> 4] |= 1 << 3
+ *                          lo[1]['U' & 15] |= 1 << 3,  ...
+ *
+ *  pshufb looks up 16 nibbles in a 16-entry table at once. So for 16
+ *  text positions:
+ *
+ *      buckets = AND over j < k of  lo[j][text[i+j] & 15] & hi[j][text[i+j] >> 4]
+ *
+ *  A nonzero byte means some pattern's first k bytes MAY start there
+ *  (nibbles can alias, and so can patterns sharing a bucket); zero
+ *  means none can. Zero for all 16: skip.
+ */
+static void teddy_build(my_matcher *mm, const char *const *patterns, size_t shortest)
+{
+#if MY_STRING_X86
+    size_t order[TEDDY_MAX_PATTERNS];
+
+    __builtin_cpu_init();
+    if (mm->count > TEDDY_MAX_PATTERNS || !__builtin_cpu_supports("ssse3")) {
+        return;
+    }
+
+    /* Sorted order, cut into 8 runs: patterns sharing a prefix share a bucket */
+    for (size_t r = 0; r < mm->count; r++) {
+        size_t at = r;
+
+        for (; at > 0 && my_strcmp(patterns[order[at - 1]], patterns[r]) > 0; at--) {
+            order[at] = order[at - 1];
+        }
+        order[at] = r;
+    }
+
+    mm->teddy_k = (shortest < TEDDY_BYTES) ? shortest : TEDDY_BYTES;
+    for (size_t r = 0; r < mm->count; r++) {
+        size_t p = order[r];
+        unsigned char bit = (unsigned char)(1u << (r * TEDDY_BUCKETS / mm->count));
+
+        for (size_t j = 0; j < mm->teddy_k; j++) {
+            unsigned char b = (unsigned char)patterns[p][j];
+
+            mm->teddy_lo[j][b & 15] |= bit;
+            mm->teddy_hi[j][b >> 4] |= bit;
+        }
+    }
+    mm->teddy = 1;
+#else
+    (void)mm;
+    (void)patterns;
+    (void)shortest;
+#endif
+}
+
+#if MY_STRING_X86
+/* First position >= i where a pattern may start; len if there's none */
+__attribute__((target("ssse3")))
+static size_t teddy_next(const my_matcher *mm, const unsigned char *t, size_t i, size_t len)
+{
+    const size_t k = mm->teddy_k;
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo[TEDDY_BYTES], hi[TEDDY_BYTES];
+
+    for (size_t j = 0; j < k; j++) {
+        lo[j] = _mm_loadu_si128((const __m128i *)(const void *)mm->teddy_lo[j]);
+        hi[j] = _mm_loadu_si128((const __m128i *)(const void *)mm->teddy_hi[j]);
+    }
+
+    /* Loads end at t + i + k - 1 + 16: always inside the text */
+    while (len - i >= k - 1 + 16) {
+        __m128i buckets = _mm_set1_epi8(-1);
+        unsigned mask;
+
+        for (size_t j = 0; j < k; j++) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(t + i + j));
+            __m128i l = _mm_shuffle_epi8(lo[j], _mm_and_si128(v, nibble));
+            __m128i h = _mm_shuffle_epi8(hi[j], _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+
+            buckets = _mm_and_si128(buckets, _mm_and_si128(l, h));
+        }
+
+        mask = ~(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(buckets, zero)) & 0xFFFFu;
+        if (mask != 0) {
+            return i + (unsigned)__builtin_ctz(mask);
+        }
+        i += 16;
+    }
+
+    /* The last few positions: same tables, one at a time */
+    for (; len - i >= k; i++) {
+        unsigned bits = 0xFF;
+
+        for (size_t j = 0; j < k; j++) {
+            unsigned char b = t[i + j];
+            bits &= (unsigned)(mm->teddy_lo[j][b & 15] & mm->teddy_hi[j][b >> 4]);
+        }
+        if (bits != 0) {
+            return i;
+        }
+    }
+    return len;
+}
+#endif
+
+
+/*
+ * renumber — States without matches first, then those with; delta
+ * becomes row offsets. The root has no match, so it stays state 0.
+ * id and old are scratch arrays of mm->states entries.
+ */
+static int renumber(my_matcher *mm, uint32_t *id, uint32_t *old)
+{
+    size_t classes = mm->classes, states = mm->states;
+    uint32_t *delta = malloc(states * classes * sizeof(uint32_t));
+    uint32_t next = 0;
+
+    if (delta == NULL) {
+        return -1;
+    }
+
+    for (size_t s = 0; s < states; s++) {
+        mm->out[s] = (mm->pattern[s] != NONE) ? (uint32_t)s : mm->dict[s];
+    }
+    for (int matching = 0; matching <= 1; matching++) {
+        if (matching) {
+            mm->first_match = (uint32_t)(next * classes);
+        }
+        for (size_t s = 0; s < states; s++) {
+            if ((mm->out[s] != NONE) == matching) {
+                old[next] = (uint32_t)s;
+                id[s] = next++;
+            }
+        }
+    }
+
+    for (size_t s = 0; s < states; s++) {
+        for (size_t c = 0; c < classes; c++) {
+            delta[id[s] * classes + c] = (uint32_t)(id[mm->delta[s * classes + c]] * classes);
+        }
+    }
+    free(mm->delta);
+    mm->delta = delta;
+
+    /* Per-state arrays: move entries, and map the state ids they hold */
+#define PERMUTE(arr) do { \
+        for (size_t s = 0; s < states; s++) { \
+            delta[s] = (arr)[old[s]]; \
+        } \
+        memcpy((arr), delta, states * sizeof(uint32_t)); \
+    } while (0)
+
+    delta = malloc(states * sizeof(uint32_t));
+    if (delta == NULL) {
+        return -1;
+    }
+    PERMUTE(mm->pattern);
+    PERMUTE(mm->out);
+    PERMUTE(mm->dict);
+#undef PERMUTE
+    free(delta);
+
+    for (size_t s = 0; s < states; s++) {
+        mm->out[s] = (mm->out[s] != NONE) ? id[mm->out[s]] : NONE;
+        mm->dict[s] = (mm->dict[s] != NONE) ? id[mm->dict[s]] : NONE;
+    }
+    return 0;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_matcher_new — Trie, Failure Links, DFA
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  1. Insert every pattern into a trie (state numbers, class columns).
+ *  2. Breadth-first, fill every missing edge with the edge its failure
+ *     state takes on the same class. Shallower states are finished
+ *     first, so that edge is always ready.
+ *  3. Renumber: states with matches last. Store row offsets.
+ *
+ *  A state's matches: its own pattern (if any), then along "dict" links
+ *  the patterns that are suffixes of it: "she" also ends "he".
+ */
+my_matcher *my_matcher_new(const char *const *patterns, size_t count)
+{
+    my_matcher *mm;
+    uint32_t *fail = NULL, *queue = NULL;
+    size_t total = 0, shortest = SIZE_MAX, max_states, classes = 1;
+    size_t head = 0, tail = 0;
+
+    if (count == 0 || count >= NONE) {
+        return NULL;
+    }
+    for (size_t p = 0; p < count; p++) {
+        size_t len = my_strlen(patterns[p]);
+
+        if (len == 0 || len > SIZE_MAX - 1 - total) {
+            return NULL;
+        }
+        total += len;
+        shortest = (len < shortest) ? len : shortest;
+    }
+
+    mm = calloc(1, sizeof(*mm));
+    if (mm == NULL) {
+        return NULL;
+    }
+    mm->count = count;
+
+    for (size_t p = 0; p < count; p++) {
+        for (const unsigned char *b = (const unsigned char *)patterns[p]; *b != '\0'; b++) {
+            if (mm->cls[*b] == 0) {
+                mm->cls[*b] = (unsigned char)classes++;
+            }
+        }
+    }
+    mm->classes = classes;
+
+    /* Row offsets must fit in 32 bits */
+    max_states = total + 1;
+    if (max_states > NONE / classes) {
+        goto fail_out;
+    }
+
+    mm->delta = malloc(max_states * classes * sizeof(uint32_t));
+    mm->pattern = malloc(max_states * sizeof(uint32_t));
+    mm->out = malloc(max_states * sizeof(uint32_t));
+    mm->dict = malloc(max_states * sizeof(uint32_t));
+    mm->lengths = malloc(count * sizeof(size_t));
+    fail = malloc(max_states * sizeof(uint32_t));
+    queue = malloc(max_states * sizeof(uint32_t));
+    if (mm->delta == NULL || mm->pattern == NULL || mm->out == NULL ||
+        mm->dict == NULL || mm->lengths == NULL || fail == NULL || queue == NULL) {
+        goto fail_out;
+    }
+    memset(mm->delta, 0xFF, max_states * classes * sizeof(uint32_t));      /* NONE */
+    memset(mm->pattern, 0xFF, max_states * sizeof(uint32_t));
+
+    /* 1. Trie */
+    mm->states = 1;
+    for (size_t p = 0; p < count; p++) {
+        const unsigned char *b = (const unsigned char *)patterns[p];
+        uint32_t u = 0;
+
+        for (; *b != '\0'; b++) {
+            uint32_t *edge = &mm->delta[u * classes + mm->cls[*b]];
+
+            if (*edge == NONE) {
+                *edge = (uint32_t)mm->states++;
+            }
+            u = *edge;
+        }
+        if (mm->pattern[u] == NONE) {
+            mm->pattern[u] = (uint32_t)p;
+        }
+        mm->lengths[p] = (size_t)(b - (const unsigned char *)patterns[p]);
+    }
+
+    /* 2. Failure links and the missing edges, breadth-first */
+    fail[0] = 0;
+    mm->dict[0] = NONE;
+    for (size_t c = 0; c < classes; c++) {
+        uint32_t v = mm->delta[c];
+
+        if (v == NONE) {
+            mm->delta[c] = 0;                   /* No pattern starts so: stay */
+        } else {
+            fail[v] = 0;
+            queue[tail++] = v;
+        }
+    }
+    while (head < tail) {
+        uint32_t u = queue[head++];
+        uint32_t f = fail[u];
+
+        mm->dict[u] = (mm->pattern[f] != NONE) ? f : mm->dict[f];
+        for (size_t c = 0; c < classes; c++) {
+            uint32_t *edge = &mm->delta[u * classes + c];
+            uint32_t via_fail = mm->delta[f * classes + c];
+
+            if (*edge == NONE) {
+                *edge = via_fail;
+            } else {
+                fail[*edge] = via_fail;
+                queue[tail++] = *edge;
+            }
+        }
+    }
+
+    /* 3. Renumber (fail and queue are free for reuse now) */
+    if (renumber(mm, fail, queue) != 0) {
+        goto fail_out;
+    }
+
+    free(fail);
+    free(queue);
+    teddy_build(mm, patterns, shortest);
+    return mm;
+
+fail_out:
+    free(fail);
+    free(queue);
+    my_matcher_free(mm);
+    return NULL;
+}
+
+void my_matcher_free(my_matcher *mm)
+{
+    if (mm == NULL) {
+        return;
+    }
+    free(mm->delta);
+    free(mm->pattern);
+    free(mm->out);
+    free(mm->dict);
+    free(mm->lengths);
+    free(mm);
+}
+
+int my_matcher_prefiltered(const my_matcher *mm)
+{
+    return mm->teddy;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Scanning
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  s == 0 is the root with no match pending: the only state from which
+ *  skipping ahead to the next Teddy candidate loses nothing (no
+ *  partial match is in progress).
+ */
+
+/* Report every pattern ending at text[end] in state s; 1 if fn said stop */
+static int report(const my_matcher *mm, uint32_t s, size_t end,
+                  my_match_fn fn, void *ctx, size_t *found)
+{
+    for (uint32_t t = mm->out[s / mm->classes]; t != NONE; t = mm->dict[t]) {
+        size_t p = mm->pattern[t];
+
+        ++*found;
+        if (fn != NULL && fn(end + 1 - mm->lengths[p], p, ctx) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static inline size_t scan(const my_matcher *mm, const unsigned char *t, size_t len,
+                          my_match_fn fn, void *ctx, int prefilter)
+{
+    const uint32_t *delta = mm->delta;
+    const unsigned char *cls = mm->cls;
+    const uint32_t first_match = mm->first_match;
+    uint32_t s = 0;
+    size_t found = 0;
+
+    for (size_t i = 0; i < len; i++) {
+#if MY_STRING_X86
+        if (prefilter && s == 0) {
+            i = teddy_next(mm, t, i, len);
+            if (i == len) {
+                break;
+            }
+        }
+#else
+        (void)prefilter;
+#endif
+        s = delta[s + cls[t[i]]];
+        if (s >= first_match && report(mm, s, i, fn, ctx, &found)) {
+            break;
+        }
+    }
+    return found;
+}
+
+size_t my_matcher_scan(const my_matcher *mm, const char *text, size_t len,
+                       my_match_fn fn, void *ctx)
+{
+    if (mm->teddy) {
+        return scan(mm, (const unsigned char *)text, len, fn, ctx, 1);
+    }
+    return scan(mm, (const unsigned char *)text, len, fn, ctx, 0);
+}
+
+size_t my_matcher_scan_dfa(const my_matcher *mm, const char *text, size_t len,
+                           my_match_fn fn, void *ctx)
+{
+    return scan(mm, (const unsigned char *)text, len, fn, ctx, 0);
+}
@@ -27,8 +27,12 @@
  *           len=0  len=1  len=2  len=3  len=4   STOP!
  *
  *  Return: 5
+ *
+ *  This is my_strlen_ref: the reference every faster variant is tested
+ *  against. my_strlen itself dispatches to the fastest variant
+ *  (my_string_simd.c).
  */
-size_t my_strlen(const char *s)
+size_t my_strlen_ref(const char *s)
 {
     size_t len = 0;
     
@@ -57,6 +61,22 @@ size_t my_strlen(const char *s)
  * }
  */
 
+/*
+ *  my_strnlen — the same walk with a second reason to stop: maxlen.
+ *  s doesn't even need a '\0' if it has maxlen bytes.
+ *
+ *  This is my_strnlen_ref; my_strnlen dispatches (my_string_simd.c).
+ */
+size_t my_strnlen_ref(const char *s, size_t maxlen)
+{
+    size_t len = 0;
+
+    while (len < maxlen && s[len] != '\0') {
+        len++;
+    }
+    return len;
+}
+
 
 /*
  * ──────────────────────────────────────────────────────────────────────────
@@ -85,8 +105,10 @@ size_t my_strlen(const char *s)
  *  The 'restrict' keyword tells the compiler that dest and src
  *  don't overlap, enabling optimizations. If they DO overlap,
  *  behavior is undefined.
+ *
+ *  This is my_strcpy_ref; my_strcpy dispatches (my_string_simd.c).
  */
-char *my_strcpy(char * restrict dest, const char * restrict src)
+char *my_strcpy_ref(char * restrict dest, const char * restrict src)
 {
     size_t i = 0;
     
@@ -126,8 +148,10 @@ char *my_strcpy(char * restrict dest, const char * restrict src)
  *
  *      src = "Hello"
  *      dest = [ 'H' ][ 'e' ][ 'l' ][ 'l' ]   ← NO null terminator!
+ *
+ *  This is my_strncpy_ref; my_strncpy dispatches (my_string_simd.c).
  */
-char *my_strncpy(char * restrict dest, const char * restrict src, size_t n)
+char *my_strncpy_ref(char * restrict dest, const char * restrict src, size_t n)
 {
     size_t i;
     
@@ -144,6 +168,28 @@ char *my_strncpy(char * restrict dest, const char * restrict src, size_t n)
     return dest;
 }
 
+/*
+ *  my_strncpy_len — Phase 1 of my_strncpy plus ONE '\0' instead of the
+ *  padding, and the count of bytes copied instead of dest:
+ *
+ *      n=4, src="Hi":     [ 'H' ][ 'i' ][ '\0' ][ ?? ]   → 2
+ *      n=4, src="Hello":  [ 'H' ][ 'e' ][ 'l' ][ 'l' ]   → 4 (no '\0')
+ *
+ *  This is my_strncpy_len_ref; my_strncpy_len dispatches.
+ */
+size_t my_strncpy_len_ref(char * restrict dest, const char * restrict src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n && src[i] != '\0'; i++) {
+        dest[i] = src[i];
+    }
+    if (i < n) {
+        dest[i] = '\0';
+    }
+    return i;
+}
+
 
 /*
  * ──────────────────────────────────────────────────────────────────────────
@@ -176,8 +222,10 @@ char *my_strncpy(char * restrict dest, const char * restrict src, size_t n)
  *      'a' == 'a' → continue
  *      'b' == 'b' → continue
  *      'c' vs '\0' → 'c' (99) - '\0' (0) = 99 → s1 > s2
+ *
+ *  This is my_strcmp_ref; my_strcmp dispatches (my_string_simd.c).
  */
-int my_strcmp(const char *s1, const char *s2)
+int my_strcmp_ref(const char *s1, const char *s2)
 {
     /* Walk both strings in lockstep */
     while (*s1 != '\0' && *s1 == *s2) {
@@ -203,8 +251,10 @@ int my_strcmp(const char *s1, const char *s2)
  * ──────────────────────────────────────────────────────────────────────────
  *
  *  Same as strcmp, but stop after n characters.
+ *
+ *  This is my_strncmp_ref; my_strncmp dispatches (my_string_simd.c).
  */
-int my_strncmp(const char *s1, const char *s2, size_t n)
+int my_strncmp_ref(const char *s1, const char *s2, size_t n)
 {
     if (n == 0) {
         return 0;  /* Nothing to compare */
@@ -242,8 +292,10 @@ int my_strncmp(const char *s1, const char *s2, size_t n)
  *      dest → [ 'H' ][ 'i' ][ '!' ][ '!' ][ '\0' ][ ? ]
  *
  *  DANGER: If dest doesn't have enough space, we overflow!
+ *
+ *  This is my_strcat_ref; my_strcat dispatches (my_string_simd.c).
  */
-char *my_strcat(char * restrict dest, const char * restrict src)
+char *my_strcat_ref(char * restrict dest, const char * restrict src)
 {
     /* Find the end of dest */
     char *end = dest;
@@ -259,3 +311,81 @@ char *my_strcat(char * restrict dest, const char * restrict src)
     
     return dest;
 }
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strstr — The Seeker
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Algorithm (spoken aloud):
+ *  "For each position in haystack, try to match needle. If every needle
+ *   byte matches, that's the answer. If not, try the next position."
+ *
+ *  Memory visualization (needle "wor"):
+ *
+ *      haystack → [ 'h' ][ 'e' ][ 'l' ][ 'l' ][ 'o' ][ ' ' ][ 'w' ][ 'o' ][ 'r' ]...
+ *      start=0      w?✗
+ *      start=6                                             w ✓   o ✓   r ✓  FOUND
+ *
+ *  O(n·m) in the worst case: "aaaa...a" searched for "aaab" matches
+ *  m - 1 bytes at every start before failing. This is my_strstr_ref;
+ *  my_strstr is linear (my_strstr.c).
+ */
+char *my_strstr_ref(const char *haystack, const char *needle)
+{
+    if (*needle == '\0') {
+        return (char *)haystack;            /* Empty needle: match at start */
+    }
+
+    for (; *haystack != '\0'; haystack++) {
+        size_t i = 0;
+
+        while (needle[i] != '\0' && haystack[i] == needle[i]) {
+            i++;
+        }
+        if (needle[i] == '\0') {
+            return (char *)haystack;
+        }
+        if (haystack[i] == '\0') {
+            return NULL;                    /* Rest of haystack is too short */
+        }
+    }
+    return NULL;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strrev — The Mirror
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Algorithm (spoken aloud):
+ *  "Find the last byte. Swap it with the first. Step both inward until
+ *   they meet."
+ *
+ *  Memory visualization:
+ *
+ *      [ 'A' ][ 'r' ][ 'i' ][ 's' ][ 'e' ][ '\0' ]
+ *       lo ↔                        hi
+ *            lo ↔          hi
+ *                  lo=hi: STOP      →  "esirA"
+ *
+ *  This is my_strrev_ref; my_strrev dispatches (my_string_simd.c).
+ */
+char *my_strrev_ref(char *s)
+{
+    char *lo = s;
+    char *hi = s + my_strlen_ref(s);
+
+    if (hi == lo) {
+        return s;                       /* Empty: nothing to swap */
+    }
+
+    for (hi--; lo < hi; lo++, hi--) {
+        char tmp = *lo;
+        *lo = *hi;
+        *hi = tmp;
+    }
+    return s;
+}
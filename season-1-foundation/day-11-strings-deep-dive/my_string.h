@@ -19,6 +19,18 @@
 
 #include <stddef.h>  /* size_t */
 
+/*
+ * MY_STRING_X86 - 1 when the SSE2/AVX2 fast paths are compiled in
+ *
+ * They need x86 intrinsics and GCC/Clang's target attribute and CPU
+ * detection builtins. Elsewhere only the portable variants exist.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && defined(__GNUC__)
+#define MY_STRING_X86 1
+#else
+#define MY_STRING_X86 0
+#endif
+
 /**
  * my_strlen - Calculate the length of a null-terminated string
  *
@@ -34,6 +46,90 @@
  */
 size_t my_strlen(const char *s);
 
+/**
+ * my_strlen_ref, my_strlen_swar, my_strlen_sse2, my_strlen_avx2
+ *   - The implementations behind my_strlen
+ *
+ * ref:   one byte per step (the algorithm above, kept as the reference)
+ * swar:  8 bytes per step in a uint64_t ("SIMD Within A Register")
+ * sse2:  16 bytes per step, pcmpeqb + pmovmskb
+ * avx2:  32 bytes per step, vpcmpeqb + vpmovmskb
+ *
+ * my_strlen calls the fastest one the CPU supports (checked once, on the
+ * first call). All of them have the same contract as my_strlen.
+ *
+ * Reading ahead is safe only within the page that holds the terminator:
+ * the wide variants read whole ALIGNED 8/16/32-byte blocks, and an
+ * aligned block never straddles a page boundary (4096 is a multiple of
+ * 32), so they never touch a page the string doesn't reach.
+ */
+size_t my_strlen_ref(const char *s);
+size_t my_strlen_swar(const char *s);
+#if MY_STRING_X86
+size_t my_strlen_sse2(const char *s);
+size_t my_strlen_avx2(const char *s);
+#endif
+
+/**
+ * my_strlen_impl - One my_strlen implementation, for tests and benchmarks
+ */
+typedef struct {
+    const char *name;
+    size_t (*fn)(const char *s);
+} my_strlen_impl;
+
+/**
+ * my_strlen_impls - The implementations this CPU can run
+ *
+ * @param out: Receives a pointer to the table (reference first)
+ *
+ * @return: Number of entries
+ */
+size_t my_strlen_impls(const my_strlen_impl **out);
+
+/**
+ * my_strlen_selected - Name of the implementation my_strlen dispatches to
+ */
+const char *my_strlen_selected(void);
+
+/**
+ * my_strnlen - Length of a string, looking at no more than maxlen bytes
+ *
+ * @param s:      String, or an array of at least maxlen bytes
+ * @param maxlen: Most bytes to examine
+ *
+ * @return: my_strlen(s) if that is below maxlen, else maxlen
+ *
+ * Precondition:  s is readable up to its '\0' or maxlen bytes,
+ *                whichever comes first
+ *
+ * Time:  O(min(n, maxlen))
+ * Space: O(1)
+ */
+size_t my_strnlen(const char *s, size_t maxlen);
+
+/**
+ * my_strnlen_ref, my_strnlen_swar, my_strnlen_sse2, my_strnlen_avx2
+ *   - The implementations behind my_strnlen
+ *
+ * The my_strlen loops with one more exit: a block that starts at or
+ * past maxlen is never loaded. The last block may extend past maxlen,
+ * but it is aligned, so it stays in the page of a byte we may read.
+ */
+size_t my_strnlen_ref(const char *s, size_t maxlen);
+size_t my_strnlen_swar(const char *s, size_t maxlen);
+#if MY_STRING_X86
+size_t my_strnlen_sse2(const char *s, size_t maxlen);
+size_t my_strnlen_avx2(const char *s, size_t maxlen);
+#endif
+
+typedef struct {
+    const char *name;
+    size_t (*fn)(const char *s, size_t maxlen);
+} my_strnlen_impl;
+
+size_t my_strnlen_impls(const my_strnlen_impl **out);
+
 /**
  * my_strcpy - Copy a string including the null terminator
  *
@@ -55,6 +151,23 @@ size_t my_strlen(const char *s);
  */
 char *my_strcpy(char * restrict dest, const char * restrict src);
 
+/**
+ * my_strcpy_ref, my_strcpy_swar, my_strcpy_sse2, my_strcpy_avx2
+ *   - The implementations behind my_strcpy
+ *
+ * The wide ones find '\0' and copy in the same pass: each block of src
+ * is loaded once, and stored whole to dest if it holds no '\0'. The
+ * last block is copied as one store that ends exactly on the '\0',
+ * overlapping bytes already written, so dest is never written past
+ * the terminator. src is read under the same page rule as my_strlen.
+ */
+char *my_strcpy_ref(char * restrict dest, const char * restrict src);
+char *my_strcpy_swar(char * restrict dest, const char * restrict src);
+#if MY_STRING_X86
+char *my_strcpy_sse2(char * restrict dest, const char * restrict src);
+char *my_strcpy_avx2(char * restrict dest, const char * restrict src);
+#endif
+
 /**
  * my_strncpy - Copy at most n characters from src to dest
  *
@@ -76,6 +189,20 @@ char *my_strcpy(char * restrict dest, const char * restrict src);
  */
 char *my_strncpy(char * restrict dest, const char * restrict src, size_t n);
 
+/**
+ * my_strncpy_ref, my_strncpy_swar, my_strncpy_sse2, my_strncpy_avx2
+ *   - The implementations behind my_strncpy
+ *
+ * The my_strcpy copy, stopping after n bytes, then memset for the
+ * padding. src may be an array of n bytes with no '\0'.
+ */
+char *my_strncpy_ref(char * restrict dest, const char * restrict src, size_t n);
+char *my_strncpy_swar(char * restrict dest, const char * restrict src, size_t n);
+#if MY_STRING_X86
+char *my_strncpy_sse2(char * restrict dest, const char * restrict src, size_t n);
+char *my_strncpy_avx2(char * restrict dest, const char * restrict src, size_t n);
+#endif
+
 /**
  * my_strcmp - Compare two strings lexicographically
  *
@@ -97,6 +224,28 @@ char *my_strncpy(char * restrict dest, const char * restrict src, size_t n);
  */
 int my_strcmp(const char *s1, const char *s2);
 
+/**
+ * my_strcmp_ref, my_strcmp_swar, my_strcmp_sse2, my_strcmp_avx2
+ *   - The implementations behind my_strcmp
+ *
+ * The wide ones compare 8/16/32 bytes at once and build one mask of
+ * "bytes differ OR s1 has '\0' here"; the lowest set bit is where the
+ * byte loop would have stopped. They return the same value as the
+ * reference: the difference of the first differing bytes, as unsigned
+ * char.
+ *
+ * s1 and s2 usually have different alignments, so blocks can't be
+ * aligned for both. Instead a block is read only if it doesn't cross a
+ * 4096-byte boundary in either string; near one, they step a byte at a
+ * time until past it.
+ */
+int my_strcmp_ref(const char *s1, const char *s2);
+int my_strcmp_swar(const char *s1, const char *s2);
+#if MY_STRING_X86
+int my_strcmp_sse2(const char *s1, const char *s2);
+int my_strcmp_avx2(const char *s1, const char *s2);
+#endif
+
 /**
  * my_strncmp - Compare at most n characters of two strings
  *
@@ -111,6 +260,40 @@ int my_strcmp(const char *s1, const char *s2);
  */
 int my_strncmp(const char *s1, const char *s2, size_t n);
 
+/**
+ * my_strncmp_ref, my_strncmp_swar, my_strncmp_sse2, my_strncmp_avx2
+ *   - The implementations behind my_strncmp
+ *
+ * Same approach as the my_strcmp variants; bytes at or past n are
+ * masked out of the last block. s1 and s2 may be arrays of n bytes
+ * with no '\0': block reads past n stay inside the page, so they
+ * can't fault.
+ */
+int my_strncmp_ref(const char *s1, const char *s2, size_t n);
+int my_strncmp_swar(const char *s1, const char *s2, size_t n);
+#if MY_STRING_X86
+int my_strncmp_sse2(const char *s1, const char *s2, size_t n);
+int my_strncmp_avx2(const char *s1, const char *s2, size_t n);
+#endif
+
+/**
+ * my_strcmp_impl, my_strncmp_impl - Implementation tables
+ *
+ * Same idea as my_strlen_impls: reference first, fastest usable last.
+ */
+typedef struct {
+    const char *name;
+    int (*fn)(const char *s1, const char *s2);
+} my_strcmp_impl;
+
+typedef struct {
+    const char *name;
+    int (*fn)(const char *s1, const char *s2, size_t n);
+} my_strncmp_impl;
+
+size_t my_strcmp_impls(const my_strcmp_impl **out);
+size_t my_strncmp_impls(const my_strncmp_impl **out);
+
 /**
  * my_strcat - Concatenate src onto the end of dest
  *
@@ -130,4 +313,275 @@ int my_strncmp(const char *s1, const char *s2, size_t n);
  */
 char *my_strcat(char * restrict dest, const char * restrict src);
 
+/**
+ * my_strcat_ref, my_strcat_swar, my_strcat_sse2, my_strcat_avx2
+ *   - The implementations behind my_strcat
+ *
+ * Wide my_strlen to find the end of dest, then the my_strcpy copy.
+ */
+char *my_strcat_ref(char * restrict dest, const char * restrict src);
+char *my_strcat_swar(char * restrict dest, const char * restrict src);
+#if MY_STRING_X86
+char *my_strcat_sse2(char * restrict dest, const char * restrict src);
+char *my_strcat_avx2(char * restrict dest, const char * restrict src);
+#endif
+
+/**
+ * my_strcpy_impl, my_strncpy_impl - Implementation tables
+ *
+ * my_strcat_impls uses my_strcpy_impl too (same signature).
+ */
+typedef struct {
+    const char *name;
+    char *(*fn)(char * restrict dest, const char * restrict src);
+} my_strcpy_impl;
+
+typedef struct {
+    const char *name;
+    char *(*fn)(char * restrict dest, const char * restrict src, size_t n);
+} my_strncpy_impl;
+
+size_t my_strcpy_impls(const my_strcpy_impl **out);
+size_t my_strncpy_impls(const my_strncpy_impl **out);
+size_t my_strcat_impls(const my_strcpy_impl **out);
+
+/**
+ * my_strncpy_len - my_strncpy without the padding, returning the length
+ *
+ * @param dest: Destination buffer (at least n bytes)
+ * @param src:  Source string, or an array of at least n bytes
+ * @param n:    Maximum bytes to write
+ *
+ * @return: Bytes copied before '\0': strlen(src) if below n, else n
+ *
+ * Postcondition: If the return value is below n, dest[return] is '\0'
+ *                Nothing past that '\0' (or past n) is written
+ *
+ * The building block for bounded copies: one pass over src, and the
+ * caller learns where it stopped without scanning again.
+ *
+ * Time:  O(min(n, strlen(src)))
+ * Space: O(1)
+ */
+size_t my_strncpy_len(char * restrict dest, const char * restrict src, size_t n);
+
+/**
+ * my_strncpy_len_ref, my_strncpy_len_swar, my_strncpy_len_sse2,
+ * my_strncpy_len_avx2 - The implementations behind my_strncpy_len
+ *
+ * The wide ones are the my_strncpy copy itself, minus the memset.
+ */
+size_t my_strncpy_len_ref(char * restrict dest, const char * restrict src, size_t n);
+size_t my_strncpy_len_swar(char * restrict dest, const char * restrict src, size_t n);
+#if MY_STRING_X86
+size_t my_strncpy_len_sse2(char * restrict dest, const char * restrict src, size_t n);
+size_t my_strncpy_len_avx2(char * restrict dest, const char * restrict src, size_t n);
+#endif
+
+typedef struct {
+    const char *name;
+    size_t (*fn)(char * restrict dest, const char * restrict src, size_t n);
+} my_strncpy_len_impl;
+
+size_t my_strncpy_len_impls(const my_strncpy_len_impl **out);
+
+/**
+ * my_strrev - Reverse a string in place
+ *
+ * @param s: String to reverse (null-terminated, writable)
+ *
+ * @return: s
+ *
+ * Precondition:  s is null-terminated and writable
+ * Postcondition: The bytes before '\0' are in reverse order
+ *
+ * Reverses BYTES: multibyte UTF-8 characters come out broken. Use
+ * my_strrev_utf8 for text that may contain them.
+ *
+ * Time:  O(n)
+ * Space: O(1)
+ */
+char *my_strrev(char *s);
+
+/**
+ * my_strrev_ref, my_strrev_swar, my_strrev_sse2, my_strrev_avx2
+ *   - The implementations behind my_strrev
+ *
+ * The wide ones find the length with the same-width my_strlen, then
+ * load one block from each end, reverse the bytes inside both, and
+ * store each at the other end:
+ *
+ *      swar:  8-byte words, byte-swapped (bswap)
+ *      sse2:  16-byte blocks, reversed by three shuffles and a shift
+ *      avx2:  32-byte blocks, vpshufb within each half, vpermq to swap
+ *             the halves
+ *
+ * When less than two blocks are left, one block from each end still
+ * covers the middle: the two overlap, and since both are loaded before
+ * either is stored, the overlapping bytes get the same value twice.
+ * Under a block, smaller pieces do the same. No byte outside the
+ * string is read or written.
+ */
+char *my_strrev_ref(char *s);
+char *my_strrev_swar(char *s);
+#if MY_STRING_X86
+char *my_strrev_sse2(char *s);
+char *my_strrev_avx2(char *s);
+#endif
+
+/**
+ * my_strrev_impl - Implementation table (reference first, fastest usable last)
+ */
+typedef struct {
+    const char *name;
+    char *(*fn)(char *s);
+} my_strrev_impl;
+
+size_t my_strrev_impls(const my_strrev_impl **out);
+
+/**
+ * my_strrev_utf8 - Reverse by UTF-8 character instead of by byte
+ *
+ * @param s: UTF-8 string (null-terminated, writable)
+ *
+ * @return: s
+ *
+ * "성진우" becomes "우진성", not a mangled byte soup. Each valid 2-4
+ * byte sequence keeps its byte order; anything that isn't valid UTF-8
+ * is reversed as single bytes. For valid UTF-8, reversing twice gives
+ * back the original.
+ *
+ * Combining marks (e + U+0301) are separate code points and end up
+ * before their base character: this reverses code points, not what a
+ * reader sees as letters.
+ *
+ * Time:  O(n), my_strrev plus one more pass
+ */
+char *my_strrev_utf8(char *s);
+
+/**
+ * my_strstr - Find the first occurrence of needle in haystack
+ *
+ * @param haystack: String to search (null-terminated)
+ * @param needle:   String to find (null-terminated)
+ *
+ * @return: Pointer to the first match inside haystack, or NULL if there
+ *          is none. An empty needle matches at haystack itself.
+ *
+ * Precondition:  Both strings are null-terminated
+ * Postcondition: Neither string is modified
+ *
+ * The algorithm depends on the needle length m:
+ *
+ *     m = 1         scan for the byte (and '\0') a block at a time
+ *     m <= 32       SIMD filter: first AND last byte must match
+ *                   before a candidate is compared in full
+ *     m > 32        Crochemore-Perrin Two-Way
+ *
+ * The haystack is never read past the page holding its '\0' (the
+ * my_strlen page rule), and never measured in full up front: a match
+ * near the start of a huge haystack is found early.
+ *
+ * Time:  O(n + m) for m = 1 and m > 32. The filter is O(n·m) at worst
+ *        (every position a candidate), but m <= 32 bounds that.
+ * Space: O(1)
+ */
+char *my_strstr(const char *haystack, const char *needle);
+
+/**
+ * my_strstr_ref, my_strstr_twoway - Reference and Two-Way alone
+ *
+ * ref:     try every start, compare byte by byte: O(n·m)
+ * twoway:  Two-Way for every needle length: O(n + m) always
+ */
+char *my_strstr_ref(const char *haystack, const char *needle);
+char *my_strstr_twoway(const char *haystack, const char *needle);
+
+/**
+ * my_strstr_impl - Implementation table for tests and benchmarks
+ *
+ * ref, twoway, then "engine": my_strstr itself.
+ */
+typedef struct {
+    const char *name;
+    char *(*fn)(const char *haystack, const char *needle);
+} my_strstr_impl;
+
+size_t my_strstr_impls(const my_strstr_impl **out);
+
+/**
+ * my_matcher - Many needles, one pass (Aho-Corasick)
+ *
+ * Built once from a set of patterns, then scans any number of texts.
+ * Every occurrence of every pattern is found in a single pass over the
+ * text, however many patterns there are: O(text + matches).
+ *
+ * Opaque: create with my_matcher_new, release with my_matcher_free.
+ */
+typedef struct my_matcher my_matcher;
+
+/**
+ * my_match_fn - Called once per match
+ *
+ * @param start:   Offset of the match in the text
+ * @param pattern: Index of the pattern in the array given to my_matcher_new
+ * @param ctx:     The caller's pointer, passed through
+ *
+ * @return: 0 to keep scanning, anything else to stop
+ */
+typedef int (*my_match_fn)(size_t start, size_t pattern, void *ctx);
+
+/**
+ * my_matcher_new - Compile patterns into a matcher
+ *
+ * @param patterns: count non-empty, null-terminated patterns (copied:
+ *                  the array may be freed after the call)
+ * @param count:    Number of patterns (at least 1)
+ *
+ * @return: The matcher, or NULL if count is 0, a pattern is empty, or
+ *          memory ran out
+ *
+ * A pattern listed twice is reported once, under its first index.
+ */
+my_matcher *my_matcher_new(const char *const *patterns, size_t count);
+
+/**
+ * my_matcher_free - Release a matcher (NULL is allowed)
+ */
+void my_matcher_free(my_matcher *mm);
+
+/**
+ * my_matcher_scan - Report every match in text[0, len)
+ *
+ * @param fn:  Called per match; NULL just counts
+ *
+ * @return: Number of matches reported (including the one that stopped
+ *          the scan, if fn stopped it)
+ *
+ * Matches come in order of where they END; several ending at the same
+ * byte come longest first. Overlapping matches are all reported:
+ * "she" and "he" in "ushers".
+ *
+ * text may contain '\0' bytes; only len counts.
+ *
+ * For small pattern sets on CPUs with SSSE3 a "Teddy" prefilter skips,
+ * 16 bytes at a time, text where no pattern can start. The matches are
+ * exactly those of my_matcher_scan_dfa.
+ */
+size_t my_matcher_scan(const my_matcher *mm, const char *text, size_t len,
+                       my_match_fn fn, void *ctx);
+
+/**
+ * my_matcher_scan_dfa - my_matcher_scan without the prefilter
+ *
+ * One table lookup per text byte, always. For tests and benchmarks.
+ */
+size_t my_matcher_scan_dfa(const my_matcher *mm, const char *text, size_t len,
+                           my_match_fn fn, void *ctx);
+
+/**
+ * my_matcher_prefiltered - 1 if my_matcher_scan uses the Teddy prefilter
+ */
+int my_matcher_prefiltered(const my_matcher *mm);
+
 #endif /* MY_STRING_H */
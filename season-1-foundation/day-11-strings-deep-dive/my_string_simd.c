@@ -0,0 +1,1396 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  my_string_simd.c — Wide Implementations and CPU Dispatch
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Walk the bytes — eight, sixteen, thirty-two at a time."
+ *
+ *  my_string.c is the reference: one byte per step, easy to verify.
+ *  This file does the same work on whole words and vectors. Every
+ *  function here is tested against its reference in test_my_string.c.
+ *
+ *  The one rule that makes reading ahead legal in practice:
+ *
+ *      Only read ALIGNED blocks.
+ *
+ *      page N                               page N+1 (maybe unmapped)
+ *      ... [ 16 ][ 16 ][ 16 ][ "ab\0" + junk ] | ...
+ *                                           ↑
+ *          an aligned block ends at or before the page boundary,
+ *          so the block holding '\0' never reaches into page N+1
+ *
+ *  The bytes after '\0' in that last block are read but ignored.
+ *  AddressSanitizer can't know that, so these functions opt out of it.
+ *
+ *  Where an aligned read won't do (my_strcmp can't align two strings at
+ *  once; the copies start with one unaligned block), the same promise
+ *  is kept by checking the page boundary directly.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "my_string.h"
+
+#if MY_STRING_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define NO_ASAN __attribute__((no_sanitize_address))
+#else
+#define NO_ASAN
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LITTLE_ENDIAN_WORDS 1
+#else
+#define LITTLE_ENDIAN_WORDS 0
+#endif
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Bit Helpers
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+
+/* Index of the lowest set bit (x != 0) */
+static inline unsigned lowest_bit(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/* Distance in bytes from s to p (p may be the aligned block before s) */
+static inline size_t distance(const void *s, const void *p)
+{
+    return (size_t)((uintptr_t)p - (uintptr_t)s);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strlen_swar — Eight Bytes per Step
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  The "has a zero byte" trick, for each byte b of a 64-bit word v:
+ *
+ *      (v - 0x0101..01) & ~v & 0x8080..80
+ *
+ *  b - 1 sets the high bit only if b was 0 (borrow) or b > 0x80;
+ *  & ~v drops the b > 0x80 case. A borrow can also flip the byte ABOVE
+ *  a zero byte, but never one below it, so on a little-endian machine
+ *  the LOWEST flagged byte is always the first real '\0'.
+ */
+#define ONES   0x0101010101010101ull
+#define HIGHS  0x8080808080808080ull
+
+static inline uint64_t zero_bytes(uint64_t v)
+{
+    return (v - ONES) & ~v & HIGHS;
+}
+
+static inline uint64_t load_word(const unsigned char *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));   /* No aliasing or alignment UB */
+    return v;
+}
+
+/* Index of the first '\0' in a word known to contain one */
+static inline size_t first_zero(uint64_t v, uint64_t z)
+{
+#if LITTLE_ENDIAN_WORDS
+    (void)v;
+    return lowest_bit(z) / 8;
+#else
+    unsigned char bytes[8];
+    size_t i = 0;
+    (void)z;
+    memcpy(bytes, &v, sizeof(bytes));
+    while (bytes[i] != '\0') {
+        i++;
+    }
+    return i;
+#endif
+}
+
+NO_ASAN
+size_t my_strlen_swar(const char *s)
+{
+    size_t skip = (uintptr_t)s & 7;
+    const unsigned char *p = (const unsigned char *)((uintptr_t)s - skip);
+    uint64_t v = load_word(p);
+
+    /* Bytes before s belong to someone else: force them non-zero */
+    if (skip != 0) {
+#if LITTLE_ENDIAN_WORDS
+        v |= ~0ull >> (64 - 8 * skip);
+#else
+        v |= ~(~0ull >> (8 * skip));
+#endif
+    }
+
+    for (;;) {
+        uint64_t z = zero_bytes(v);
+        if (z != 0) {
+            return distance(s, p) + first_zero(v, z);
+        }
+        p += 8;
+        v = load_word(p);
+    }
+}
+
+/*
+ *  my_strnlen: the same loop, stopping after the block that holds
+ *  byte maxlen - 1 (found before the loop, so each step costs one
+ *  extra compare). The answer is then the smaller of '\0' and maxlen.
+ */
+
+/* Address of the last byte to look at (maxlen > 0; clamped at the top of memory) */
+static inline uintptr_t last_byte(const char *s, size_t maxlen)
+{
+    uintptr_t room = UINTPTR_MAX - (uintptr_t)s;
+    return (uintptr_t)s + ((maxlen - 1 < room) ? maxlen - 1 : room);
+}
+
+static inline size_t clamp(size_t len, size_t maxlen)
+{
+    return (len < maxlen) ? len : maxlen;
+}
+
+NO_ASAN
+size_t my_strnlen_swar(const char *s, size_t maxlen)
+{
+    size_t skip = (uintptr_t)s & 7;
+    const unsigned char *p = (const unsigned char *)((uintptr_t)s - skip);
+    const unsigned char *last;
+    uint64_t v, z;
+
+    if (maxlen == 0) {
+        return 0;
+    }
+    last = (const unsigned char *)(last_byte(s, maxlen) & ~(uintptr_t)7);
+
+    v = load_word(p);
+    if (skip != 0) {
+#if LITTLE_ENDIAN_WORDS
+        v |= ~0ull >> (64 - 8 * skip);
+#else
+        v |= ~(~0ull >> (8 * skip));
+#endif
+    }
+
+    for (;;) {
+        z = zero_bytes(v);
+        if (z != 0) {
+            return clamp(distance(s, p) + first_zero(v, z), maxlen);
+        }
+        if (p == last) {
+            return maxlen;
+        }
+        p += 8;
+        v = load_word(p);
+    }
+}
+
+
+#if MY_STRING_X86
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strlen_sse2 / my_strlen_avx2 — One Compare per Block
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  pcmpeqb against zero turns each '\0' byte into 0xFF; pmovmskb packs
+ *  the top bit of every byte into an int. Bit i set ⇔ byte i is '\0'.
+ *
+ *      block:  [ 'h' 'u' 'n' 't' '\0' ?? ?? ... ]
+ *      mask:    0   0   0   0   1    ?  ?        → ctz = 4
+ *
+ *  The first block starts before s; shifting the mask right by the
+ *  offset throws away the bytes that aren't ours.
+ */
+NO_ASAN
+size_t my_strlen_sse2(const char *s)
+{
+    size_t skip = (uintptr_t)s & 15;
+    const __m128i *p = (const __m128i *)((uintptr_t)s - skip);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned mask;
+
+    mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(p), zero)) >> skip;
+    if (mask != 0) {
+        return lowest_bit(mask);
+    }
+
+    for (;;) {
+        p++;
+        mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(p), zero));
+        if (mask != 0) {
+            return distance(s, p) + lowest_bit(mask);
+        }
+    }
+}
+
+__attribute__((target("avx2"))) NO_ASAN
+size_t my_strlen_avx2(const char *s)
+{
+    size_t skip = (uintptr_t)s & 31;
+    const __m256i *p = (const __m256i *)((uintptr_t)s - skip);
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned mask;
+
+    mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(p), zero)) >> skip;
+    if (mask != 0) {
+        return lowest_bit(mask);
+    }
+
+    for (;;) {
+        p++;
+        mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(p), zero));
+        if (mask != 0) {
+            return distance(s, p) + lowest_bit(mask);
+        }
+    }
+}
+
+NO_ASAN
+size_t my_strnlen_sse2(const char *s, size_t maxlen)
+{
+    size_t skip = (uintptr_t)s & 15;
+    const __m128i *p = (const __m128i *)((uintptr_t)s - skip);
+    const __m128i *last;
+    const __m128i zero = _mm_setzero_si128();
+    unsigned mask;
+
+    if (maxlen == 0) {
+        return 0;
+    }
+
+    mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(p), zero)) >> skip;
+    if (mask != 0) {
+        return clamp(lowest_bit(mask), maxlen);
+    }
+
+    last = (const __m128i *)(last_byte(s, maxlen) & ~(uintptr_t)15);
+    while (p != last) {
+        p++;
+        mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(p), zero));
+        if (mask != 0) {
+            return clamp(distance(s, p) + lowest_bit(mask), maxlen);
+        }
+    }
+    return maxlen;
+}
+
+__attribute__((target("avx2"))) NO_ASAN
+size_t my_strnlen_avx2(const char *s, size_t maxlen)
+{
+    size_t skip = (uintptr_t)s & 31;
+    const __m256i *p = (const __m256i *)((uintptr_t)s - skip);
+    const __m256i *last;
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned mask;
+
+    if (maxlen == 0) {
+        return 0;
+    }
+
+    mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(p), zero)) >> skip;
+    if (mask != 0) {
+        return clamp(lowest_bit(mask), maxlen);
+    }
+
+    last = (const __m256i *)(last_byte(s, maxlen) & ~(uintptr_t)31);
+    while (p != last) {
+        p++;
+        mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(p), zero));
+        if (mask != 0) {
+            return clamp(distance(s, p) + lowest_bit(mask), maxlen);
+        }
+    }
+    return maxlen;
+}
+#endif /* MY_STRING_X86 */
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strcmp / my_strncmp — Compare a Block, Stop at the First Surprise
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Per block, one mask answers "where would the byte loop stop?":
+ *
+ *      s1:        [ 'g' 'a' 't' 'e' '\0' ... ]
+ *      s2:        [ 'g' 'a' 'm' 'e' '\0' ... ]
+ *      differ:      0   0   1   0   0
+ *      s1 NUL:      0   0   0   0   1
+ *      stop mask:   0   0   1   0   1        → first stop = byte 2
+ *
+ *  (s2 having '\0' where s1 doesn't already shows up as "differ".)
+ *  The answer is then the same subtraction the reference does, on that
+ *  one byte pair.
+ *
+ *  s1 and s2 can't both be aligned, so the reads are unaligned, and a
+ *  block is only read when it stays inside a 4096-byte page in BOTH
+ *  strings. Near a page end we fall back to one byte per step; that
+ *  costs at most a block's worth of bytes per page crossed. (4096 is
+ *  the smallest page size; larger pages are multiples of it.)
+ *
+ *  strcmp is strncmp with n = SIZE_MAX.
+ */
+#define PAGE_MIN 4096u
+
+static inline int crosses_page(const unsigned char *p, size_t width)
+{
+    return ((uintptr_t)p & (PAGE_MIN - 1)) > PAGE_MIN - width;
+}
+
+/* 0x80 in every byte of x that is non-zero (exact, no false positives) */
+static inline uint64_t nonzero_bytes(uint64_t x)
+{
+    return (((x & ~HIGHS) + ~HIGHS) | x) & HIGHS;
+}
+
+/* Byte loop over at most n bytes: the reference, from an offset */
+static inline int compare_bytes(const unsigned char *a, const unsigned char *b,
+                                size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i] || a[i] == '\0') {
+            return a[i] - b[i];
+        }
+    }
+    return 0;
+}
+
+NO_ASAN
+static int strncmp_swar(const unsigned char *a, const unsigned char *b, size_t n)
+{
+    while (n > 0) {
+        uint64_t va, vb, stop;
+
+        if (crosses_page(a, 8) || crosses_page(b, 8)) {
+            if (*a != *b || *a == '\0') {
+                return *a - *b;
+            }
+            a++;
+            b++;
+            n--;
+            continue;
+        }
+
+        va = load_word(a);
+        vb = load_word(b);
+        stop = zero_bytes(va) | nonzero_bytes(va ^ vb);
+
+        if (stop != 0) {
+#if LITTLE_ENDIAN_WORDS
+            size_t i = lowest_bit(stop) / 8;
+            return (i < n) ? a[i] - b[i] : 0;
+#else
+            return compare_bytes(a, b, (n < 8) ? n : 8);
+#endif
+        }
+        if (n <= 8) {
+            return 0;
+        }
+        a += 8;
+        b += 8;
+        n -= 8;
+    }
+    return 0;
+}
+
+int my_strcmp_swar(const char *s1, const char *s2)
+{
+    return strncmp_swar((const unsigned char *)s1, (const unsigned char *)s2, SIZE_MAX);
+}
+
+int my_strncmp_swar(const char *s1, const char *s2, size_t n)
+{
+    return strncmp_swar((const unsigned char *)s1, (const unsigned char *)s2, n);
+}
+
+#if MY_STRING_X86
+NO_ASAN
+static int strncmp_sse2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    while (n > 0) {
+        __m128i va, vb;
+        unsigned stop;
+
+        if (crosses_page(a, 16) || crosses_page(b, 16)) {
+            if (*a != *b || *a == '\0') {
+                return *a - *b;
+            }
+            a++;
+            b++;
+            n--;
+            continue;
+        }
+
+        va = _mm_loadu_si128((const __m128i *)(const void *)a);
+        vb = _mm_loadu_si128((const __m128i *)(const void *)b);
+        stop = (~(unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) & 0xFFFFu) |
+               (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(va, zero));
+        if (n < 16) {
+            stop &= (1u << n) - 1;
+        }
+
+        if (stop != 0) {
+            size_t i = lowest_bit(stop);
+            return a[i] - b[i];
+        }
+        if (n <= 16) {
+            return 0;
+        }
+        a += 16;
+        b += 16;
+        n -= 16;
+    }
+    return 0;
+}
+
+__attribute__((target("avx2"))) NO_ASAN
+static int strncmp_avx2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (n > 0) {
+        __m256i va, vb;
+        unsigned stop;
+
+        if (crosses_page(a, 32) || crosses_page(b, 32)) {
+            if (*a != *b || *a == '\0') {
+                return *a - *b;
+            }
+            a++;
+            b++;
+            n--;
+            continue;
+        }
+
+        va = _mm256_loadu_si256((const __m256i *)(const void *)a);
+        vb = _mm256_loadu_si256((const __m256i *)(const void *)b);
+        stop = ~(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)) |
+               (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, zero));
+        if (n < 32) {
+            stop &= (1u << n) - 1;
+        }
+
+        if (stop != 0) {
+            size_t i = lowest_bit(stop);
+            return a[i] - b[i];
+        }
+        if (n <= 32) {
+            return 0;
+        }
+        a += 32;
+        b += 32;
+        n -= 32;
+    }
+    return 0;
+}
+
+int my_strcmp_sse2(const char *s1, const char *s2)
+{
+    return strncmp_sse2((const unsigned char *)s1, (const unsigned char *)s2, SIZE_MAX);
+}
+
+int my_strncmp_sse2(const char *s1, const char *s2, size_t n)
+{
+    return strncmp_sse2((const unsigned char *)s1, (const unsigned char *)s2, n);
+}
+
+int my_strcmp_avx2(const char *s1, const char *s2)
+{
+    return strncmp_avx2((const unsigned char *)s1, (const unsigned char *)s2, SIZE_MAX);
+}
+
+int my_strncmp_avx2(const char *s1, const char *s2, size_t n)
+{
+    return strncmp_avx2((const unsigned char *)s1, (const unsigned char *)s2, n);
+}
+#endif /* MY_STRING_X86 */
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strcpy / my_strncpy / my_strcat — Find and Copy in One Pass
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  The obvious fast copy is strlen + memcpy: two passes over src. Here
+ *  each block is loaded once, checked for '\0', and stored straight to
+ *  dest if it has none:
+ *
+ *      src:   [ 16 no '\0' ][ 16 no '\0' ][ ...'\0'.. ]
+ *               load→store    load→store    ↑ stop: copy the tail
+ *
+ *  Reads follow my_strlen's rule: the first block is unaligned only if
+ *  it stays inside its page, every later block is aligned. Writes never
+ *  go past the terminator (dest may be exactly strlen(src) + 1 bytes).
+ *
+ *  The TAIL is everything from the current block up to and including
+ *  '\0'. Rather than a byte loop, it's one full-width copy that ENDS on
+ *  the last byte, overlapping bytes already written:
+ *
+ *      copied:  [ ............ done ............ ]
+ *      tail:                     [ last 16 bytes incl '\0' ]
+ *
+ *  That needs at least one block's worth of string; shorter strings go
+ *  through copy_small, the same trick with 8/4/2/1-byte pieces.
+ *
+ *  The core takes a limit, which is n for my_strncpy and "none" for the
+ *  others, and returns how many non-'\0' bytes it copied. my_strncpy's
+ *  padding is then a plain memset, and my_strcat is the same-width
+ *  my_strlen on dest followed by the copy.
+ */
+
+/* Copy n bytes (n < 32) as two overlapping pieces of one size */
+static inline void copy_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+    if (n >= 16) {
+        memcpy(d, s, 16);
+        memcpy(d + n - 16, s + n - 16, 16);
+    } else if (n >= 8) {
+        memcpy(d, s, 8);
+        memcpy(d + n - 8, s + n - 8, 8);
+    } else if (n >= 4) {
+        memcpy(d, s, 4);
+        memcpy(d + n - 4, s + n - 4, 4);
+    } else if (n >= 2) {
+        memcpy(d, s, 2);
+        memcpy(d + n - 2, s + n - 2, 2);
+    } else if (n == 1) {
+        *d = *s;
+    }
+}
+
+/*
+ * finish — Copy the tail and return the length
+ *
+ * Bytes before i are copied; the first '\0' at or after i is at s[nul]
+ * (nul = i + width if the block had none). Writes the limit-th byte at
+ * most.
+ */
+static inline size_t finish(unsigned char *d, const unsigned char *s,
+                            size_t i, size_t nul, size_t limit, size_t width)
+{
+    size_t len = (nul < limit) ? nul : limit;
+    size_t total = (nul < limit) ? nul + 1 : limit;
+
+    if (total >= width) {
+        memcpy(d + total - width, s + total - width, width);
+    } else {
+        copy_small(d + i, s + i, total - i);
+    }
+    return len;
+}
+
+/*
+ * copy_to_aligned — Near a page end, byte steps up to the next block
+ *
+ * Returns 1 if '\0' or the limit came first (*i is then the length),
+ * else 0 with s + *i aligned to width.
+ */
+static inline int copy_to_aligned(unsigned char *d, const unsigned char *s,
+                                  size_t limit, size_t width, size_t *i)
+{
+    while (((uintptr_t)(s + *i) & (width - 1)) != 0) {
+        if (*i == limit) {
+            return 1;
+        }
+        d[*i] = s[*i];
+        if (s[*i] == '\0') {
+            return 1;
+        }
+        (*i)++;
+    }
+    return *i == limit;
+}
+
+/* Returns the number of bytes before '\0' copied (limit > 0) */
+NO_ASAN
+static size_t copy_swar(unsigned char *d, const unsigned char *s, size_t limit)
+{
+    size_t i = 0;
+    uint64_t v, z;
+
+    if (!crosses_page(s, 8)) {
+        v = load_word(s);
+        z = zero_bytes(v);
+        if (z != 0 || limit <= 8) {
+            return finish(d, s, 0, (z != 0) ? first_zero(v, z) : 8, limit, 8);
+        }
+        memcpy(d, &v, 8);
+        i = 8 - ((uintptr_t)s & 7);
+    } else if (copy_to_aligned(d, s, limit, 8, &i)) {
+        return i;
+    }
+
+    for (;;) {
+        v = load_word(s + i);
+        z = zero_bytes(v);
+        if (z != 0 || limit - i <= 8) {
+            return finish(d, s, i, i + ((z != 0) ? first_zero(v, z) : 8), limit, 8);
+        }
+        memcpy(d + i, &v, 8);
+        i += 8;
+    }
+}
+
+char *my_strcpy_swar(char * restrict dest, const char * restrict src)
+{
+    copy_swar((unsigned char *)dest, (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+
+char *my_strncpy_swar(char * restrict dest, const char * restrict src, size_t n)
+{
+    size_t len;
+
+    if (n == 0) {
+        return dest;
+    }
+    len = copy_swar((unsigned char *)dest, (const unsigned char *)src, n);
+    if (len < n) {
+        memset(dest + len + 1, 0, n - len - 1);     /* '\0' at len is copied */
+    }
+    return dest;
+}
+
+size_t my_strncpy_len_swar(char * restrict dest, const char * restrict src, size_t n)
+{
+    return (n == 0) ? 0 : copy_swar((unsigned char *)dest, (const unsigned char *)src, n);
+}
+
+char *my_strcat_swar(char * restrict dest, const char * restrict src)
+{
+    copy_swar((unsigned char *)dest + my_strlen_swar(dest),
+              (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+
+#if MY_STRING_X86
+NO_ASAN
+static size_t copy_sse2(unsigned char *d, const unsigned char *s, size_t limit)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    unsigned m;
+    __m128i v;
+
+    if (!crosses_page(s, 16)) {
+        v = _mm_loadu_si128((const __m128i *)(const void *)s);
+        m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+        if (m != 0 || limit <= 16) {
+            return finish(d, s, 0, (m != 0) ? lowest_bit(m) : 16, limit, 16);
+        }
+        _mm_storeu_si128((__m128i *)(void *)d, v);
+        i = 16 - ((uintptr_t)s & 15);
+    } else if (copy_to_aligned(d, s, limit, 16, &i)) {
+        return i;
+    }
+
+    for (;;) {
+        v = _mm_load_si128((const __m128i *)(const void *)(s + i));
+        m = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+        if (m != 0 || limit - i <= 16) {
+            return finish(d, s, i, i + ((m != 0) ? lowest_bit(m) : 16), limit, 16);
+        }
+        _mm_storeu_si128((__m128i *)(void *)(d + i), v);
+        i += 16;
+    }
+}
+
+__attribute__((target("avx2"))) NO_ASAN
+static size_t copy_avx2(unsigned char *d, const unsigned char *s, size_t limit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    unsigned m;
+    __m256i v;
+
+    if (!crosses_page(s, 32)) {
+        v = _mm256_loadu_si256((const __m256i *)(const void *)s);
+        m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        if (m != 0 || limit <= 32) {
+            return finish(d, s, 0, (m != 0) ? lowest_bit(m) : 32, limit, 32);
+        }
+        _mm256_storeu_si256((__m256i *)(void *)d, v);
+        i = 32 - ((uintptr_t)s & 31);
+    } else if (copy_to_aligned(d, s, limit, 32, &i)) {
+        return i;
+    }
+
+    for (;;) {
+        v = _mm256_load_si256((const __m256i *)(const void *)(s + i));
+        m = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        if (m != 0 || limit - i <= 32) {
+            return finish(d, s, i, i + ((m != 0) ? lowest_bit(m) : 32), limit, 32);
+        }
+        _mm256_storeu_si256((__m256i *)(void *)(d + i), v);
+        i += 32;
+    }
+}
+
+char *my_strcpy_sse2(char * restrict dest, const char * restrict src)
+{
+    copy_sse2((unsigned char *)dest, (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+
+char *my_strncpy_sse2(char * restrict dest, const char * restrict src, size_t n)
+{
+    size_t len;
+
+    if (n == 0) {
+        return dest;
+    }
+    len = copy_sse2((unsigned char *)dest, (const unsigned char *)src, n);
+    if (len < n) {
+        memset(dest + len + 1, 0, n - len - 1);
+    }
+    return dest;
+}
+
+size_t my_strncpy_len_sse2(char * restrict dest, const char * restrict src, size_t n)
+{
+    return (n == 0) ? 0 : copy_sse2((unsigned char *)dest, (const unsigned char *)src, n);
+}
+
+char *my_strcat_sse2(char * restrict dest, const char * restrict src)
+{
+    copy_sse2((unsigned char *)dest + my_strlen_sse2(dest),
+              (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+
+char *my_strcpy_avx2(char * restrict dest, const char * restrict src)
+{
+    copy_avx2((unsigned char *)dest, (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+
+char *my_strncpy_avx2(char * restrict dest, const char * restrict src, size_t n)
+{
+    size_t len;
+
+    if (n == 0) {
+        return dest;
+    }
+    len = copy_avx2((unsigned char *)dest, (const unsigned char *)src, n);
+    if (len < n) {
+        memset(dest + len + 1, 0, n - len - 1);
+    }
+    return dest;
+}
+
+size_t my_strncpy_len_avx2(char * restrict dest, const char * restrict src, size_t n)
+{
+    return (n == 0) ? 0 : copy_avx2((unsigned char *)dest, (const unsigned char *)src, n);
+}
+
+char *my_strcat_avx2(char * restrict dest, const char * restrict src)
+{
+    copy_avx2((unsigned char *)dest + my_strlen_avx2(dest),
+              (const unsigned char *)src, SIZE_MAX);
+    return dest;
+}
+#endif /* MY_STRING_X86 */
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  my_strrev — Swap Blocks from Both Ends
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  The reference swaps one byte from each end per step. Here a whole
+ *  block comes from each end, the bytes inside both are reversed, and
+ *  each goes to the other end:
+ *
+ *      [ A | . . . . . . . . | B ]   →   [ rev(B) | . . . . | rev(A) ]
+ *       lo                    hi
+ *
+ *  Less than two blocks but at least one left: the two end blocks
+ *  overlap in the middle. Both are loaded before either is stored, and
+ *  the overlapping bytes get the same value from both stores, so the
+ *  middle needs no special case. Under one block, smaller pieces do
+ *  the same down to a single byte swap.
+ *
+ *  The length comes first (same-width my_strlen), so every read and
+ *  write stays inside the string: no page checks, no NO_ASAN.
+ */
+
+/* Byte order of a word, reversed */
+static inline uint64_t swap64(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap64(v);
+#else
+    v = ((v & 0x00FF00FF00FF00FFULL) << 8) | ((v >> 8) & 0x00FF00FF00FF00FFULL);
+    v = ((v & 0x0000FFFF0000FFFFULL) << 16) | ((v >> 16) & 0x0000FFFF0000FFFFULL);
+    return (v << 32) | (v >> 32);
+#endif
+}
+
+static inline uint32_t swap32(uint32_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(v);
+#else
+    v = ((v & 0x00FF00FFU) << 8) | ((v >> 8) & 0x00FF00FFU);
+    return (v << 16) | (v >> 16);
+#endif
+}
+
+/* Reverse n bytes (n < 16) in place: the two-ends trick on 8/4/1 bytes */
+static inline void reverse_small(unsigned char *p, size_t n)
+{
+    if (n >= 8) {
+        uint64_t a, b;
+        memcpy(&a, p, 8);
+        memcpy(&b, p + n - 8, 8);
+        a = swap64(a);
+        b = swap64(b);
+        memcpy(p, &b, 8);
+        memcpy(p + n - 8, &a, 8);
+    } else if (n >= 4) {
+        uint32_t a, b;
+        memcpy(&a, p, 4);
+        memcpy(&b, p + n - 4, 4);
+        a = swap32(a);
+        b = swap32(b);
+        memcpy(p, &b, 4);
+        memcpy(p + n - 4, &a, 4);
+    } else if (n >= 2) {
+        unsigned char tmp = p[0];       /* n = 3: the middle stays put */
+        p[0] = p[n - 1];
+        p[n - 1] = tmp;
+    }
+}
+
+char *my_strrev_swar(char *s)
+{
+    unsigned char *lo = (unsigned char *)s;
+    unsigned char *hi = lo + my_strlen_swar(s);
+
+    while (hi - lo >= 16) {
+        uint64_t a, b;
+        memcpy(&a, lo, 8);
+        memcpy(&b, hi - 8, 8);
+        a = swap64(a);
+        b = swap64(b);
+        memcpy(lo, &b, 8);
+        memcpy(hi - 8, &a, 8);
+        lo += 8;
+        hi -= 8;
+    }
+    reverse_small(lo, (size_t)(hi - lo));
+    return s;
+}
+
+#if MY_STRING_X86
+/*
+ *  SSE2 has no byte shuffle (pshufb is SSSE3), so 16 bytes are reversed
+ *  in three steps: 32-bit lanes, then 16-bit halves, then the two bytes
+ *  of each 16-bit half.
+ *
+ *      [ 0 1 2 3 | 4 5 6 7 | 8 9 A B | C D E F ]
+ *      [ C D E F | 8 9 A B | 4 5 6 7 | 0 1 2 3 ]   pshufd
+ *      [ E F C D | A B 8 9 | 6 7 4 5 | 2 3 0 1 ]   pshuflw + pshufhw
+ *      [ F E D C | B A 9 8 | 7 6 5 4 | 3 2 1 0 ]   shift left 8 | right 8
+ */
+static inline __m128i reverse16(__m128i v)
+{
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/* Swap the end blocks of p[0..n) reversed (16 <= n < 32: they overlap) */
+static inline void reverse_ends16(unsigned char *p, size_t n)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)(const void *)p);
+    __m128i b = _mm_loadu_si128((const __m128i *)(const void *)(p + n - 16));
+
+    _mm_storeu_si128((__m128i *)(void *)p, reverse16(b));
+    _mm_storeu_si128((__m128i *)(void *)(p + n - 16), reverse16(a));
+}
+
+char *my_strrev_sse2(char *s)
+{
+    unsigned char *lo = (unsigned char *)s;
+    unsigned char *hi = lo + my_strlen_sse2(s);
+
+    while (hi - lo >= 32) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(const void *)lo);
+        __m128i b = _mm_loadu_si128((const __m128i *)(const void *)(hi - 16));
+
+        _mm_storeu_si128((__m128i *)(void *)lo, reverse16(b));
+        _mm_storeu_si128((__m128i *)(void *)(hi - 16), reverse16(a));
+        lo += 16;
+        hi -= 16;
+    }
+
+    if (hi - lo >= 16) {
+        reverse_ends16(lo, (size_t)(hi - lo));
+    } else {
+        reverse_small(lo, (size_t)(hi - lo));
+    }
+    return s;
+}
+
+/*
+ *  vpshufb only shuffles within each 16-byte half, so reverse both
+ *  halves in place, then swap them with vpermq. (A single full-width
+ *  byte permute, vpermb, needs AVX-512 VBMI.)
+ */
+__attribute__((target("avx2")))
+static inline __m256i reverse32(__m256i v)
+{
+    const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                           7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8,
+                                           7, 6, 5, 4, 3, 2, 1, 0);
+
+    v = _mm256_shuffle_epi8(v, order);
+    return _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+__attribute__((target("avx2")))
+char *my_strrev_avx2(char *s)
+{
+    unsigned char *lo = (unsigned char *)s;
+    unsigned char *hi = lo + my_strlen_avx2(s);
+    __m256i a, b;
+
+    while (hi - lo >= 64) {
+        a = _mm256_loadu_si256((const __m256i *)(const void *)lo);
+        b = _mm256_loadu_si256((const __m256i *)(const void *)(hi - 32));
+        _mm256_storeu_si256((__m256i *)(void *)lo, reverse32(b));
+        _mm256_storeu_si256((__m256i *)(void *)(hi - 32), reverse32(a));
+        lo += 32;
+        hi -= 32;
+    }
+
+    if (hi - lo >= 32) {
+        a = _mm256_loadu_si256((const __m256i *)(const void *)lo);
+        b = _mm256_loadu_si256((const __m256i *)(const void *)(hi - 32));
+        _mm256_storeu_si256((__m256i *)(void *)lo, reverse32(b));
+        _mm256_storeu_si256((__m256i *)(void *)(hi - 32), reverse32(a));
+    } else if (hi - lo >= 16) {
+        reverse_ends16(lo, (size_t)(hi - lo));
+    } else {
+        reverse_small(lo, (size_t)(hi - lo));
+    }
+    return s;
+}
+#endif /* MY_STRING_X86 */
+
+/*
+ *  my_strrev_utf8 — Reverse by Character, Not by Byte
+ *
+ *  A byte reverse turns every multibyte character inside out:
+ *
+ *      "진" = [ EC ][ A7 ][ 84 ]   →   [ 84 ][ A7 ][ EC ]   (garbage)
+ *              lead  cont  cont          cont  cont  lead
+ *
+ *  So reverse the bytes first (dispatched), then walk once more:
+ *  wherever continuation bytes (10xxxxxx) are followed by the lead byte
+ *  that announces exactly that many, reverse that little run back.
+ *  Words with no high bit are pure ASCII and are skipped whole.
+ */
+
+/* Bytes in the sequence a lead byte starts (0: not a valid lead byte) */
+static inline size_t utf8_length(unsigned char b)
+{
+    if (b >= 0xC2 && b <= 0xDF) {
+        return 2;
+    }
+    if (b >= 0xE0 && b <= 0xEF) {
+        return 3;
+    }
+    if (b >= 0xF0 && b <= 0xF4) {
+        return 4;
+    }
+    return 0;
+}
+
+char *my_strrev_utf8(char *s)
+{
+    unsigned char *p = (unsigned char *)s;
+    size_t n = my_strlen(s);
+    size_t i = 0;
+
+    my_strrev(s);
+
+    while (i < n) {
+        size_t run = 0;
+
+        if (n - i >= 8 && (load_word(p + i) & HIGHS) == 0) {
+            i += 8;
+            continue;
+        }
+
+        while (run < 3 && (p[i + run] & 0xC0) == 0x80) {
+            run++;
+        }
+
+        if (run > 0 && utf8_length(p[i + run]) == run + 1) {
+            /* [ cont ... lead ] → [ lead ... cont ] */
+            for (size_t a = i, b = i + run; a < b; a++, b--) {
+                unsigned char tmp = p[a];
+                p[a] = p[b];
+                p[b] = tmp;
+            }
+            i += run + 1;
+        } else {
+            i++;
+        }
+    }
+    return s;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Dispatch
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Each public function (my_strlen, my_strcmp, ...) calls through a
+ *  function pointer that starts out pointing at a resolver. The first
+ *  call asks the CPU what it supports, stores the winner, and every
+ *  later call goes straight there.
+ *
+ *  (glibc does the same with IFUNC, resolved by the dynamic linker
+ *  before main. A pointer works with any linker and static builds.)
+ *
+ *  The pointers are _Atomic so two threads racing through the first
+ *  call is defined behaviour: both store the same value.
+ */
+#define COUNT(table) (sizeof(table) / sizeof((table)[0]))
+
+/* Usable entries of a table whose last entry needs AVX2 */
+static size_t usable(size_t count)
+{
+#if MY_STRING_X86
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx2")) {
+        count--;
+    }
+#endif
+    return count;
+}
+
+static const my_strlen_impl STRLEN_IMPLS[] = {
+    { "ref",  my_strlen_ref },
+    { "swar", my_strlen_swar },
+#if MY_STRING_X86
+    { "sse2", my_strlen_sse2 },
+    { "avx2", my_strlen_avx2 },
+#endif
+};
+
+static const my_strnlen_impl STRNLEN_IMPLS[] = {
+    { "ref",  my_strnlen_ref },
+    { "swar", my_strnlen_swar },
+#if MY_STRING_X86
+    { "sse2", my_strnlen_sse2 },
+    { "avx2", my_strnlen_avx2 },
+#endif
+};
+
+static const my_strcmp_impl STRCMP_IMPLS[] = {
+    { "ref",  my_strcmp_ref },
+    { "swar", my_strcmp_swar },
+#if MY_STRING_X86
+    { "sse2", my_strcmp_sse2 },
+    { "avx2", my_strcmp_avx2 },
+#endif
+};
+
+static const my_strncmp_impl STRNCMP_IMPLS[] = {
+    { "ref",  my_strncmp_ref },
+    { "swar", my_strncmp_swar },
+#if MY_STRING_X86
+    { "sse2", my_strncmp_sse2 },
+    { "avx2", my_strncmp_avx2 },
+#endif
+};
+
+static const my_strcpy_impl STRCPY_IMPLS[] = {
+    { "ref",  my_strcpy_ref },
+    { "swar", my_strcpy_swar },
+#if MY_STRING_X86
+    { "sse2", my_strcpy_sse2 },
+    { "avx2", my_strcpy_avx2 },
+#endif
+};
+
+static const my_strncpy_impl STRNCPY_IMPLS[] = {
+    { "ref",  my_strncpy_ref },
+    { "swar", my_strncpy_swar },
+#if MY_STRING_X86
+    { "sse2", my_strncpy_sse2 },
+    { "avx2", my_strncpy_avx2 },
+#endif
+};
+
+static const my_strncpy_len_impl STRNCPY_LEN_IMPLS[] = {
+    { "ref",  my_strncpy_len_ref },
+    { "swar", my_strncpy_len_swar },
+#if MY_STRING_X86
+    { "sse2", my_strncpy_len_sse2 },
+    { "avx2", my_strncpy_len_avx2 },
+#endif
+};
+
+static const my_strcpy_impl STRCAT_IMPLS[] = {
+    { "ref",  my_strcat_ref },
+    { "swar", my_strcat_swar },
+#if MY_STRING_X86
+    { "sse2", my_strcat_sse2 },
+    { "avx2", my_strcat_avx2 },
+#endif
+};
+
+static const my_strrev_impl STRREV_IMPLS[] = {
+    { "ref",  my_strrev_ref },
+    { "swar", my_strrev_swar },
+#if MY_STRING_X86
+    { "sse2", my_strrev_sse2 },
+    { "avx2", my_strrev_avx2 },
+#endif
+};
+
+size_t my_strlen_impls(const my_strlen_impl **out)
+{
+    if (out != NULL) {
+        *out = STRLEN_IMPLS;
+    }
+    return usable(COUNT(STRLEN_IMPLS));
+}
+
+size_t my_strnlen_impls(const my_strnlen_impl **out)
+{
+    if (out != NULL) {
+        *out = STRNLEN_IMPLS;
+    }
+    return usable(COUNT(STRNLEN_IMPLS));
+}
+
+size_t my_strcmp_impls(const my_strcmp_impl **out)
+{
+    if (out != NULL) {
+        *out = STRCMP_IMPLS;
+    }
+    return usable(COUNT(STRCMP_IMPLS));
+}
+
+size_t my_strncmp_impls(const my_strncmp_impl **out)
+{
+    if (out != NULL) {
+        *out = STRNCMP_IMPLS;
+    }
+    return usable(COUNT(STRNCMP_IMPLS));
+}
+
+size_t my_strcpy_impls(const my_strcpy_impl **out)
+{
+    if (out != NULL) {
+        *out = STRCPY_IMPLS;
+    }
+    return usable(COUNT(STRCPY_IMPLS));
+}
+
+size_t my_strncpy_impls(const my_strncpy_impl **out)
+{
+    if (out != NULL) {
+        *out = STRNCPY_IMPLS;
+    }
+    return usable(COUNT(STRNCPY_IMPLS));
+}
+
+size_t my_strncpy_len_impls(const my_strncpy_len_impl **out)
+{
+    if (out != NULL) {
+        *out = STRNCPY_LEN_IMPLS;
+    }
+    return usable(COUNT(STRNCPY_LEN_IMPLS));
+}
+
+size_t my_strcat_impls(const my_strcpy_impl **out)
+{
+    if (out != NULL) {
+        *out = STRCAT_IMPLS;
+    }
+    return usable(COUNT(STRCAT_IMPLS));
+}
+
+size_t my_strrev_impls(const my_strrev_impl **out)
+{
+    if (out != NULL) {
+        *out = STRREV_IMPLS;
+    }
+    return usable(COUNT(STRREV_IMPLS));
+}
+
+const char *my_strlen_selected(void)
+{
+    return STRLEN_IMPLS[usable(COUNT(STRLEN_IMPLS)) - 1].name;
+}
+
+/* The last usable entry is the fastest */
+typedef size_t (*strlen_fn)(const char *s);
+typedef size_t (*strnlen_fn)(const char *s, size_t maxlen);
+typedef int (*strcmp_fn)(const char *s1, const char *s2);
+typedef int (*strncmp_fn)(const char *s1, const char *s2, size_t n);
+typedef char *(*strcpy_fn)(char * restrict dest, const char * restrict src);
+typedef char *(*strncpy_fn)(char * restrict dest, const char * restrict src, size_t n);
+typedef size_t (*strncpy_len_fn)(char * restrict dest, const char * restrict src, size_t n);
+typedef char *(*strrev_fn)(char *s);
+
+static size_t strlen_resolve(const char *s);
+static size_t strnlen_resolve(const char *s, size_t maxlen);
+static int strcmp_resolve(const char *s1, const char *s2);
+static int strncmp_resolve(const char *s1, const char *s2, size_t n);
+static char *strcpy_resolve(char * restrict dest, const char * restrict src);
+static char *strncpy_resolve(char * restrict dest, const char * restrict src, size_t n);
+static size_t strncpy_len_resolve(char * restrict dest, const char * restrict src, size_t n);
+static char *strcat_resolve(char * restrict dest, const char * restrict src);
+static char *strrev_resolve(char *s);
+
+static _Atomic strlen_fn strlen_impl = strlen_resolve;
+static _Atomic strnlen_fn strnlen_impl = strnlen_resolve;
+static _Atomic strcmp_fn strcmp_impl = strcmp_resolve;
+static _Atomic strncmp_fn strncmp_impl = strncmp_resolve;
+static _Atomic strcpy_fn strcpy_impl = strcpy_resolve;
+static _Atomic strncpy_fn strncpy_impl = strncpy_resolve;
+static _Atomic strncpy_len_fn strncpy_len_impl = strncpy_len_resolve;
+static _Atomic strcpy_fn strcat_impl = strcat_resolve;
+static _Atomic strrev_fn strrev_impl = strrev_resolve;
+
+static size_t strlen_resolve(const char *s)
+{
+    strlen_fn fn = STRLEN_IMPLS[usable(COUNT(STRLEN_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strlen_impl, fn, memory_order_relaxed);
+    return fn(s);
+}
+
+static size_t strnlen_resolve(const char *s, size_t maxlen)
+{
+    strnlen_fn fn = STRNLEN_IMPLS[usable(COUNT(STRNLEN_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strnlen_impl, fn, memory_order_relaxed);
+    return fn(s, maxlen);
+}
+
+static int strcmp_resolve(const char *s1, const char *s2)
+{
+    strcmp_fn fn = STRCMP_IMPLS[usable(COUNT(STRCMP_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strcmp_impl, fn, memory_order_relaxed);
+    return fn(s1, s2);
+}
+
+static int strncmp_resolve(const char *s1, const char *s2, size_t n)
+{
+    strncmp_fn fn = STRNCMP_IMPLS[usable(COUNT(STRNCMP_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strncmp_impl, fn, memory_order_relaxed);
+    return fn(s1, s2, n);
+}
+
+static char *strcpy_resolve(char * restrict dest, const char * restrict src)
+{
+    strcpy_fn fn = STRCPY_IMPLS[usable(COUNT(STRCPY_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strcpy_impl, fn, memory_order_relaxed);
+    return fn(dest, src);
+}
+
+static char *strncpy_resolve(char * restrict dest, const char * restrict src, size_t n)
+{
+    strncpy_fn fn = STRNCPY_IMPLS[usable(COUNT(STRNCPY_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strncpy_impl, fn, memory_order_relaxed);
+    return fn(dest, src, n);
+}
+
+static size_t strncpy_len_resolve(char * restrict dest, const char * restrict src, size_t n)
+{
+    strncpy_len_fn fn = STRNCPY_LEN_IMPLS[usable(COUNT(STRNCPY_LEN_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strncpy_len_impl, fn, memory_order_relaxed);
+    return fn(dest, src, n);
+}
+
+static char *strcat_resolve(char * restrict dest, const char * restrict src)
+{
+    strcpy_fn fn = STRCAT_IMPLS[usable(COUNT(STRCAT_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strcat_impl, fn, memory_order_relaxed);
+    return fn(dest, src);
+}
+
+static char *strrev_resolve(char *s)
+{
+    strrev_fn fn = STRREV_IMPLS[usable(COUNT(STRREV_IMPLS)) - 1].fn;
+    atomic_store_explicit(&strrev_impl, fn, memory_order_relaxed);
+    return fn(s);
+}
+
+size_t my_strlen(const char *s)
+{
+    return atomic_load_explicit(&strlen_impl, memory_order_relaxed)(s);
+}
+
+size_t my_strnlen(const char *s, size_t maxlen)
+{
+    return atomic_load_explicit(&strnlen_impl, memory_order_relaxed)(s, maxlen);
+}
+
+int my_strcmp(const char *s1, const char *s2)
+{
+    return atomic_load_explicit(&strcmp_impl, memory_order_relaxed)(s1, s2);
+}
+
+int my_strncmp(const char *s1, const char *s2, size_t n)
+{
+    return atomic_load_explicit(&strncmp_impl, memory_order_relaxed)(s1, s2, n);
+}
+
+char *my_strcpy(char * restrict dest, const char * restrict src)
+{
+    return atomic_load_explicit(&strcpy_impl, memory_order_relaxed)(dest, src);
+}
+
+char *my_strncpy(char * restrict dest, const char * restrict src, size_t n)
+{
+    return atomic_load_explicit(&strncpy_impl, memory_order_relaxed)(dest, src, n);
+}
+
+size_t my_strncpy_len(char * restrict dest, const char * restrict src, size_t n)
+{
+    return atomic_load_explicit(&strncpy_len_impl, memory_order_relaxed)(dest, src, n);
+}
+
+char *my_strcat(char * restrict dest, const char * restrict src)
+{
+    return atomic_load_explicit(&strcat_impl, memory_order_relaxed)(dest, src);
+}
+
+char *my_strrev(char *s)
+{
+    return atomic_load_explicit(&strrev_impl, memory_order_relaxed)(s);
+}
@@ -0,0 +1,453 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  my_strstr.c — Substring Search in Linear Time
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Never look at the same byte twice for the same reason."
+ *
+ *  my_strstr_ref tries every start and can redo almost all of its work
+ *  at the next one: O(n·m). This file picks a strategy by needle
+ *  length instead:
+ *
+ *      m = 1     the byte itself: scan 16 bytes per step for it or '\0'
+ *      m <= 32   first/last-byte filter: 16 candidate starts per step,
+ *                full compare only where both ends match
+ *      m > 32    Two-Way: O(n + m) comparisons, O(1) memory, with the
+ *                same filter to jump between windows
+ *
+ *  A C haystack has no length, and measuring it first would make
+ *  my_strstr(huge, "x") scan all of huge even when "x" is at the front.
+ *  So the searches find the end LAZILY: the filter spots the '\0' in
+ *  blocks it loads anyway, and anything else checks (and remembers)
+ *  that no '\0' lies in h[0, need) before looking there.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "my_string.h"
+
+#if MY_STRING_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define NO_ASAN __attribute__((no_sanitize_address))
+#else
+#define NO_ASAN
+#endif
+
+/* Longest needle for the first/last-byte filter (its worst case is O(n·m)) */
+#define SHORT_NEEDLE 32
+
+/* Haystack bytes checked for '\0' per step of the lazy length */
+#define LOOKAHEAD 4096
+
+/* Smallest page size we assume: a block inside one page can't fault */
+#define PAGE_MIN 4096
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  scan — Find a Byte or the End
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Index of the first byte of s that is c or '\0', looking at no more
+ *  than limit bytes; limit if there's neither. With c = '\0' it is a
+ *  bounded my_strlen.
+ *
+ *  Aligned 16-byte blocks, so the my_strlen page rule applies: a block
+ *  may hold bytes past the '\0', but never bytes from the next page.
+ */
+#if MY_STRING_X86
+NO_ASAN
+static size_t scan(const unsigned char *s, unsigned char c, size_t limit)
+{
+    size_t skip = (uintptr_t)s & 15;
+    const unsigned char *p = (const unsigned char *)((uintptr_t)s - skip);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i want = _mm_set1_epi8((char)c);
+    __m128i v = _mm_load_si128((const __m128i *)(const void *)p);
+    unsigned mask;
+
+    /* Bytes before s belong to someone else: drop them */
+    mask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, zero),
+                                                    _mm_cmpeq_epi8(v, want)));
+    mask = (mask >> skip) << skip;
+
+    while (mask == 0) {
+        p += 16;
+        if ((size_t)((uintptr_t)p - (uintptr_t)s) >= limit) {
+            return limit;
+        }
+        v = _mm_load_si128((const __m128i *)(const void *)p);
+        mask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, zero),
+                                                        _mm_cmpeq_epi8(v, want)));
+    }
+
+    /* Unsigned wrap-around makes this right for the first block too */
+    size_t at = (size_t)((uintptr_t)p - (uintptr_t)s) + (unsigned)__builtin_ctz(mask);
+    return (at < limit) ? at : limit;
+}
+#else
+static size_t scan(const unsigned char *s, unsigned char c, size_t limit)
+{
+    size_t i = 0;
+
+    while (i < limit && s[i] != c && s[i] != '\0') {
+        i++;
+    }
+    return i;
+}
+#endif
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  The Lazy Haystack
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *      h → [ checked: no '\0' here ][ not looked at yet ...
+ *            ←────── known ───────→
+ *
+ *  available(need) is true when h[0, need) is all text. It only scans
+ *  when need passes known, and then at least LOOKAHEAD bytes further,
+ *  so the whole search does O(n / LOOKAHEAD) scans.
+ */
+typedef struct {
+    const unsigned char *h;
+    size_t known;               /* h[0, known) holds no '\0' */
+    int ended;                  /* h[known] is the '\0' */
+} haystack;
+
+static size_t grow_known(haystack *hs, size_t need)
+{
+    size_t want = need - hs->known;
+    size_t got;
+
+    if (want < LOOKAHEAD) {
+        want = LOOKAHEAD;
+    }
+    got = scan(hs->h + hs->known, '\0', want);
+    hs->known += got;
+    hs->ended = got < want;
+    return hs->known;
+}
+
+static inline int available(haystack *hs, size_t need)
+{
+    if (need <= hs->known) {
+        return 1;
+    }
+    return !hs->ended && need <= grow_known(hs, need);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Candidates — First and Last Byte Filter
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  For 16 starts at once, compare the byte where the needle would begin
+ *  AND the byte where it would end:
+ *
+ *      needle "quest" (m = 5)
+ *
+ *      h + i       → [ 16 bytes ] == 'q' ?  ─┐
+ *      h + i + 4   → [ 16 bytes ] == 't' ?  ─┴─ AND → candidate mask
+ *
+ *  Real text rarely matches both, so almost every block is two loads,
+ *  two compares and no candidates. The last few starts, near the '\0',
+ *  go one at a time.
+ */
+
+/* Move *at to the next start where both ends match; 0 if there's none */
+NO_ASAN
+static int next_candidate(haystack *hs, const unsigned char *n, size_t m, size_t *at)
+{
+    const unsigned char *h = hs->h;
+    size_t i = *at;
+
+#if MY_STRING_X86
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i first = _mm_set1_epi8((char)n[0]);
+    const __m128i last = _mm_set1_epi8((char)n[m - 1]);
+
+    /*
+     * Two blocks per step: 32 starts, one branch. The last-byte blocks
+     * q run contiguously through the haystack, so they also look for
+     * its '\0': no separate length scan. h[i, q) is checked text, so
+     * the first-byte blocks (which end before q's do) can't fault.
+     */
+    if (!available(hs, i + m - 1)) {
+        return 0;
+    }
+    for (;;) {
+        const unsigned char *p = h + i, *q = h + i + m - 1;
+        __m128i b0, b1, lo, hi;
+        uint32_t ends, mask;
+
+        /* A block reaching into the next page is safe only if no '\0' comes first */
+        if (((uintptr_t)q & (PAGE_MIN - 1)) > PAGE_MIN - 32) {
+            size_t z = scan(q, '\0', 32);
+
+            if (z < 32) {
+                hs->known = i + m - 1 + z;
+                hs->ended = 1;
+                break;
+            }
+        }
+
+        b0 = _mm_loadu_si128((const __m128i *)(const void *)q);
+        b1 = _mm_loadu_si128((const __m128i *)(const void *)(q + 16));
+        ends = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(b0, zero)) |
+               (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(b1, zero)) << 16;
+        if (ends != 0) {
+            hs->known = i + m - 1 + (unsigned)__builtin_ctz(ends);
+            hs->ended = 1;
+            break;                          /* The last few starts, below */
+        }
+
+        lo = _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)p), first),
+            _mm_cmpeq_epi8(b0, last));
+        hi = _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(p + 16)), first),
+            _mm_cmpeq_epi8(b1, last));
+        mask = (uint32_t)_mm_movemask_epi8(lo) | (uint32_t)_mm_movemask_epi8(hi) << 16;
+
+        if (mask != 0) {
+            if (hs->known < i + m - 1 + 32) {
+                hs->known = i + m - 1 + 32;
+            }
+            *at = i + (unsigned)__builtin_ctz(mask);
+            return 1;
+        }
+        i += 32;
+    }
+#endif
+
+    for (; available(hs, i + m); i++) {
+        if (h[i] == n[0] && h[i + m - 1] == n[m - 1]) {
+            *at = i;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ *  Short needles: each candidate costs one memcmp of the m - 2 bytes in
+ *  between. At worst every start is a candidate ("aaaa..." for "aa...a"),
+ *  O(n·m), which is why this is only for m <= SHORT_NEEDLE.
+ */
+static char *search_short(const unsigned char *h, const unsigned char *n, size_t m)
+{
+    haystack hs = { h, 0, 0 };
+    size_t j = 0;
+
+    while (next_candidate(&hs, n, m, &j)) {
+        if (memcmp(h + j + 1, n + 1, m - 2) == 0) {
+            return (char *)h + j;
+        }
+        j++;
+    }
+    return NULL;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Long Needles — Two-Way (Crochemore & Perrin, 1991)
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  Split the needle at a "critical position" into u · v:
+ *
+ *      needle = [ u ][ v ]
+ *                    ↑ suffix
+ *
+ *  At each window, match v left to right, then u right to left.
+ *
+ *    - v mismatches at v[k]:   slide by k + 1. The critical position
+ *                              guarantees no match starts in between.
+ *    - v matches, u doesn't:   slide by the needle's period p.
+ *
+ *  Every comparison either advances the match or slides the window, so
+ *  the total is O(n + m). When the needle IS periodic (u occurs again
+ *  p bytes later), a slide by p keeps m - p bytes already known to
+ *  match ("memory"), so they aren't compared twice.
+ *
+ *  The critical position is the later of two maximal suffixes: one
+ *  under the normal byte order, one under the reversed order.
+ */
+
+/*
+ * Start of the lexicographically largest suffix of x (under < or, with
+ * reverse, under >) and that suffix's period.
+ */
+static size_t max_suffix(const unsigned char *x, size_t m, int reverse, size_t *period)
+{
+    size_t ms = SIZE_MAX;       /* Candidate start - 1 (wraps to 0) */
+    size_t j = 0;               /* Start of the suffix being compared - 1 */
+    size_t k = 1;               /* Offset within the current period */
+    size_t p = 1;
+
+    while (j + k < m) {
+        unsigned char a = x[j + k];
+        unsigned char b = x[ms + k];
+
+        if (reverse ? (a > b) : (a < b)) {
+            j += k;                         /* Suffix at j + 1 is smaller */
+            k = 1;
+            p = j - ms;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            ms = j++;                       /* New, larger suffix */
+            k = p = 1;
+        }
+    }
+
+    *period = p;
+    return ms + 1;
+}
+
+static size_t critical_factorization(const unsigned char *n, size_t m, size_t *period)
+{
+    size_t p_fwd, p_rev;
+    size_t fwd = max_suffix(n, m, 0, &p_fwd);
+    size_t rev = max_suffix(n, m, 1, &p_rev);
+
+    if (fwd >= rev) {
+        *period = p_fwd;
+        return fwd;
+    }
+    *period = p_rev;
+    return rev;
+}
+
+/*
+ *  While nothing is remembered, any window that isn't a candidate would
+ *  mismatch and slide on anyway, so next_candidate jumps over them,
+ *  16 at a time. Skipping only ever moves forward: still O(n + m).
+ */
+static char *two_way(const unsigned char *h, const unsigned char *n, size_t m)
+{
+    haystack hs = { h, 0, 0 };
+    size_t period;
+    size_t suffix = critical_factorization(n, m, &period);
+    size_t j = 0;
+    size_t i;
+
+    if (memcmp(n, n + period, suffix) == 0) {
+        size_t memory = 0;          /* n[0, memory) known to match */
+
+        for (;;) {
+            if (memory == 0 ? !next_candidate(&hs, n, m, &j) : !available(&hs, j + m)) {
+                return NULL;
+            }
+
+            i = (suffix > memory) ? suffix : memory;
+            while (i < m && n[i] == h[j + i]) {
+                i++;
+            }
+            if (i < m) {
+                j += i - suffix + 1;
+                memory = 0;
+                continue;
+            }
+
+            i = suffix;
+            while (i > memory && n[i - 1] == h[j + i - 1]) {
+                i--;
+            }
+            if (i <= memory) {
+                return (char *)h + j;
+            }
+            j += period;
+            memory = m - period;
+        }
+    }
+
+    /* No long self-overlap: a safe slide is past the larger half */
+    period = ((suffix > m - suffix) ? suffix : m - suffix) + 1;
+
+    while (next_candidate(&hs, n, m, &j)) {
+        i = suffix;
+        while (i < m && n[i] == h[j + i]) {
+            i++;
+        }
+        if (i < m) {
+            j += i - suffix + 1;
+            continue;
+        }
+
+        i = suffix;
+        while (i > 0 && n[i - 1] == h[j + i - 1]) {
+            i--;
+        }
+        if (i == 0) {
+            return (char *)h + j;
+        }
+        j += period;
+    }
+    return NULL;
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Public Entry Points
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+char *my_strstr(const char *haystack, const char *needle)
+{
+    const unsigned char *h = (const unsigned char *)haystack;
+    const unsigned char *n = (const unsigned char *)needle;
+    size_t m;
+
+    if (n[0] == '\0') {
+        return (char *)haystack;
+    }
+    if (n[1] == '\0') {
+        size_t i = scan(h, n[0], SIZE_MAX);
+        return (h[i] != '\0') ? (char *)haystack + i : NULL;
+    }
+
+    m = my_strlen(needle);
+    if (m <= SHORT_NEEDLE) {
+        return search_short(h, n, m);
+    }
+    return two_way(h, n, m);
+}
+
+char *my_strstr_twoway(const char *haystack, const char *needle)
+{
+    size_t m = my_strlen(needle);
+
+    if (m == 0) {
+        return (char *)haystack;
+    }
+    return two_way((const unsigned char *)haystack, (const unsigned char *)needle, m);
+}
+
+static const my_strstr_impl STRSTR_IMPLS[] = {
+    { "ref",    my_strstr_ref },
+    { "twoway", my_strstr_twoway },
+    { "engine", my_strstr },
+};
+
+size_t my_strstr_impls(const my_strstr_impl **out)
+{
+    if (out != NULL) {
+        *out = STRSTR_IMPLS;
+    }
+    return sizeof(STRSTR_IMPLS) / sizeof(STRSTR_IMPLS[0]);
+}
@@ -0,0 +1,97 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  safe_str.c — Bounds-Checked Strings Implementation
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "A check you can afford is a check you'll keep."
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include <stdint.h>
+
+#include "my_string.h"
+#include "safe_str.h"
+
+error_t safe_strlen(const char *str, size_t max_len, size_t *out_len)
+{
+    size_t len;
+
+    if (str == NULL || out_len == NULL) {
+        return ERR_NULL_PTR;
+    }
+
+    /* Look at one byte more than max_len: it must be the '\0' */
+    len = my_strnlen(str, (max_len < SIZE_MAX) ? max_len + 1 : SIZE_MAX);
+    if (len > max_len) {
+        return ERR_OVERFLOW;
+    }
+
+    *out_len = len;
+    return ERR_OK;
+}
+
+/*
+ * copy_bounded — Copy src into dest[0..size), always terminating
+ *
+ * my_strncpy_len stops at room = size - 1 bytes. If it copied fewer,
+ * the '\0' came first and is already written. If it copied exactly
+ * room, src[room] (which exists: everything before it was non-'\0')
+ * says whether there was more.
+ *
+ *      size=8, src="Hello":          [ H e l l o \0 ? ? ]    OK
+ *      size=8, src="Hello, World!":  [ H e l l o ,   \0 ]    OVERFLOW
+ */
+static error_t copy_bounded(char *dest, size_t size, const char *src, size_t *out_len)
+{
+    size_t room = size - 1;
+    size_t len = my_strncpy_len(dest, src, room);
+    error_t err = ERR_OK;
+
+    if (len == room) {
+        dest[room] = '\0';
+        if (src[room] != '\0') {
+            err = ERR_OVERFLOW;
+        }
+    }
+
+    if (out_len != NULL) {
+        *out_len = len;
+    }
+    return err;
+}
+
+error_t safe_strcpy(char *dest, size_t dest_size, const char *src, size_t *out_len)
+{
+    if (dest == NULL || src == NULL) {
+        return ERR_NULL_PTR;
+    }
+    if (dest_size == 0) {
+        return ERR_INVALID_ARG;
+    }
+    return copy_bounded(dest, dest_size, src, out_len);
+}
+
+error_t safe_strcat(char *dest, size_t dest_size, const char *src, size_t *out_len)
+{
+    size_t at;
+    error_t err;
+
+    if (dest == NULL || src == NULL) {
+        return ERR_NULL_PTR;
+    }
+    if (dest_size == 0) {
+        return ERR_INVALID_ARG;
+    }
+
+    at = my_strnlen(dest, dest_size);
+    if (at == dest_size) {
+        return ERR_OUT_OF_BOUNDS;           /* dest isn't a string */
+    }
+
+    err = copy_bounded(dest + at, dest_size - at, src, out_len);
+    if (out_len != NULL) {
+        *out_len += at;
+    }
+    return err;
+}
@@ -0,0 +1,109 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  safe_str.h — Bounds-Checked Strings at Full Speed
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "A check you can afford is a check you'll keep."
+ *
+ *  Day 9's safe_strlen, day 12's safe_copy and day 13's safe_concat
+ *  each walked the bytes one at a time, and each measured the same
+ *  strings again. These do the same jobs on the wide primitives:
+ *
+ *      safe_strlen  → my_strnlen       (never looks past the limit)
+ *      safe_strcpy  → my_strncpy_len   (finds '\0' and copies in one pass)
+ *      safe_strcat  → my_strnlen on dest, then the same copy
+ *
+ *  Every call takes the SIZE of the destination buffer (sizeof(buf),
+ *  not the length of what's in it), and on success or truncation dest
+ *  is always terminated:
+ *
+ *      char buf[8];
+ *      safe_strcpy(buf, sizeof(buf), "Hello, World!", &len)
+ *          → ERR_OVERFLOW, buf = "Hello, ", len = 7
+ *
+ *  This is strlcpy/strlcat behaviour, with the outcome reported as an
+ *  error_t instead of a length to compare.
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#ifndef SAFE_STR_H
+#define SAFE_STR_H
+
+#include <stddef.h>  /* size_t */
+
+/**
+ * error_t - Result codes (the same set as day 9)
+ *
+ * (glibc declares its own error_t when _GNU_SOURCE is defined; don't
+ * define it in files that include this header.)
+ */
+typedef enum {
+    ERR_OK = 0,
+    ERR_NULL_PTR,
+    ERR_OUT_OF_BOUNDS,
+    ERR_INVALID_ARG,
+    ERR_OVERFLOW,
+    ERR_UNDERFLOW,
+    ERR_NOT_FOUND,
+    ERR_UNINITIALIZED
+} error_t;
+
+/**
+ * safe_strlen - Length of a string that must fit in max_len
+ *
+ * @param str:     String to measure (may be NULL)
+ * @param max_len: Longest acceptable length
+ * @param out_len: Receives the length (must not be NULL)
+ *
+ * @return: ERR_OK           *out_len = length
+ *          ERR_NULL_PTR     str or out_len is NULL
+ *          ERR_OVERFLOW     no '\0' within the first max_len + 1 bytes
+ *
+ * Reads at most max_len + 1 bytes (the characters and the '\0').
+ */
+error_t safe_strlen(const char *str, size_t max_len, size_t *out_len);
+
+/**
+ * safe_strcpy - Copy src into a buffer of dest_size bytes
+ *
+ * @param dest:      Destination buffer
+ * @param dest_size: Size of dest in bytes, including room for '\0'
+ * @param src:       Source string
+ * @param out_len:   Receives strlen(dest) afterwards (may be NULL)
+ *
+ * @return: ERR_OK           all of src copied
+ *          ERR_OVERFLOW     src didn't fit: dest holds its first
+ *                           dest_size - 1 bytes, terminated
+ *          ERR_NULL_PTR     dest or src is NULL (nothing written)
+ *          ERR_INVALID_ARG  dest_size is 0 (nothing written)
+ *
+ * Precondition: dest and src do not overlap
+ *
+ * Reads at most dest_size bytes of src; src needs no '\0' if it is at
+ * least that long. Never writes past dest[dest_size - 1], and (unlike
+ * strncpy) writes nothing after the '\0'.
+ */
+error_t safe_strcpy(char *dest, size_t dest_size, const char *src, size_t *out_len);
+
+/**
+ * safe_strcat - Append src to the string in a buffer of dest_size bytes
+ *
+ * @param dest:      Destination buffer holding a string
+ * @param dest_size: Size of dest in bytes, including room for '\0'
+ * @param src:       String to append
+ * @param out_len:   Receives strlen(dest) afterwards (may be NULL)
+ *
+ * @return: ERR_OK            all of src appended
+ *          ERR_OVERFLOW      src didn't fit: as much as fits was appended,
+ *                            dest is terminated
+ *          ERR_OUT_OF_BOUNDS dest has no '\0' within dest_size bytes
+ *                            (nothing written)
+ *          ERR_NULL_PTR      dest or src is NULL (nothing written)
+ *          ERR_INVALID_ARG   dest_size is 0 (nothing written)
+ *
+ * Precondition: dest and src do not overlap
+ */
+error_t safe_strcat(char *dest, size_t dest_size, const char *src, size_t *out_len);
+
+#endif /* SAFE_STR_H */
@@ -0,0 +1,333 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ *  HUNTER PROTOCOL 2.0 — DAY 11: STRINGS DEEP DIVE
+ *  test_hunter_str.c — hunter_str / hunter_builder Test Driver
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ *  "Test ruthlessly. Trust nothing."
+ *
+ *  Compile: gcc -Wall -Wextra -std=c17 -o test_hunter_str \
+ *               my_string.c my_string_simd.c hunter_str.c hunter_builder.c \
+ *               test_hunter_str.c
+ *  Run:     ./test_hunter_str
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#define _POSIX_C_SOURCE 200809L    /* fileno */
+
+#include <stdio.h>
+#include <string.h>  /* For comparing against standard library */
+#include <stdlib.h>
+#include "hunter_builder.h"
+#include "hunter_str.h"
+
+/* Test result tracking */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test assertion macro */
+#define TEST(condition, name) do { \
+    if (condition) { \
+        printf("  ✓ %s\n", name); \
+        tests_passed++; \
+    } else { \
+        printf("  ✗ %s — FAILED!\n", name); \
+        tests_failed++; \
+    } \
+} while (0)
+
+/* Test group header */
+#define TEST_GROUP(name) printf("\n━━━ %s ━━━\n", name)
+
+/* Text, length and terminator all agree with expected? */
+static int holds(const hunter_str *s, const char *expected)
+{
+    size_t n = strlen(expected);
+    return hunter_str_len(s) == n &&
+           memcmp(hunter_str_cstr(s), expected, n + 1) == 0;
+}
+
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Lifetime and Small-String Optimization
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_lifetime(void)
+{
+    TEST_GROUP("hunter_str lifetime");
+
+    hunter_str s = HUNTER_STR_EMPTY;
+    hunter_str t;
+
+    TEST(holds(&s, ""), "HUNTER_STR_EMPTY is \"\"");
+    hunter_str_init(&t);
+    TEST(holds(&t, "") && t.ptr == NULL, "init is \"\", no allocation");
+
+    /* 23 bytes fit inline, the 24th moves to the heap */
+    hunter_str_append_cstr(&s, "Shadow Monarch, rank S.");
+    TEST(holds(&s, "Shadow Monarch, rank S.") && s.ptr == NULL, "23 bytes stay inline");
+    hunter_str_append_char(&s, '!');
+    TEST(holds(&s, "Shadow Monarch, rank S.!") && s.ptr != NULL, "24th byte moves to heap");
+
+    hunter_str_clear(&s);
+    TEST(holds(&s, "") && s.cap >= 24, "clear keeps capacity");
+
+    hunter_str_free(&s);
+    TEST(holds(&s, "") && s.ptr == NULL, "free leaves a usable empty string");
+    hunter_str_append_cstr(&s, "again");
+    TEST(holds(&s, "again"), "reusable after free");
+
+    TEST(hunter_str_reserve(&s, 1000) == 0 && s.cap >= 1000 && holds(&s, "again"),
+         "reserve keeps text");
+    TEST(hunter_str_reserve(&s, (size_t)-1) == -1 && holds(&s, "again"),
+         "impossible reserve fails cleanly");
+
+    hunter_str_free(&s);
+    hunter_str_free(&t);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Building
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_building(void)
+{
+    TEST_GROUP("hunter_str building");
+
+    hunter_str s = HUNTER_STR_EMPTY;
+    static char expected[1 << 20];
+    size_t expected_len = 0;
+    size_t reallocs = 0;
+    char *last = NULL;
+    int ok = 1;
+
+    /* Many appends: same text as the C version, geometric growth */
+    for (int i = 0; i < 20000; i++) {
+        char word[32];
+        int n = snprintf(word, sizeof(word), "quest-%d ", i);
+
+        memcpy(expected + expected_len, word, (size_t)n + 1);
+        expected_len += (size_t)n;
+        if (hunter_str_append_cstr(&s, word) != 0) {
+            ok = 0;
+        }
+        if (s.ptr != last) {
+            reallocs++;
+            last = s.ptr;
+        }
+    }
+    TEST(ok && holds(&s, expected), "20000 appends match the C string");
+    TEST(reallocs < 20, "buffer grows geometrically (few reallocations)");
+
+    /* Assign replaces, append_char adds */
+    hunter_str_assign(&s, hunter_view_of("ARISE"));
+    hunter_str_append_char(&s, '!');
+    TEST(holds(&s, "ARISE!"), "assign then append_char");
+
+    /* Appending a slice of itself, across the inline → heap move */
+    hunter_str_free(&s);
+    hunter_str_append_cstr(&s, "0123456789");
+    hunter_str_append(&s, hunter_str_view(&s));
+    hunter_str_append(&s, hunter_str_slice(&s, 5, 10));
+    TEST(holds(&s, "01234567890123456789" "5678901234"), "append a slice of itself");
+
+    /* Assigning a slice of itself (overlapping, on the heap) */
+    hunter_str_assign(&s, hunter_str_slice(&s, 2, 20));
+    TEST(holds(&s, "23456789012345678956"), "assign a slice of itself");
+
+    hunter_str_free(&s);
+}
+
+void test_appendf(void)
+{
+    TEST_GROUP("hunter_str_appendf");
+
+    hunter_str s = HUNTER_STR_EMPTY;
+    char big[512];
+    const char *out;
+
+    hunter_str_appendf(&s, "Day %d: %s", 11, "Strings");
+    TEST(holds(&s, "Day 11: Strings") && s.ptr == NULL, "formats in place");
+
+    hunter_str_appendf(&s, " (+%u XP)", 150u);
+    TEST(holds(&s, "Day 11: Strings (+150 XP)"), "appends and grows");
+
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    hunter_str_clear(&s);
+    hunter_str_appendf(&s, "[%s]", big);
+    out = hunter_str_cstr(&s);
+    TEST(hunter_str_len(&s) == sizeof(big) + 1 &&
+         out[0] == '[' && out[sizeof(big)] == ']' && out[sizeof(big) + 1] == '\0',
+         "output larger than capacity");
+
+    hunter_str_appendf(&s, "%s", "");
+    TEST(hunter_str_len(&s) == sizeof(big) + 1, "empty output adds nothing");
+
+    hunter_str_free(&s);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Views
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_views(void)
+{
+    TEST_GROUP("hunter_view");
+
+    hunter_str s = HUNTER_STR_EMPTY;
+    hunter_view v;
+    int ok = 1;
+
+    hunter_str_append_cstr(&s, "Igris the Blood-Red");
+
+    v = hunter_str_slice(&s, 6, 3);
+    TEST(v.len == 3 && memcmp(v.ptr, "the", 3) == 0 &&
+         v.ptr == hunter_str_cstr(&s) + 6, "slice is a view, not a copy");
+
+    v = hunter_str_slice(&s, 10, 1000);
+    TEST(v.len == 9 && memcmp(v.ptr, "Blood-Red", 9) == 0, "slice clamps length");
+    v = hunter_str_slice(&s, 1000, 5);
+    TEST(v.len == 0, "slice past the end is empty");
+    v = hunter_view_slice(hunter_view_of("Beru"), 1, 2);
+    TEST(v.len == 2 && memcmp(v.ptr, "er", 2) == 0, "slice of a view");
+
+    TEST(hunter_view_eq(hunter_str_slice(&s, 0, 5), hunter_view_of("Igris")),
+         "eq on equal bytes");
+    TEST(!hunter_view_eq(hunter_view_of("Igris"), hunter_view_of("Igri")),
+         "eq checks length");
+
+    /* cmp agrees with strcmp in sign, including high bytes and prefixes */
+    for (int trial = 0; trial < 20000; trial++) {
+        char a[16], b[16];
+        size_t la = (size_t)rand() % 8, lb = (size_t)rand() % 8;
+
+        for (size_t i = 0; i < la; i++) {
+            a[i] = (char)(1 + rand() % 3 * 127);
+        }
+        for (size_t i = 0; i < lb; i++) {
+            b[i] = (char)(1 + rand() % 3 * 127);
+        }
+        a[la] = '\0';
+        b[lb] = '\0';
+        if (sign(hunter_view_cmp(hunter_view_of(a), hunter_view_of(b))) !=
+            sign(strcmp(a, b))) {
+            ok = 0;
+        }
+    }
+    TEST(ok, "cmp matches strcmp sign");
+    TEST(hunter_view_cmp(hunter_view_of("ab"), hunter_view_of("abc")) < 0,
+         "proper prefix sorts first");
+
+    hunter_str_free(&s);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  hunter_builder
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_builder(void)
+{
+    TEST_GROUP("hunter_builder");
+
+    hunter_builder b = HUNTER_BUILDER_EMPTY;
+    hunter_str want = HUNTER_STR_EMPTY;
+    hunter_str got = HUNTER_STR_EMPTY;
+    static char piece[3 * HUNTER_BUILDER_MAX_CHUNK];
+    FILE *f;
+    int ok = 1;
+
+    TEST(hunter_builder_len(&b) == 0 && b.chunks == 0, "empty builder allocates nothing");
+
+    /* Random pieces, some bigger than a whole chunk, mixed with appendf */
+    for (size_t i = 0; i < sizeof(piece); i++) {
+        piece[i] = (char)('a' + i % 26);
+    }
+    for (int i = 0; i < 3000; i++) {
+        size_t len = (i % 500 == 0) ? (size_t)rand() % sizeof(piece) : (size_t)rand() % 3000;
+        hunter_view v = { piece + rand() % 26, len > sizeof(piece) - 26 ? sizeof(piece) - 26 : len };
+
+        if (i % 3 == 0) {
+            ok &= hunter_builder_appendf(&b, "[quest %d: %.*s]", i, (int)(v.len % 5000), v.ptr) == 0;
+            ok &= hunter_str_appendf(&want, "[quest %d: %.*s]", i, (int)(v.len % 5000), v.ptr) == 0;
+        } else {
+            ok &= hunter_builder_append(&b, v) == 0;
+            ok &= hunter_str_append(&want, v) == 0;
+        }
+        if (hunter_builder_len(&b) != hunter_str_len(&want)) {
+            ok = 0;
+        }
+    }
+    TEST(ok, "length tracked across appends and appendf");
+
+    hunter_str_append_cstr(&got, "prefix:");
+    TEST(hunter_builder_flatten(&b, &got) == 0 &&
+         hunter_str_len(&got) == 7 + hunter_str_len(&want) &&
+         memcmp(hunter_str_cstr(&got) + 7, hunter_str_cstr(&want), hunter_str_len(&want) + 1) == 0,
+         "flatten appends the exact bytes");
+    TEST(b.chunks < 64, "chunks grow (few of them)");
+
+    /* writev to a file and read it back */
+    f = tmpfile();
+    if (f != NULL) {
+        hunter_str_clear(&got);
+        ok = hunter_builder_write(&b, fileno(f)) == 0 &&
+             hunter_str_reserve(&got, hunter_builder_len(&b)) == 0;
+        rewind(f);
+        got.len = ok ? fread(got.ptr, 1, hunter_builder_len(&b) + 1, f) : 0;
+        got.ptr[got.len] = '\0';
+        fclose(f);
+        TEST(ok && hunter_view_eq(hunter_str_view(&got), hunter_str_view(&want)),
+             "write produces the exact bytes");
+    } else {
+        TEST(0, "write produces the exact bytes (no tmpfile)");
+    }
+
+    hunter_builder_free(&b);
+    TEST(hunter_builder_len(&b) == 0 && b.head == NULL, "free leaves an empty builder");
+    hunter_builder_appendf(&b, "%s", "");
+    TEST(hunter_builder_len(&b) == 0 && b.chunks == 0, "empty appendf allocates nothing");
+
+    hunter_builder_free(&b);
+    hunter_str_free(&want);
+    hunter_str_free(&got);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Main
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+int main(void)
+{
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════════╗\n");
+    printf("║  HUNTER PROTOCOL 2.0 — DAY 11: HUNTER_STR TESTS               ║\n");
+    printf("╚═══════════════════════════════════════════════════════════════╝\n");
+
+    test_lifetime();
+    test_building();
+    test_appendf();
+    test_views();
+    test_builder();
+
+    printf("\n");
+    printf("═══════════════════════════════════════════════════════════════\n");
+    printf("  RESULTS: %d passed, %d failed\n", tests_passed, tests_failed);
+    printf("═══════════════════════════════════════════════════════════════\n");
+
+    return tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
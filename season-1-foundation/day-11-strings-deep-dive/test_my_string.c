@@ -7,16 +7,23 @@
  *  "Test ruthlessly. Trust nothing."
  *
  *  Compile: gcc -Wall -Wextra -std=c17 -o test_strings \
- *               my_string.c test_my_string.c
+ *               my_string.c my_string_simd.c my_strstr.c my_matcher.c \
+ *               test_my_string.c
  *  Run:     ./test_strings
  *  Valgrind: valgrind --leak-check=full ./test_strings
  * ═══════════════════════════════════════════════════════════════════════════
  */
 
+#define _DEFAULT_SOURCE      /* MAP_ANONYMOUS */
+
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>  /* For comparing against standard library */
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "my_string.h"
+#include "safe_str.h"
 
 /* Test result tracking */
 static int tests_passed = 0;
@@ -37,6 +44,57 @@ static int tests_failed = 0;
 #define TEST_GROUP(name) printf("\n━━━ %s ━━━\n", name)
 
 
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Fuzz Helpers
+ * ──────────────────────────────────────────────────────────────────────────
+ *
+ *  The wide implementations read ahead of the byte they're looking at.
+ *  A GUARD PAGE turns any read past the end of the string's page into
+ *  an immediate crash instead of a silent bug:
+ *
+ *      [ page: string ends on the very last byte ][ PROT_NONE ]
+ *                                              ↑
+ *                                 one byte further → SIGSEGV
+ */
+static size_t page_size(void)
+{
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+/* One read/write page followed by an inaccessible one (NULL on failure) */
+static unsigned char *guarded_page(void)
+{
+    size_t page = page_size();
+    unsigned char *p = mmap(NULL, 2 * page, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+    if (mprotect(p + page, page, PROT_NONE) != 0) {
+        munmap(p, 2 * page);
+        return NULL;
+    }
+    return p;
+}
+
+static void guarded_page_free(unsigned char *p)
+{
+    if (p != NULL) {
+        munmap(p, 2 * page_size());
+    }
+}
+
+/* Random non-NUL bytes, including 0x80-0xFF (they trip naive bit tricks) */
+static void fill_random(unsigned char *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        p[i] = (unsigned char)(1 + rand() % 255);
+    }
+}
+
+
 /*
  * ──────────────────────────────────────────────────────────────────────────
  *  strlen Tests
@@ -65,6 +123,109 @@ void test_strlen(void)
     }
 }
 
+void test_strlen_variants(void)
+{
+    TEST_GROUP("my_strlen variants");
+
+    const my_strlen_impl *impls;
+    size_t count = my_strlen_impls(&impls);
+    unsigned char *page = guarded_page();
+    size_t size = page_size();
+    unsigned char buf[512];
+
+    printf("  (my_strlen dispatches to: %s)\n", my_strlen_selected());
+
+    for (size_t v = 0; v < count; v++) {
+        size_t (*fn)(const char *) = impls[v].fn;
+        int aligned_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Every start alignment within 64 bytes, every length up to 300 */
+        for (size_t off = 0; off < 64; off++) {
+            for (size_t len = 0; len <= 300; len++) {
+                fill_random(buf, sizeof(buf));
+                buf[off + len] = '\0';
+                if (fn((const char *)buf + off) != strlen((const char *)buf + off)) {
+                    aligned_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches strlen at all alignments", impls[v].name);
+        TEST(aligned_ok, name);
+
+        /* Terminator on the last byte before the guard page */
+        if (page != NULL) {
+            for (size_t len = 0; len <= 300; len++) {
+                unsigned char *s = page + size - 1 - len;
+                fill_random(page, size - 1);
+                page[size - 1] = '\0';
+                if (fn((const char *)s) != len) {
+                    page_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: never reads past the page", impls[v].name);
+        TEST(page != NULL && page_ok, name);
+    }
+
+    TEST(my_strlen("dispatch") == 8, "dispatched my_strlen works");
+
+    guarded_page_free(page);
+}
+
+void test_strnlen_variants(void)
+{
+    TEST_GROUP("my_strnlen variants");
+
+    const my_strnlen_impl *impls;
+    size_t count = my_strnlen_impls(&impls);
+    unsigned char *page = guarded_page();
+    size_t size = page_size();
+    unsigned char buf[512];
+
+    for (size_t v = 0; v < count; v++) {
+        size_t (*fn)(const char *, size_t) = impls[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* '\0' before, at, and after maxlen, at every alignment */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t off = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            size_t maxlen = (size_t)rand() % 320;
+            size_t want = (len < maxlen) ? len : maxlen;
+
+            fill_random(buf, sizeof(buf));
+            buf[off + len] = '\0';
+            if (fn((const char *)buf + off, maxlen) != want) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: min(strlen, maxlen)", impls[v].name);
+        TEST(random_ok, name);
+
+        /* maxlen bytes with no '\0', ending at the guard page */
+        if (page != NULL) {
+            for (size_t n = 0; n <= 300; n++) {
+                fill_random(page + size - n, n);
+                if (fn((const char *)page + size - n, n) != n) {
+                    page_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: unterminated array, never past maxlen's page",
+                 impls[v].name);
+        TEST(page != NULL && page_ok, name);
+    }
+
+    TEST(my_strnlen("hunter", 3) == 3 && my_strnlen("hunter", 100) == 6,
+         "dispatched my_strnlen works");
+
+    guarded_page_free(page);
+}
+
 
 /*
  * ──────────────────────────────────────────────────────────────────────────
@@ -211,6 +372,145 @@ void test_strncmp(void)
          "matches stdlib n=3 (sign)");
 }
 
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+/*
+ * Random pair at offsets oa/ob: a is len bytes; b is a copy that then
+ * differs at a random spot, ends early, or doesn't differ at all.
+ */
+static void random_pair(unsigned char *a, unsigned char *b, size_t len)
+{
+    size_t at = (len > 0) ? (size_t)rand() % len : 0;
+
+    fill_random(a, len);
+    a[len] = '\0';
+    memcpy(b, a, len + 1);
+
+    switch (rand() % 4) {
+    case 0:                                     /* Equal */
+        break;
+    case 1:                                     /* Differ (maybe b ends) */
+        b[at] = (unsigned char)(a[at] + 1 + rand() % 255);
+        break;
+    case 2:                                     /* a ends early */
+        a[at] = '\0';
+        break;
+    default:                                    /* b ends early */
+        b[at] = '\0';
+        break;
+    }
+}
+
+void test_strcmp_variants(void)
+{
+    TEST_GROUP("my_strcmp / my_strncmp variants");
+
+    const my_strcmp_impl *cmp;
+    const my_strncmp_impl *ncmp;
+    size_t count = my_strcmp_impls(&cmp);
+    size_t ncount = my_strncmp_impls(&ncmp);
+    unsigned char *pa = guarded_page();
+    unsigned char *pb = guarded_page();
+    size_t size = page_size();
+    unsigned char bufa[512], bufb[512];
+
+    for (size_t v = 0; v < count; v++) {
+        int (*fn)(const char *, const char *) = cmp[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Random contents, every pair of alignments mod 64 eventually */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t oa = (size_t)rand() % 64, ob = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            const char *a = (const char *)bufa + oa, *b = (const char *)bufb + ob;
+
+            random_pair(bufa + oa, bufb + ob, len);
+            if (fn(a, b) != my_strcmp_ref(a, b) ||
+                sign(fn(a, b)) != sign(strcmp(a, b))) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches reference and strcmp", cmp[v].name);
+        TEST(random_ok, name);
+
+        /* Equal prefixes run right up to both guard pages */
+        if (pa != NULL && pb != NULL) {
+            for (size_t la = 0; la <= 200; la++) {
+                for (size_t lb = (la > 40) ? la - 40 : 0; lb <= la; lb++) {
+                    unsigned char *a = pa + size - 1 - la;
+                    unsigned char *b = pb + size - 1 - lb;
+
+                    fill_random(a, la);
+                    pa[size - 1] = '\0';
+                    memcpy(b, a, lb);
+                    pb[size - 1] = '\0';
+                    if (sign(fn((const char *)a, (const char *)b)) != (la > lb) ||
+                        sign(fn((const char *)b, (const char *)a)) != -(la > lb)) {
+                        page_ok = 0;
+                    }
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: never reads past the page", cmp[v].name);
+        TEST(pa != NULL && pb != NULL && page_ok, name);
+    }
+
+    for (size_t v = 0; v < ncount; v++) {
+        int (*fn)(const char *, const char *, size_t) = ncmp[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t oa = (size_t)rand() % 64, ob = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            size_t n = (size_t)rand() % (len + 40);
+            const char *a = (const char *)bufa + oa, *b = (const char *)bufb + ob;
+
+            random_pair(bufa + oa, bufb + ob, len);
+            if (fn(a, b, n) != my_strncmp_ref(a, b, n) ||
+                sign(fn(a, b, n)) != sign(strncmp(a, b, n))) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches reference and strncmp", ncmp[v].name);
+        TEST(random_ok, name);
+
+        /* n bytes without a '\0', ending exactly at both guard pages */
+        if (pa != NULL && pb != NULL) {
+            for (size_t n = 0; n <= 200; n++) {
+                unsigned char *a = pa + size - n;
+                unsigned char *b = pb + size - n;
+
+                fill_random(a, n);
+                memcpy(b, a, n);
+                if (fn((const char *)a, (const char *)b, n) != 0) {
+                    page_ok = 0;
+                }
+                if (n > 0) {
+                    b[n - 1] = (unsigned char)(a[n - 1] + 1 + rand() % 255);
+                    if (fn((const char *)a, (const char *)b, n) != a[n - 1] - b[n - 1]) {
+                        page_ok = 0;
+                    }
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: stops at n, never past the page", ncmp[v].name);
+        TEST(pa != NULL && pb != NULL && page_ok, name);
+    }
+
+    TEST(my_strcmp("gate", "game") > 0, "dispatched my_strcmp works");
+    TEST(my_strncmp("gate", "game", 2) == 0, "dispatched my_strncmp works");
+
+    guarded_page_free(pa);
+    guarded_page_free(pb);
+}
+
 
 /*
  * ──────────────────────────────────────────────────────────────────────────
@@ -251,6 +551,720 @@ void test_strcat(void)
     TEST(strcmp(dest, "one two") == 0, "multiple concats");
 }
 
+/* Bytes dest[from..to) still hold the 0xA5 canary? */
+static int canary_intact(const unsigned char *d, size_t from, size_t to)
+{
+    for (size_t i = from; i < to; i++) {
+        if (d[i] != 0xA5) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void test_copy_variants(void)
+{
+    TEST_GROUP("my_strcpy / my_strncpy / my_strcat variants");
+
+    const my_strcpy_impl *cpy, *cat;
+    const my_strncpy_impl *ncpy;
+    size_t count = my_strcpy_impls(&cpy);
+    size_t ncount = my_strncpy_impls(&ncpy);
+    size_t catcount = my_strcat_impls(&cat);
+    unsigned char *ps = guarded_page();
+    unsigned char *pd = guarded_page();
+    size_t size = page_size();
+    unsigned char src[512], dst[1024], want[1024];
+
+    for (size_t v = 0; v < count; v++) {
+        char *(*fn)(char *restrict, const char *restrict) = cpy[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Exact copy, nothing written past the '\0' */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t os = (size_t)rand() % 64, od = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            char *d = (char *)dst + od;
+
+            fill_random(src + os, len);
+            src[os + len] = '\0';
+            memset(dst, 0xA5, sizeof(dst));
+            if (fn(d, (const char *)src + os) != d ||
+                memcmp(d, src + os, len + 1) != 0 ||
+                !canary_intact(dst, 0, od) ||
+                !canary_intact(dst, od + len + 1, sizeof(dst))) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: exact copy, no overrun", cpy[v].name);
+        TEST(random_ok, name);
+
+        /* src ends at one guard page, dest at the other */
+        if (ps != NULL && pd != NULL) {
+            for (size_t len = 0; len <= 300; len++) {
+                unsigned char *s = ps + size - 1 - len;
+                unsigned char *d = pd + size - 1 - len;
+
+                fill_random(s, len);
+                ps[size - 1] = '\0';
+                fn((char *)d, (const char *)s);
+                if (memcmp(d, s, len + 1) != 0) {
+                    page_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: never reads or writes past the page", cpy[v].name);
+        TEST(ps != NULL && pd != NULL && page_ok, name);
+    }
+
+    for (size_t v = 0; v < ncount; v++) {
+        char *(*fn)(char *restrict, const char *restrict, size_t) = ncpy[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Same bytes as the reference, including padding and no overrun */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t os = (size_t)rand() % 64, od = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            size_t n = (size_t)rand() % (len + 300);
+            char *d = (char *)dst + od;
+
+            fill_random(src + os, len);
+            src[os + len] = '\0';
+            memset(dst, 0xA5, sizeof(dst));
+            memset(want, 0xA5, sizeof(want));
+            my_strncpy_ref((char *)want + od, (const char *)src + os, n);
+            if (fn(d, (const char *)src + os, n) != d ||
+                memcmp(dst, want, sizeof(dst)) != 0) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches reference, pads, no overrun", ncpy[v].name);
+        TEST(random_ok, name);
+
+        /* n bytes with no '\0', ending at both guard pages */
+        if (ps != NULL && pd != NULL) {
+            for (size_t n = 0; n <= 300; n++) {
+                unsigned char *s = ps + size - n;
+                unsigned char *d = pd + size - n;
+
+                fill_random(s, n);
+                fn((char *)d, (const char *)s, n);
+                if (memcmp(d, s, n) != 0) {
+                    page_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: stops at n, never past the page", ncpy[v].name);
+        TEST(ps != NULL && pd != NULL && page_ok, name);
+    }
+
+    for (size_t v = 0; v < catcount; v++) {
+        char *(*fn)(char *restrict, const char *restrict) = cat[v].fn;
+        int random_ok = 1;
+        char name[96];
+
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t os = (size_t)rand() % 64, od = (size_t)rand() % 64;
+            size_t head = (size_t)rand() % 300, len = (size_t)rand() % 300;
+            char *d = (char *)dst + od;
+
+            fill_random(src + os, len);
+            src[os + len] = '\0';
+            memset(dst, 0xA5, sizeof(dst));
+            fill_random(dst + od, head);
+            dst[od + head] = '\0';
+            memcpy(want, dst, sizeof(want));
+            my_strcat_ref((char *)want + od, (const char *)src + os);
+            if (fn(d, (const char *)src + os) != d ||
+                memcmp(dst, want, sizeof(dst)) != 0) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches reference, no overrun", cat[v].name);
+        TEST(random_ok, name);
+    }
+
+    const my_strncpy_len_impl *nlen;
+    size_t lencount = my_strncpy_len_impls(&nlen);
+
+    for (size_t v = 0; v < lencount; v++) {
+        size_t (*fn)(char *restrict, const char *restrict, size_t) = nlen[v].fn;
+        int random_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Copies min(len, n) bytes, a '\0' only if len < n, nothing more */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t os = (size_t)rand() % 64, od = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            size_t n = (size_t)rand() % 320;
+            size_t want = (len < n) ? len : n;
+            char *d = (char *)dst + od;
+
+            fill_random(src + os, len);
+            src[os + len] = '\0';
+            memset(dst, 0xA5, sizeof(dst));
+            if (fn(d, (const char *)src + os, n) != want ||
+                memcmp(d, src + os, want) != 0 ||
+                (want < n && d[want] != '\0') ||
+                !canary_intact(dst, 0, od) ||
+                !canary_intact(dst, od + want + (want < n), sizeof(dst))) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: copies, terminates only below n, no overrun",
+                 nlen[v].name);
+        TEST(random_ok, name);
+
+        if (ps != NULL && pd != NULL) {
+            for (size_t n = 0; n <= 300; n++) {
+                unsigned char *s = ps + size - n;
+                unsigned char *d = pd + size - n;
+
+                fill_random(s, n);
+                if (fn((char *)d, (const char *)s, n) != n || memcmp(d, s, n) != 0) {
+                    page_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: stops at n, never past the page", nlen[v].name);
+        TEST(ps != NULL && pd != NULL && page_ok, name);
+    }
+
+    guarded_page_free(ps);
+    guarded_page_free(pd);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  safe_str Tests
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_safe_str(void)
+{
+    TEST_GROUP("safe_str");
+
+    char buf[8], big[16];
+    size_t len = 99;
+
+    /* safe_strlen: day 9's cases */
+    TEST(safe_strlen("hello", 100, &len) == ERR_OK && len == 5, "safe_strlen: \"hello\" is 5");
+    TEST(safe_strlen("", 100, &len) == ERR_OK && len == 0, "safe_strlen: empty is 0");
+    TEST(safe_strlen("abc", 3, &len) == ERR_OK && len == 3, "safe_strlen: length == max_len is OK");
+    TEST(safe_strlen("this is long", 4, &len) == ERR_OVERFLOW, "safe_strlen: too long → ERR_OVERFLOW");
+    TEST(safe_strlen(NULL, 100, &len) == ERR_NULL_PTR, "safe_strlen: NULL string");
+    TEST(safe_strlen("test", 100, NULL) == ERR_NULL_PTR, "safe_strlen: NULL out_len");
+    TEST(safe_strlen("test", SIZE_MAX, &len) == ERR_OK && len == 4, "safe_strlen: max_len SIZE_MAX");
+
+    /* safe_strcpy: day 12's cases */
+    TEST(safe_strcpy(buf, sizeof(buf), "hello", &len) == ERR_OK &&
+         strcmp(buf, "hello") == 0 && len == 5, "safe_strcpy: fits");
+    TEST(safe_strcpy(buf, sizeof(buf), "Hello, World!!", &len) == ERR_OVERFLOW &&
+         strcmp(buf, "Hello, ") == 0 && len == 7, "safe_strcpy: truncated and terminated");
+    TEST(safe_strcpy(buf, sizeof(buf), "1234567", &len) == ERR_OK &&
+         strcmp(buf, "1234567") == 0 && len == 7, "safe_strcpy: exactly fills the buffer");
+    TEST(safe_strcpy(buf, sizeof(buf), "", NULL) == ERR_OK && buf[0] == '\0',
+         "safe_strcpy: empty source, out_len optional");
+    TEST(safe_strcpy(buf, 1, "x", &len) == ERR_OVERFLOW && buf[0] == '\0' && len == 0,
+         "safe_strcpy: size 1 holds only '\\0'");
+    buf[0] = 'k';
+    TEST(safe_strcpy(buf, 0, "x", &len) == ERR_INVALID_ARG && buf[0] == 'k',
+         "safe_strcpy: size 0 → ERR_INVALID_ARG, untouched");
+    TEST(safe_strcpy(NULL, 8, "x", &len) == ERR_NULL_PTR &&
+         safe_strcpy(buf, 8, NULL, &len) == ERR_NULL_PTR, "safe_strcpy: NULL pointers");
+
+    /* safe_strcat: day 13's cases */
+    strcpy(big, "Hello");
+    TEST(safe_strcat(big, 12, " World", &len) == ERR_OK &&
+         strcmp(big, "Hello World") == 0 && len == 11, "safe_strcat: fits exactly");
+    strcpy(buf, "Hello");
+    TEST(safe_strcat(buf, sizeof(buf), " World!", &len) == ERR_OVERFLOW &&
+         strcmp(buf, "Hello W") == 0 && len == 7, "safe_strcat: truncated and terminated");
+    TEST(safe_strcat(buf, sizeof(buf), "!", &len) == ERR_OVERFLOW &&
+         strcmp(buf, "Hello W") == 0 && len == 7, "safe_strcat: already full");
+    strcpy(buf, "");
+    TEST(safe_strcat(buf, sizeof(buf), "", &len) == ERR_OK && len == 0,
+         "safe_strcat: empty onto empty");
+    memset(buf, 'x', sizeof(buf));
+    TEST(safe_strcat(buf, sizeof(buf), "y", &len) == ERR_OUT_OF_BOUNDS &&
+         buf[sizeof(buf) - 1] == 'x', "safe_strcat: unterminated dest → ERR_OUT_OF_BOUNDS");
+
+    /* Random: same as a plain bounded loop, never past dest_size */
+    unsigned char src[300], dst[400], want[400];
+    int random_ok = 1;
+
+    for (int trial = 0; trial < 20000; trial++) {
+        size_t slen = (size_t)rand() % 200, head = (size_t)rand() % 100;
+        size_t size = 1 + (size_t)rand() % 300;
+        int cat = rand() % 2;
+        size_t at = cat ? ((head < size) ? head : size - 1) : 0;
+        size_t room = size - 1 - at;
+        size_t copy = (slen < room) ? slen : room;
+        error_t err;
+
+        fill_random(src, slen);
+        src[slen] = '\0';
+        memset(dst, 0xA5, sizeof(dst));
+        fill_random(dst, at);
+        dst[at] = '\0';
+        memcpy(want, dst, sizeof(want));
+        memcpy(want + at, src, copy);
+        want[at + copy] = '\0';
+
+        err = cat ? safe_strcat((char *)dst, size, (const char *)src, &len)
+                  : safe_strcpy((char *)dst, size, (const char *)src, &len);
+        if (err != ((slen > room) ? ERR_OVERFLOW : ERR_OK) ||
+            len != at + copy ||
+            memcmp(dst, want, sizeof(dst)) != 0) {
+            random_ok = 0;
+        }
+    }
+    TEST(random_ok, "safe_strcpy / safe_strcat: match a byte loop, no overrun");
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  strrev Tests
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_strrev(void)
+{
+    TEST_GROUP("my_strrev");
+
+    char a[] = "Arise";
+    char b[] = "";
+    char c[] = "x";
+    char d[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+    TEST(strcmp(my_strrev(a), "esirA") == 0, "reverses \"Arise\"");
+    TEST(my_strrev(b) == b && b[0] == '\0', "empty string unchanged");
+    TEST(strcmp(my_strrev(c), "x") == 0, "single char unchanged");
+    TEST(strcmp(my_strrev(d), "9876543210zyxwvutsrqponmlkjihgfedcba") == 0,
+         "36 chars (crosses a block boundary)");
+
+    const my_strrev_impl *impls;
+    size_t count = my_strrev_impls(&impls);
+    unsigned char buf[400], want[400];
+
+    for (size_t v = 0; v < count; v++) {
+        char *(*fn)(char *) = impls[v].fn;
+        int random_ok = 1;
+        char name[96];
+
+        /* Every length up to a few blocks, at every alignment */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t off = (size_t)rand() % 64;
+            size_t len = (size_t)rand() % 300;
+            char *str = (char *)buf + off;
+
+            memset(buf, 0xA5, sizeof(buf));
+            fill_random(buf + off, len);
+            buf[off + len] = '\0';
+            memcpy(want, buf, sizeof(want));
+            for (size_t i = 0; i < len; i++) {
+                want[off + i] = buf[off + len - 1 - i];
+            }
+            if (fn(str) != str || memcmp(buf, want, sizeof(buf)) != 0) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: reversed, nothing else touched", impls[v].name);
+        TEST(random_ok, name);
+    }
+}
+
+/* Random valid UTF-8: ASCII and 2/3/4-byte characters */
+static size_t random_utf8(unsigned char *p, size_t chars)
+{
+    size_t n = 0;
+
+    for (size_t i = 0; i < chars; i++) {
+        unsigned long cp;
+
+        switch (rand() % 4) {
+        case 0:  cp = 1 + (unsigned long)rand() % 0x7F; break;
+        case 1:  cp = 0x80 + (unsigned long)rand() % (0x800 - 0x80); break;
+        case 2:  cp = 0x800 + (unsigned long)rand() % (0xD800 - 0x800); break;
+        default: cp = 0x10000 + (unsigned long)rand() % (0x110000 - 0x10000); break;
+        }
+
+        if (cp < 0x80) {
+            p[n++] = (unsigned char)cp;
+        } else if (cp < 0x800) {
+            p[n++] = (unsigned char)(0xC0 | (cp >> 6));
+            p[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            p[n++] = (unsigned char)(0xE0 | (cp >> 12));
+            p[n++] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+            p[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+        } else {
+            p[n++] = (unsigned char)(0xF0 | (cp >> 18));
+            p[n++] = (unsigned char)(0x80 | ((cp >> 12) & 0x3F));
+            p[n++] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+            p[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+        }
+    }
+    p[n] = '\0';
+    return n;
+}
+
+void test_strrev_utf8(void)
+{
+    TEST_GROUP("my_strrev_utf8");
+
+    char korean[] = "성진우";
+    char emoji[] = "a\xF0\x9F\x98\x80" "b";         /* a😀b */
+    char spanish[] = "\xC3\x91" "and\xC3\xBA";      /* Ñandú */
+    char ascii[] = "Shadow Monarch";
+    char stray[] = "a\x80\xBF" "b\xC3";               /* Not UTF-8 */
+
+    TEST(strcmp(my_strrev_utf8(korean), "우진성") == 0, "3-byte characters kept whole");
+    TEST(strcmp(my_strrev_utf8(emoji), "b\xF0\x9F\x98\x80" "a") == 0,
+         "4-byte character kept whole");
+    TEST(strcmp(my_strrev_utf8(spanish), "\xC3\xBA" "dna\xC3\x91") == 0,
+         "2-byte characters kept whole");
+    TEST(strcmp(my_strrev_utf8(ascii), "hcranoM wodahS") == 0, "ASCII same as my_strrev");
+    TEST(strcmp(my_strrev_utf8(stray), "\xC3" "b\xBF\x80" "a") == 0,
+         "invalid bytes reversed one by one");
+
+    unsigned char text[2000], copy[2000], junk[300];
+    int twice_ok = 1;
+    int junk_ok = 1;
+
+    for (int trial = 0; trial < 2000; trial++) {
+        size_t n = random_utf8(text, (size_t)rand() % 400);
+
+        memcpy(copy, text, n + 1);
+        my_strrev_utf8((char *)text);
+        if (my_strlen((char *)text) != n) {
+            twice_ok = 0;
+        }
+        my_strrev_utf8((char *)text);
+        if (memcmp(text, copy, n + 1) != 0) {
+            twice_ok = 0;
+        }
+    }
+    TEST(twice_ok, "reversing valid UTF-8 twice gives the original");
+
+    /* Random bytes: no valid structure, must still be a permutation */
+    for (int trial = 0; trial < 2000; trial++) {
+        size_t n = (size_t)rand() % 299;
+        size_t before[256] = { 0 }, after[256] = { 0 };
+
+        fill_random(junk, n);
+        junk[n] = '\0';
+        for (size_t i = 0; i < n; i++) {
+            before[junk[i]]++;
+        }
+        my_strrev_utf8((char *)junk);
+        for (size_t i = 0; i < n; i++) {
+            after[junk[i]]++;
+        }
+        if (junk[n] != '\0' || memcmp(before, after, sizeof(before)) != 0) {
+            junk_ok = 0;
+        }
+    }
+    TEST(junk_ok, "random bytes: same bytes, same length");
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  strstr Tests
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+void test_strstr(void)
+{
+    TEST_GROUP("my_strstr");
+
+    const char *hay = "hello world";
+
+    TEST(my_strstr(hay, "wor") == hay + 6, "finds substring");
+    TEST(my_strstr(hay, "xyz") == NULL, "returns NULL if not found");
+    TEST(my_strstr(hay, "") == hay, "empty needle returns haystack");
+    TEST(my_strstr("", "") != NULL, "empty needle in empty haystack");
+    TEST(my_strstr("", "a") == NULL, "nothing in empty haystack");
+    TEST(my_strstr(hay, "hello world") == hay, "exact match");
+    TEST(my_strstr(hay, "hello world!") == NULL, "needle longer than haystack");
+    TEST(my_strstr(hay, "o") == hay + 4, "one-byte needle: first occurrence");
+    TEST(my_strstr(hay, "d") == hay + 10, "match at the very end");
+    TEST(my_strstr("aaab", "aab") != NULL && strcmp(my_strstr("aaab", "aab"), "aab") == 0,
+         "retries after a partial match");
+}
+
+/*
+ * Random text over a tiny alphabet: needles match (and nearly match)
+ * all over the place, the hard case for every search.
+ */
+static void random_text(char *p, size_t n, int letters)
+{
+    for (size_t i = 0; i < n; i++) {
+        p[i] = (char)('a' + rand() % letters);
+    }
+    p[n] = '\0';
+}
+
+void test_strstr_variants(void)
+{
+    TEST_GROUP("my_strstr variants");
+
+    const my_strstr_impl *impls;
+    size_t count = my_strstr_impls(&impls);
+    unsigned char *page = guarded_page();
+    size_t size = page_size();
+    static char hay[4200], needle[200];
+
+    for (size_t v = 0; v < count; v++) {
+        char *(*fn)(const char *, const char *) = impls[v].fn;
+        int random_ok = 1;
+        int hard_ok = 1;
+        int page_ok = 1;
+        char name[96];
+
+        /* Needles of every length class, taken from the haystack or not */
+        for (int trial = 0; trial < 20000; trial++) {
+            size_t n = (size_t)rand() % 300;
+            size_t m = 1 + (size_t)rand() % ((trial % 4 == 0) ? 100 : 40);
+            int letters = 1 + rand() % 4;
+
+            random_text(hay, n, letters);
+            if (n >= m && rand() % 2) {
+                memcpy(needle, hay + (size_t)rand() % (n - m + 1), m);
+                needle[m] = '\0';
+            } else {
+                random_text(needle, m, letters);
+            }
+            if (fn(hay, needle) != strstr(hay, needle)) {
+                random_ok = 0;
+            }
+        }
+        snprintf(name, sizeof(name), "%s: matches strstr on random text", impls[v].name);
+        TEST(random_ok, name);
+
+        /*
+         * Periodic needles against periodic haystacks: "aaa...ab" in
+         * "aaa...a" and the like, where naive search redoes m - 1
+         * comparisons at every start.
+         */
+        for (size_t m = 2; m <= 150; m += 7) {
+            static const char *const PATTERNS[] = { "a", "ab", "aab", "abaab" };
+
+            for (size_t p = 0; p < sizeof(PATTERNS) / sizeof(PATTERNS[0]); p++) {
+                size_t plen = strlen(PATTERNS[p]);
+
+                for (size_t i = 0; i < 4000; i++) {
+                    hay[i] = PATTERNS[p][i % plen];
+                }
+                hay[4000] = '\0';
+                for (size_t i = 0; i < m; i++) {
+                    needle[i] = PATTERNS[p][i % plen];
+                }
+                needle[m] = '\0';
+
+                if (fn(hay, needle) != strstr(hay, needle)) {
+                    hard_ok = 0;
+                }
+                needle[m - 1] = 'z';                    /* Fails at the end */
+                if (fn(hay, needle) != NULL) {
+                    hard_ok = 0;
+                }
+                needle[0] = 'z';                        /* Fails at the start */
+                needle[m - 1] = PATTERNS[p][(m - 1) % plen];
+                if (fn(hay, needle) != NULL) {
+                    hard_ok = 0;
+                }
+                hay[3999] = 'z';                        /* Only at the very end */
+                memcpy(hay + 4000 - m, needle, m);
+                if (fn(hay, needle) != hay + 4000 - m) {
+                    hard_ok = 0;
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: periodic needles and haystacks", impls[v].name);
+        TEST(hard_ok, name);
+
+        /* Haystack ending on the last byte before the guard page */
+        if (page != NULL) {
+            for (size_t n = 0; n <= 300; n++) {
+                char *h = (char *)page + size - 1 - n;
+
+                random_text(h, n, 3);
+                for (size_t m = 1; m <= 40 && page_ok; m += 3) {
+                    random_text(needle, m, 3);
+                    if (fn(h, needle) != strstr(h, needle)) {
+                        page_ok = 0;
+                    }
+                }
+            }
+        }
+        snprintf(name, sizeof(name), "%s: never reads past the page", impls[v].name);
+        TEST(page != NULL && page_ok, name);
+    }
+
+    guarded_page_free(page);
+}
+
+
+/*
+ * ──────────────────────────────────────────────────────────────────────────
+ *  Multi-Pattern Tests
+ * ──────────────────────────────────────────────────────────────────────────
+ */
+#define MAX_MATCHES 4096
+
+typedef struct {
+    size_t start[MAX_MATCHES];
+    size_t pattern[MAX_MATCHES];
+    size_t n;
+    size_t stop_after;          /* Stop the scan at this many (0: never) */
+} match_log;
+
+static int log_match(size_t start, size_t pattern, void *ctx)
+{
+    match_log *log = ctx;
+
+    if (log->n < MAX_MATCHES) {
+        log->start[log->n] = start;
+        log->pattern[log->n] = pattern;
+    }
+    log->n++;
+    return log->stop_after != 0 && log->n >= log->stop_after;
+}
+
+/*
+ * The contract, spelled out slowly: by end position, longest first, a
+ * repeated pattern only under its first index.
+ */
+static void brute_matches(const char *const *pats, size_t count,
+                          const char *text, size_t len, match_log *log)
+{
+    log->n = 0;
+    for (size_t end = 0; end < len; end++) {
+        for (size_t plen = end + 1; plen > 0; plen--) {
+            for (size_t p = 0; p < count; p++) {
+                int first = 1;
+
+                if (strlen(pats[p]) != plen ||
+                    memcmp(text + end + 1 - plen, pats[p], plen) != 0) {
+                    continue;
+                }
+                for (size_t q = 0; q < p; q++) {
+                    first = first && strcmp(pats[q], pats[p]) != 0;
+                }
+                if (first && log->n < MAX_MATCHES) {
+                    log->start[log->n] = end + 1 - plen;
+                    log->pattern[log->n++] = p;
+                }
+            }
+        }
+    }
+}
+
+static int same_matches(const match_log *a, const match_log *b)
+{
+    return a->n == b->n &&
+           memcmp(a->start, b->start, a->n * sizeof(size_t)) == 0 &&
+           memcmp(a->pattern, b->pattern, a->n * sizeof(size_t)) == 0;
+}
+
+void test_matcher(void)
+{
+    TEST_GROUP("my_matcher (Aho-Corasick)");
+
+    static const char *const CLASSIC[] = { "he", "she", "his", "hers" };
+    static match_log got, want;
+    my_matcher *mm = my_matcher_new(CLASSIC, 4);
+
+    TEST(mm != NULL, "builds from he/she/his/hers");
+    if (mm != NULL) {
+        memset(&got, 0, sizeof(got));
+        my_matcher_scan(mm, "ushers", 6, log_match, &got);
+        TEST(got.n == 3 &&
+             got.start[0] == 1 && got.pattern[0] == 1 &&        /* she  */
+             got.start[1] == 2 && got.pattern[1] == 0 &&        /* he   */
+             got.start[2] == 2 && got.pattern[2] == 3,          /* hers */
+             "\"ushers\": she, he, hers (by end, longest first)");
+
+        TEST(my_matcher_scan(mm, "ushers", 6, NULL, NULL) == 3, "NULL callback just counts");
+        TEST(my_matcher_scan(mm, "a\0his", 5, NULL, NULL) == 1, "'\\0' in text is just a byte");
+
+        memset(&got, 0, sizeof(got));
+        got.stop_after = 2;
+        TEST(my_matcher_scan(mm, "ushers ushers", 13, log_match, &got) == 2 && got.n == 2,
+             "callback can stop the scan");
+        my_matcher_free(mm);
+    }
+
+    {
+        static const char *const BAD[] = { "ok", "" };
+        TEST(my_matcher_new(BAD, 2) == NULL, "empty pattern rejected");
+        TEST(my_matcher_new(CLASSIC, 0) == NULL, "no patterns rejected");
+        my_matcher_free(NULL);
+    }
+
+    /*
+     * Random pattern sets over small alphabets (lots of overlap), small
+     * and large enough to have Teddy on and off, against brute force.
+     */
+    {
+        static char storage[64][12];
+        static char text[700];
+        const char *pats[64];
+        int dfa_ok = 1, scan_ok = 1;
+        int saw_teddy = 0;
+
+        for (int trial = 0; trial < 400; trial++) {
+            size_t count = 1 + (size_t)rand() % ((trial % 3 == 0) ? 64 : 12);
+            int letters = 2 + rand() % 4;
+            size_t len = (size_t)rand() % sizeof(text);
+
+            for (size_t p = 0; p < count; p++) {
+                size_t plen = 1 + (size_t)rand() % ((trial % 2) ? 3 : 10);
+
+                for (size_t i = 0; i < plen; i++) {
+                    storage[p][i] = (char)('a' + rand() % letters);
+                }
+                storage[p][plen] = '\0';
+                pats[p] = storage[p];
+            }
+            for (size_t i = 0; i < len; i++) {
+                text[i] = (char)('a' + rand() % (letters + 1));    /* + a byte in no pattern */
+            }
+
+            mm = my_matcher_new(pats, count);
+            if (mm == NULL) {
+                dfa_ok = scan_ok = 0;
+                continue;
+            }
+            saw_teddy |= my_matcher_prefiltered(mm);
+            brute_matches(pats, count, text, len, &want);
+
+            memset(&got, 0, sizeof(got));
+            if (my_matcher_scan_dfa(mm, text, len, log_match, &got) != want.n ||
+                !same_matches(&got, &want)) {
+                dfa_ok = 0;
+            }
+            memset(&got, 0, sizeof(got));
+            if (my_matcher_scan(mm, text, len, log_match, &got) != want.n ||
+                !same_matches(&got, &want)) {
+                scan_ok = 0;
+            }
+            my_matcher_free(mm);
+        }
+        TEST(dfa_ok, "DFA matches brute force on random pattern sets");
+        TEST(scan_ok, "prefiltered scan matches brute force");
+#if MY_STRING_X86
+        TEST(saw_teddy || !__builtin_cpu_supports("ssse3"), "Teddy prefilter used for small sets");
+#endif
+    }
+}
+
 
 /*
  * ──────────────────────────────────────────────────────────────────────────
@@ -265,11 +1279,21 @@ int main(void)
     printf("╚═══════════════════════════════════════════════════════════════╝\n");
     
     test_strlen();
+    test_strlen_variants();
+    test_strnlen_variants();
     test_strcpy();
     test_strncpy();
     test_strcmp();
     test_strncmp();
+    test_strcmp_variants();
     test_strcat();
+    test_copy_variants();
+    test_safe_str();
+    test_strrev();
+    test_strrev_utf8();
+    test_strstr();
+    test_strstr_variants();
+    test_matcher();
     
     printf("\n");
     printf("═══════════════════════════════════════════════════════════════\n");
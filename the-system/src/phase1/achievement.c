@@ -0,0 +1,309 @@
+/*
+ * achievement.c — Achievement Rules Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Grouping and sorting at build time, not at query time
+ *   - Bitmasks as compact sets
+ */
+
+#include <string.h>
+
+#include "achievement.h"
+
+/*
+ * ============================================================================
+ * BUILT-IN RULES
+ * ============================================================================
+ *
+ * Bit numbers are saved: only ever append to this table.
+ */
+
+static const AchievementRule DEFAULT_RULES[] = {
+    { "First Blood",      "Complete your first quest",        ACH_QUESTS,        1 },
+    { "Quest Hunter",     "Complete 25 quests",               ACH_QUESTS,        25 },
+    { "Centurion",        "Complete 100 quests",              ACH_QUESTS,        100 },
+    { "Gate Breaker",     "Clear a boss quest",               ACH_BOSS_QUESTS,   1 },
+    { "Boss Slayer",      "Clear 10 boss quests",             ACH_BOSS_QUESTS,   10 },
+    { "Shadow Seeker",    "Find a shadow quest",              ACH_SHADOW_QUESTS, 1 },
+    { "Week Warrior",     "Reach a 7-day streak",             ACH_STREAK,        7 },
+    { "Iron Will",        "Reach a 30-day streak",            ACH_STREAK,        30 },
+    { "Unbroken",         "Reach a 100-day streak",           ACH_STREAK,        100 },
+    { "Respawn",          "Fail a quest and live to retry",   ACH_DEATHS,        1 },
+    { "Rising Hunter",    "Reach C-Rank",                     ACH_RANK,          RANK_C },
+    { "Elite",            "Reach S-Rank",                     ACH_RANK,          RANK_S },
+    { "Iron Fist",        "Raise STR to 50",                  ACH_STAT_STR,      50 },
+    { "Kernel Whisperer", "Raise SYS to 50",                  ACH_STAT_SYS,      50 },
+    { "GPU Awakened",     "Raise GPU to 50",                  ACH_STAT_GPU,      50 },
+    { "Hardened",         "Raise SEC to 50",                  ACH_STAT_SEC,      50 }
+};
+
+/*
+ * ============================================================================
+ * STATE
+ * ============================================================================
+ */
+
+/* Unlocks waiting to be shown (a dropped one is still saved, just not shown) */
+#define ACH_QUEUE_SIZE 16
+
+static struct {
+    const AchievementRule *rules;
+    size_t count;
+
+    /* Rule indices grouped by counter, each group sorted by threshold */
+    uint8_t watch[ACH_MAX_RULES];
+    uint8_t watch_start[ACH_COUNTERS + 1];
+    uint64_t watch_mask[ACH_COUNTERS];      /* Bits of the group's rules */
+
+    uint8_t queue[ACH_QUEUE_SIZE];
+    uint32_t queue_head;
+    uint32_t queue_tail;
+} g_ach;
+
+static int g_ach_ready = 0;
+
+/*
+ * ============================================================================
+ * COUNTERS
+ * ============================================================================
+ */
+
+static uint32_t popcount64(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_popcountll(x);
+#else
+    uint32_t n = 0;
+    while (x) {
+        x &= x - 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static uint32_t stat_value(int v)
+{
+    return (v > 0) ? (uint32_t)v : 0;
+}
+
+static uint32_t counter_value(const Hunter *h, AchCounter c)
+{
+    switch (c) {
+    case ACH_QUESTS:        return h->quests_completed;
+    case ACH_BOSS_QUESTS:   return h->boss_quests_completed;
+    case ACH_SHADOW_QUESTS: return h->shadow_quests_found;
+    case ACH_STREAK:        return h->longest_streak;
+    case ACH_DEATHS:        return h->deaths;
+    case ACH_TOTAL_XP:      return h->total_xp;
+    case ACH_RANK:          return (uint32_t)h->rank;
+    case ACH_STAT_STR:      return stat_value(h->stats.strength);
+    case ACH_STAT_INT:      return stat_value(h->stats.intelligence);
+    case ACH_STAT_SYS:      return stat_value(h->stats.systems);
+    case ACH_STAT_GPU:      return stat_value(h->stats.gpu);
+    case ACH_STAT_SEC:      return stat_value(h->stats.security);
+    case ACH_STAT_END:      return stat_value(h->stats.endurance);
+    case ACH_COUNTERS:      break;
+    }
+    return 0;
+}
+
+/*
+ * counters_for — Which counters an event can change (bit per AchCounter)
+ */
+static uint32_t counters_for(const Event *e)
+{
+    switch ((EventType)e->type) {
+    case EVENT_QUEST_COMPLETED:
+        return (1u << ACH_QUESTS) | (1u << ACH_STREAK) |
+               (e->arg == QUEST_TYPE_BOSS ? 1u << ACH_BOSS_QUESTS : 0) |
+               (e->arg == QUEST_TYPE_SHADOW ? 1u << ACH_SHADOW_QUESTS : 0);
+    case EVENT_QUEST_FAILED:
+        return 1u << ACH_DEATHS;
+    case EVENT_XP_GRANTED:
+        return (1u << ACH_TOTAL_XP) | (1u << ACH_RANK);
+    case EVENT_STAT_GRANTED:
+        return (e->arg < 6) ? 1u << (ACH_STAT_STR + e->arg) : 0;
+    case EVENT_QUEST_ACCEPTED:
+        break;
+    }
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * COMPILING
+ * ============================================================================
+ */
+
+int achievement_init(const AchievementRule *rules, size_t count)
+{
+    uint8_t fill[ACH_COUNTERS];
+
+    if (rules == NULL) {
+        rules = DEFAULT_RULES;
+        count = sizeof(DEFAULT_RULES) / sizeof(DEFAULT_RULES[0]);
+    }
+
+    if (count > ACH_MAX_RULES) {
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if ((int)rules[i].counter < 0 || rules[i].counter >= ACH_COUNTERS) {
+            return -1;
+        }
+    }
+
+    memset(&g_ach, 0, sizeof(g_ach));
+    g_ach.rules = rules;
+    g_ach.count = count;
+
+    /* Counting sort by counter: sizes, then start offsets */
+    for (size_t i = 0; i < count; i++) {
+        g_ach.watch_start[rules[i].counter + 1]++;
+    }
+    for (int c = 0; c < ACH_COUNTERS; c++) {
+        g_ach.watch_start[c + 1] += g_ach.watch_start[c];
+        fill[c] = g_ach.watch_start[c];
+    }
+
+    /* Place each rule, keeping its group sorted by threshold (insertion) */
+    for (size_t i = 0; i < count; i++) {
+        AchCounter c = rules[i].counter;
+        uint8_t pos = fill[c]++;
+
+        while (pos > g_ach.watch_start[c] &&
+               rules[g_ach.watch[pos - 1]].threshold > rules[i].threshold) {
+            g_ach.watch[pos] = g_ach.watch[pos - 1];
+            pos--;
+        }
+        g_ach.watch[pos] = (uint8_t)i;
+        g_ach.watch_mask[c] |= 1ull << i;
+    }
+
+    g_ach_ready = 1;
+    return 0;
+}
+
+static void ensure_ready(void)
+{
+    if (!g_ach_ready) {
+        achievement_init(NULL, 0);
+    }
+}
+
+/*
+ * ============================================================================
+ * EVALUATION
+ * ============================================================================
+ */
+
+static void enqueue(uint8_t rule)
+{
+    if (g_ach.queue_tail - g_ach.queue_head >= ACH_QUEUE_SIZE) {
+        return;
+    }
+    g_ach.queue[g_ach.queue_tail++ % ACH_QUEUE_SIZE] = rule;
+}
+
+/*
+ * evaluate — Unlock the rules of one counter that its value now meets
+ *
+ * Normally starts at the cursor. A full scan starts at the beginning of
+ * the list instead, because a rule added later may sit below ones that
+ * are already unlocked (the prefix property only holds for rules that
+ * existed all along).
+ *
+ * Returns:
+ *   Number of rules unlocked
+ */
+static size_t evaluate(Hunter *h, AchCounter c, int full)
+{
+    uint32_t value = counter_value(h, c);
+    uint32_t at = g_ach.watch_start[c];
+    uint32_t end = g_ach.watch_start[c + 1];
+    size_t unlocked = 0;
+
+    if (!full) {
+        at += popcount64(h->achievements & g_ach.watch_mask[c]);
+    }
+
+    while (at < end && g_ach.rules[g_ach.watch[at]].threshold <= value) {
+        uint8_t rule = g_ach.watch[at++];
+        if (h->achievements & (1ull << rule)) {
+            continue;
+        }
+        h->achievements |= 1ull << rule;
+        enqueue(rule);
+        unlocked++;
+    }
+
+    return unlocked;
+}
+
+void achievement_on_event(Hunter *h, const Event *e, void *ctx)
+{
+    uint32_t mask;
+
+    (void)ctx;
+
+    if (h == NULL || e == NULL) {
+        return;
+    }
+
+    ensure_ready();
+
+    mask = counters_for(e);
+    while (mask != 0) {
+        int c = 0;
+        while (!(mask & (1u << c))) {
+            c++;
+        }
+        mask &= mask - 1;
+
+        /* Empty watch list: nothing can unlock, skip the counter read */
+        if (g_ach.watch_start[c] != g_ach.watch_start[c + 1]) {
+            evaluate(h, (AchCounter)c, 0);
+        }
+    }
+}
+
+size_t achievement_scan(Hunter *h)
+{
+    size_t unlocked = 0;
+
+    if (h == NULL) {
+        return 0;
+    }
+
+    ensure_ready();
+
+    for (int c = 0; c < ACH_COUNTERS; c++) {
+        unlocked += evaluate(h, (AchCounter)c, 1);
+    }
+
+    return unlocked;
+}
+
+const AchievementRule *achievement_next_unlocked(void)
+{
+    if (g_ach.queue_head == g_ach.queue_tail) {
+        return NULL;
+    }
+    return &g_ach.rules[g_ach.queue[g_ach.queue_head++ % ACH_QUEUE_SIZE]];
+}
+
+const AchievementRule *achievement_rule(size_t index)
+{
+    ensure_ready();
+    return (index < g_ach.count) ? &g_ach.rules[index] : NULL;
+}
+
+size_t achievement_count(void)
+{
+    ensure_ready();
+    return g_ach.count;
+}
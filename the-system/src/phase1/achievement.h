@@ -0,0 +1,157 @@
+/*
+ * achievement.h — Achievement Rules
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * An achievement is a rule "COUNTER >= THRESHOLD":
+ *
+ *   Boss Slayer     boss quests   >= 10
+ *   Iron Will       streak        >= 30
+ *   GPU Awakened    GPU           >= 50
+ *
+ * Checking every rule after every event wastes work: an XP grant can't
+ * unlock "30-day streak". So the rules are compiled into one WATCH LIST
+ * per counter, sorted by threshold:
+ *
+ *   counter        watch list (threshold order)
+ *   QUESTS    →    [First Blood 1] [Quest Hunter 25] [Centurion 100]
+ *   STREAK    →    [Week Warrior 7] [Iron Will 30] [Unbroken 100]
+ *   STAT_GPU  →    [GPU Awakened 50]
+ *
+ * Each event names the counters it can change (COMPLETED → QUESTS,
+ * STREAK, ...; STAT_GRANTED GPU → STAT_GPU). Only those lists are
+ * looked at, and only from the first rule not yet unlocked — a cursor.
+ *
+ * Counters never go down (streak means the longest streak), so the
+ * unlocked rules of a list are always a prefix of it. The cursor is
+ * simply how many of the list's rules are unlocked:
+ *
+ *   cursor = popcount(hunter->achievements & list_mask)
+ *
+ * No per-Hunter state beyond the unlocked bits, which are saved.
+ *
+ * Learning Focus:
+ *   - Compiling rules into indexes
+ *   - Incremental evaluation: only redo work whose inputs changed
+ *   - Observers (event.h) to decouple features
+ */
+
+#ifndef ACHIEVEMENT_H
+#define ACHIEVEMENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+#include "event.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Rules are bits in Hunter.achievements */
+#define ACH_MAX_RULES  64
+
+/*
+ * ============================================================================
+ * ENUMERATIONS
+ * ============================================================================
+ */
+
+typedef enum {
+    ACH_QUESTS = 0,      /* quests_completed */
+    ACH_BOSS_QUESTS,     /* boss_quests_completed */
+    ACH_SHADOW_QUESTS,   /* shadow_quests_found */
+    ACH_STREAK,          /* longest_streak */
+    ACH_DEATHS,          /* deaths */
+    ACH_TOTAL_XP,        /* total_xp */
+    ACH_RANK,            /* rank */
+    ACH_STAT_STR,        /* stats, in event stat order */
+    ACH_STAT_INT,
+    ACH_STAT_SYS,
+    ACH_STAT_GPU,
+    ACH_STAT_SEC,
+    ACH_STAT_END,
+    ACH_COUNTERS
+} AchCounter;
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * AchievementRule — "counter >= threshold"
+ */
+typedef struct {
+    const char *name;
+    const char *description;
+    AchCounter counter;
+    uint32_t threshold;
+} AchievementRule;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * achievement_init — Compile a rule set (NULL = built-in rules)
+ *
+ * Rule i is bit i of Hunter.achievements, so reordering or removing
+ * rules in a list that has been saved with changes what Hunters own.
+ * Append new rules at the end.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if there are too many rules or a rule names a bad counter
+ */
+int achievement_init(const AchievementRule *rules, size_t count);
+
+/*
+ * achievement_on_event — EventObserver: evaluate rules an event affects
+ *
+ * Register with event_add_observer(achievement_on_event, NULL).
+ * Newly unlocked rules are set in h->achievements and queued for
+ * achievement_next_unlocked().
+ */
+void achievement_on_event(Hunter *h, const Event *e, void *ctx);
+
+/*
+ * achievement_scan — Evaluate every counter
+ *
+ * For Hunters rebuilt by event_replay (observers don't run there) or
+ * after adding new rules.
+ *
+ * Returns:
+ *   Number of rules newly unlocked
+ */
+size_t achievement_scan(Hunter *h);
+
+/*
+ * achievement_next_unlocked — Pop the oldest queued unlock
+ *
+ * Returns:
+ *   The rule, or NULL when the queue is empty
+ */
+const AchievementRule *achievement_next_unlocked(void);
+
+/*
+ * achievement_rule — Rule by index (bit number)
+ *
+ * Returns:
+ *   The rule, or NULL if out of range
+ */
+const AchievementRule *achievement_rule(size_t index);
+
+/*
+ * achievement_count — Number of compiled rules
+ */
+size_t achievement_count(void);
+
+#endif /* ACHIEVEMENT_H */
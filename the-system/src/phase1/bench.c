@@ -0,0 +1,803 @@
+/*
+ * bench.c — Performance Benchmarks
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Not part of the game. Measures the things we care about staying
+ * fast, so a change that makes them slower shows up as a number.
+ *
+ * Build and run:
+ *   make bench
+ *
+ * Every benchmark runs against a throwaway HOME, so your real save
+ * in ~/.hunter-protocol is never touched.
+ *
+ * Learning Focus:
+ *   - Measuring with a monotonic clock
+ *   - Reporting percentiles, not just averages
+ *   - fork/exec/wait (process creation is part of cold start)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "hunter.h"
+#include "quest.h"
+#include "history.h"
+#include "save.h"
+#include "roster.h"
+#include "event.h"
+#include "shadow.h"
+#include "stat.h"
+#include "leaderboard.h"
+#include "skill_tree.h"
+
+/*
+ * ============================================================================
+ * TIMING
+ * ============================================================================
+ */
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * report — Print min / median / p95 / max of n samples (sorts them)
+ */
+static void report(const char *name, double *samples, size_t n,
+                   const char *unit)
+{
+    if (n == 0) {
+        return;
+    }
+
+    qsort(samples, n, sizeof(*samples), cmp_double);
+    printf("  %-28s min %9.2f  p50 %9.2f  p95 %9.2f  max %9.2f  %s\n",
+           name, samples[0], samples[n / 2], samples[(n * 95) / 100],
+           samples[n - 1], unit);
+}
+
+/*
+ * ============================================================================
+ * SANDBOX HOME
+ * ============================================================================
+ */
+
+static char g_home[64];
+
+static int sandbox_create(void)
+{
+    strcpy(g_home, "/tmp/hunter-bench-XXXXXX");
+    if (mkdtemp(g_home) == NULL) {
+        perror("mkdtemp");
+        return -1;
+    }
+    return setenv("HOME", g_home, 1);
+}
+
+static void sandbox_destroy(void)
+{
+    char path[128];
+
+    snprintf(path, sizeof(path), "%s/%s/%s", g_home, SAVE_DIR, SAVE_FILE);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s/%s/%s", g_home, SAVE_DIR, BACKUP_FILE);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s/%s/%s", g_home, SAVE_DIR, EVENT_FILE);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s/%s", g_home, SAVE_DIR);
+    rmdir(path);
+    rmdir(g_home);
+}
+
+/*
+ * write_fixture — A mid-Protocol save: many quests, a full history
+ */
+static int write_fixture(uint32_t quest_count)
+{
+    static Hunter h;
+    static QuestList ql;
+    static History hist;
+    HunterStats bonus = { 1, 1, 0, 0, 0, 1 };
+    char name[32];
+
+    if (save_init() != SAVE_OK) {
+        return -1;
+    }
+
+    hunter_init(&h, "Bench");
+    questlist_init(&ql);
+    history_init(&hist);
+
+    for (uint32_t i = 1; i <= quest_count; i++) {
+        Quest *q;
+        snprintf(name, sizeof(name), "Quest %u", i);
+        q = questlist_add(&ql, i, name, "Benchmark quest.",
+                          QUEST_TYPE_DAILY, SEASON_FOUNDATION);
+        if (q != NULL) {
+            quest_set_rewards(q, 50, &bonus);
+            q->status = QUEST_STATUS_AVAILABLE;
+        }
+    }
+
+    for (uint32_t day = 1; day <= 120; day++) {
+        history_record(&hist, day, 40 + (day * 7) % 90, &bonus, 2);
+    }
+
+    return (save_write(&h, &ql, &hist) == SAVE_OK) ? 0 : -1;
+}
+
+/*
+ * ============================================================================
+ * BENCHMARKS
+ * ============================================================================
+ */
+
+/*
+ * run_once — fork + exec one command with stdout sent to /dev/null
+ *
+ * Returns:
+ *   Wall time in microseconds, or a negative value on failure
+ */
+static double run_once(char *const argv[])
+{
+    double start = now_us();
+    int status;
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        return -1;
+    }
+
+    if (pid == 0) {
+        int devnull = open("/dev/null", O_WRONLY);
+        if (devnull >= 0) {
+            dup2(devnull, STDOUT_FILENO);
+            close(devnull);
+        }
+        execv(argv[0], argv);
+        _exit(127);
+    }
+
+    if (waitpid(pid, &status, 0) < 0 ||
+        !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        return -1;
+    }
+
+    return now_us() - start;
+}
+
+/*
+ * bench_cold_start — Process start to exit for one-shot commands
+ *
+ * This is what a shell prompt hook pays on every prompt.
+ */
+static void bench_cold_start(void)
+{
+    enum { RUNS = 200 };
+    static double samples[RUNS];
+    char *status_json[] = { "./hunter", "status", "--json", NULL };
+    char *list_active[] = { "./hunter", "list", "--status=active", NULL };
+
+    printf("\n  COLD START (%d runs each, 500 quests, 120 days history)\n",
+           RUNS);
+
+    if (write_fixture(500) != 0) {
+        fprintf(stderr, "  could not write fixture save\n");
+        return;
+    }
+
+    for (int i = 0; i < RUNS; i++) {
+        samples[i] = run_once(status_json);
+        if (samples[i] < 0) {
+            fprintf(stderr, "  ./hunter status --json failed\n");
+            return;
+        }
+    }
+    report("hunter status --json", samples, RUNS, "us");
+
+    for (int i = 0; i < RUNS; i++) {
+        samples[i] = run_once(list_active);
+        if (samples[i] < 0) {
+            fprintf(stderr, "  ./hunter list failed\n");
+            return;
+        }
+    }
+    report("hunter list --status=active", samples, RUNS, "us");
+}
+
+/*
+ * bench_roster — Bulk XP award: Hunter[] (AoS) vs HunterRoster (SoA)
+ */
+static void bench_roster(void)
+{
+    enum { HUNTERS = ROSTER_MAX_HUNTERS, ROUNDS = 50 };
+    static Hunter hunters[HUNTERS];
+    static HunterRoster roster;
+    static double aos[ROUNDS], soa[ROUNDS], day[ROUNDS];
+    char name[32];
+
+    printf("\n  ROSTER (%d hunters, ns per hunter)\n", HUNTERS);
+
+    roster_init(&roster);
+    for (int i = 0; i < HUNTERS; i++) {
+        snprintf(name, sizeof(name), "Hunter %d", i);
+        hunter_init(&hunters[i], name);
+        hunter_mark_active(&hunters[i], (uint32_t)(i % 7) + 1);
+        roster_add(&roster, &hunters[i]);
+    }
+
+    for (int round = 0; round < ROUNDS; round++) {
+        double start = now_us();
+        for (int i = 0; i < HUNTERS; i++) {
+            hunter_add_xp(&hunters[i], 3);
+        }
+        aos[round] = (now_us() - start) * 1e3 / HUNTERS;
+
+        start = now_us();
+        roster_award_xp_all(&roster, 3);
+        soa[round] = (now_us() - start) * 1e3 / HUNTERS;
+
+        start = now_us();
+        roster_award_xp_on_day(&roster, 3, 5);
+        day[round] = (now_us() - start) * 1e3 / HUNTERS;
+    }
+
+    report("hunter_add_xp loop (AoS)", aos, ROUNDS, "ns");
+    report("roster_award_xp_all", soa, ROUNDS, "ns");
+    report("roster_award_xp_on_day", day, ROUNDS, "ns");
+}
+
+/*
+ * rank_linear — The original hunter_add_xp() rank loop, for reference
+ */
+static uint32_t g_thresholds[RANK_SHADOW_MONARCH + 1];
+
+static HunterRank rank_linear(uint32_t xp)
+{
+    HunterRank rank = RANK_E;
+    while (rank < RANK_SHADOW_MONARCH && xp >= g_thresholds[rank + 1]) {
+        rank++;
+    }
+    return rank;
+}
+
+/*
+ * bench_rank — Rank lookup and bulk XP awards
+ *
+ * Amounts are random-ish so rank-ups are spread across the batch.
+ */
+static void bench_rank(void)
+{
+    enum { HUNTERS = 4096, ROUNDS = 50 };
+    static Hunter one[HUNTERS], many[HUNTERS];
+    static uint32_t amounts[HUNTERS], xp[HUNTERS];
+    static RankUpEvent events[HUNTERS];
+    static double linear[ROUNDS], lut[ROUNDS];
+    static double scalar[ROUNDS], batch[ROUNDS];
+    volatile uint32_t sink = 0;
+    uint32_t seed = 12345;
+
+    printf("\n  RANK RESOLUTION (%d hunters, ns per hunter)\n", HUNTERS);
+
+    for (int r = RANK_E; r <= RANK_SHADOW_MONARCH; r++) {
+        g_thresholds[r] = hunter_rank_threshold((HunterRank)r);
+    }
+
+    for (int i = 0; i < HUNTERS; i++) {
+        hunter_init(&one[i], "Bench");
+        seed = seed * 1103515245u + 12345u;
+        amounts[i] = (seed >> 16) % 400;
+        xp[i] = (seed >> 8) % 120000;
+    }
+    memcpy(many, one, sizeof(many));
+
+    for (int round = 0; round < ROUNDS; round++) {
+        uint32_t acc = 0;
+        double start = now_us();
+        for (int i = 0; i < HUNTERS; i++) {
+            acc += (uint32_t)rank_linear(xp[i]);
+        }
+        linear[round] = (now_us() - start) * 1e3 / HUNTERS;
+
+        start = now_us();
+        for (int i = 0; i < HUNTERS; i++) {
+            acc += (uint32_t)hunter_rank_for_xp(xp[i]);
+        }
+        lut[round] = (now_us() - start) * 1e3 / HUNTERS;
+        sink += acc;
+
+        start = now_us();
+        for (int i = 0; i < HUNTERS; i++) {
+            hunter_add_xp(&one[i], amounts[i]);
+        }
+        scalar[round] = (now_us() - start) * 1e3 / HUNTERS;
+
+        start = now_us();
+        hunter_add_xp_many(many, amounts, HUNTERS, events, HUNTERS);
+        batch[round] = (now_us() - start) * 1e3 / HUNTERS;
+    }
+    (void)sink;
+
+    report("rank lookup, linear loop", linear, ROUNDS, "ns");
+    report("hunter_rank_for_xp (LUT)", lut, ROUNDS, "ns");
+    report("hunter_add_xp loop", scalar, ROUNDS, "ns");
+    report("hunter_add_xp_many", batch, ROUNDS, "ns");
+}
+
+/*
+ * bench_replay — Rebuild a whole cohort from a mapped event file
+ *
+ * The log is generated by folding events into live Hunters, so the
+ * recorded replay can be checked against them.
+ */
+static void bench_replay(void)
+{
+    enum { HUNTERS = 4096, DAYS = 210, QUESTS = 64, ROUNDS = 10 };
+    static Hunter live[HUNTERS], replayed[HUNTERS];
+    static QuestList quests, rebalanced;
+    static double recorded[ROUNDS], rebalance[ROUNDS];
+    HunterStats bonus = { 1, 0, 1, 0, 0, 1 };
+    Event batch[EVENT_MAX_PER_QUEST];
+    EventFileHeader header = { EVENT_MAGIC, EVENT_VERSION, sizeof(Event), 0 };
+    EventFile file;
+    char path[128];
+    uint32_t seed = 777;
+    size_t total = 0;
+    int fd, same = 1;
+
+    questlist_init(&quests);
+    for (uint32_t i = 1; i <= QUESTS; i++) {
+        Quest *q = questlist_add(&quests, i, "Replay", "Benchmark quest.",
+                                 QUEST_TYPE_DAILY, SEASON_FOUNDATION);
+        quest_set_rewards(q, 40 + i, &bonus);
+    }
+    rebalanced = quests;
+    for (uint32_t i = 0; i < rebalanced.count; i++) {
+        rebalanced.quests[i].rewards.xp *= 2;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s/%s", g_home, SAVE_DIR, EVENT_FILE);
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || write(fd, &header, sizeof(header)) != (ssize_t)sizeof(header)) {
+        fprintf(stderr, "  could not create event file\n");
+        return;
+    }
+
+    for (int i = 0; i < HUNTERS; i++) {
+        hunter_init(&live[i], "Replay");
+    }
+
+    /* Each hunter shows up on ~2 of 3 days and completes one quest */
+    for (uint32_t day = 1; day <= DAYS; day++) {
+        for (uint32_t i = 0; i < HUNTERS; i++) {
+            const Quest *q;
+            size_t n;
+
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 3 == 0) {
+                continue;
+            }
+            q = &quests.quests[(seed >> 8) % QUESTS];
+
+            memset(&batch[0], 0, sizeof(batch[0]));
+            batch[0].type = EVENT_QUEST_COMPLETED;
+            batch[0].day = (uint16_t)day;
+            batch[0].hunter = i;
+            batch[0].quest = q->id;
+            event_apply(&live[i], &batch[0]);
+
+            n = event_quest_rewards(q, i, day, live[i].current_streak, &batch[1]);
+            for (size_t j = 1; j <= n; j++) {
+                event_apply(&live[i], &batch[j]);
+            }
+
+            if (write(fd, batch, (n + 1) * sizeof(Event)) !=
+                (ssize_t)((n + 1) * sizeof(Event))) {
+                fprintf(stderr, "  event file write failed\n");
+                close(fd);
+                return;
+            }
+            total += n + 1;
+        }
+    }
+    close(fd);
+
+    if (event_file_map(path, &file) != 0 || file.count != total) {
+        fprintf(stderr, "  could not map event file\n");
+        return;
+    }
+
+    printf("\n  EVENT REPLAY (%d hunters, %zu events, ns per event)\n",
+           HUNTERS, file.count);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        double start;
+
+        for (int i = 0; i < HUNTERS; i++) {
+            hunter_init(&replayed[i], "Replay");
+        }
+        start = now_us();
+        event_replay(replayed, HUNTERS, file.events, file.count, NULL);
+        recorded[round] = (now_us() - start) * 1e3 / (double)file.count;
+
+        if (round == 0) {
+            for (int i = 0; i < HUNTERS; i++) {
+                if (replayed[i].total_xp != live[i].total_xp ||
+                    replayed[i].longest_streak != live[i].longest_streak ||
+                    replayed[i].stats.strength != live[i].stats.strength) {
+                    same = 0;
+                }
+            }
+        }
+
+        for (int i = 0; i < HUNTERS; i++) {
+            hunter_init(&replayed[i], "Replay");
+        }
+        start = now_us();
+        event_replay(replayed, HUNTERS, file.events, file.count, &rebalanced);
+        rebalance[round] = (now_us() - start) * 1e3 / (double)file.count;
+    }
+
+    event_file_unmap(&file);
+
+    printf("  replay matches live state: %s\n", same ? "yes" : "NO");
+    report("event_replay (recorded)", recorded, ROUNDS, "ns");
+    report("event_replay (rebalance)", rebalance, ROUNDS, "ns");
+}
+
+/*
+ * pick_linear — rand() and a walk over cumulative weights, for reference
+ */
+static uint32_t pick_linear(const ShadowTemplate *t, size_t n, uint32_t total)
+{
+    uint32_t r = (uint32_t)rand() % total;
+
+    for (size_t i = 0; i < n; i++) {
+        if (r < t[i].weight) {
+            return (uint32_t)i;
+        }
+        r -= t[i].weight;
+    }
+    return (uint32_t)n - 1;
+}
+
+/*
+ * bench_shadow — Template sampling, and a season of spawns for a roster
+ */
+static void bench_shadow(void)
+{
+    enum { SAMPLES = 1 << 20, HUNTERS = 4096, ROUNDS = 20 };
+    static ShadowSpawn spawns[PROTOCOL_DAYS], check[PROTOCOL_DAYS];
+    static double linear[ROUNDS], alias_ns[ROUNDS], season[ROUNDS];
+    const ShadowTemplate *t;
+    ShadowAlias alias;
+    ShadowRng rng;
+    size_t count, total_spawns = 0;
+    uint32_t total = 0;
+    volatile uint32_t sink = 0;
+    int deterministic = 1;
+
+    t = shadow_templates(&count);
+    for (size_t i = 0; i < count; i++) {
+        total += t[i].weight;
+    }
+    shadow_alias_build(&alias, t, count);
+    shadow_rng_seed(&rng, 12345, 0);
+    srand(12345);
+
+    printf("\n  SHADOW QUESTS (%zu templates, %d hunters x %d days)\n",
+           count, HUNTERS, PROTOCOL_DAYS);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        uint32_t acc = 0;
+        double start = now_us();
+        for (int i = 0; i < SAMPLES; i++) {
+            acc += pick_linear(t, count, total);
+        }
+        linear[round] = (now_us() - start) * 1e3 / SAMPLES;
+
+        start = now_us();
+        for (int i = 0; i < SAMPLES; i++) {
+            acc += shadow_alias_sample(&alias, &rng);
+        }
+        alias_ns[round] = (now_us() - start) * 1e3 / SAMPLES;
+        sink += acc;
+
+        start = now_us();
+        total_spawns = 0;
+        for (uint64_t h = 0; h < HUNTERS; h++) {
+            total_spawns += shadow_spawn_days(h, &alias, 1, PROTOCOL_DAYS,
+                                              SHADOW_DAILY_PERMILLE,
+                                              spawns, PROTOCOL_DAYS);
+        }
+        season[round] = (now_us() - start) / 1e3;
+    }
+    (void)sink;
+
+    /* Same seed, same season */
+    for (uint64_t h = 0; h < 64; h++) {
+        size_t a = shadow_spawn_days(h, &alias, 1, PROTOCOL_DAYS,
+                                     SHADOW_DAILY_PERMILLE, spawns, PROTOCOL_DAYS);
+        size_t b = shadow_spawn_days(h, &alias, 1, PROTOCOL_DAYS,
+                                     SHADOW_DAILY_PERMILLE, check, PROTOCOL_DAYS);
+        if (a != b || memcmp(spawns, check, a * sizeof(spawns[0])) != 0) {
+            deterministic = 0;
+        }
+    }
+
+    printf("  %zu spawns per season, deterministic: %s\n",
+           total_spawns, deterministic ? "yes" : "NO");
+    report("rand() + linear pick", linear, ROUNDS, "ns");
+    report("shadow_alias_sample", alias_ns, ROUNDS, "ns");
+    report("season for whole roster", season, ROUNDS, "ms");
+}
+
+/*
+ * ============================================================================
+ * STAT COLUMNS
+ * ============================================================================
+ */
+
+/*
+ * bench_stats — Saturating stat bonus over a roster-sized column
+ *
+ * The scalar loop does one branchy saturating add and clamp per hunter;
+ * stat_add_column does four per instruction with SSE2 masks.
+ */
+static void bench_stats(void)
+{
+    enum { N = 4096, REPS = 256, ROUNDS = 20 };
+    static int32_t scalar[N], vector[N];
+    static double scalar_ns[ROUNDS], vector_ns[ROUNDS];
+    int match = 1;
+
+    for (int i = 0; i < N; i++) {
+        scalar[i] = vector[i] = (int32_t)(i * 37 % 1000);
+    }
+
+    printf("\n  STAT COLUMNS (%d hunters, +/-3 alternating)\n", N);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        double start = now_us();
+        for (int rep = 0; rep < REPS; rep++) {
+            int32_t delta = (rep & 1) ? -3 : 3;
+            for (int i = 0; i < N; i++) {
+                int32_t v = stat_saturating_add(scalar[i], delta);
+                scalar[i] = (v < STAT_MIN) ? STAT_MIN : (v > 999) ? 999 : v;
+            }
+        }
+        scalar_ns[round] = (now_us() - start) * 1e3 / ((double)N * REPS);
+
+        start = now_us();
+        for (int rep = 0; rep < REPS; rep++) {
+            stat_add_column(vector, N, (rep & 1) ? -3 : 3, STAT_MIN, 999);
+        }
+        vector_ns[round] = (now_us() - start) * 1e3 / ((double)N * REPS);
+    }
+
+    if (memcmp(scalar, vector, sizeof(scalar)) != 0) {
+        match = 0;
+    }
+
+    printf("  results match: %s\n", match ? "yes" : "NO");
+    report("scalar add + clamp", scalar_ns, ROUNDS, "ns");
+    report("stat_add_column", vector_ns, ROUNDS, "ns");
+}
+
+/*
+ * ============================================================================
+ * LEADERBOARD
+ * ============================================================================
+ */
+
+/*
+ * bench_leaderboard — Rank queries and XP updates over a full roster
+ *
+ * The baseline is what a status screen would do without an index:
+ * count everyone with more XP.
+ */
+static void bench_leaderboard(void)
+{
+    enum { N = ROSTER_MAX_HUNTERS, QUERIES = 1 << 14, ROUNDS = 20 };
+    static Leaderboard lb, over;
+    static uint32_t xp[N], over_xp[N];
+    static double scan_ns[ROUNDS], rank_ns[ROUNDS], update_ns[ROUNDS], top_ns[ROUNDS];
+    static double over_ns[ROUNDS];
+    uint32_t top[10];
+    ShadowRng rng;
+    volatile uint32_t sink = 0;
+    int match = 1;
+
+    shadow_rng_seed(&rng, 2024, 1);
+    leaderboard_init(&lb, 100000);
+    for (uint32_t i = 0; i < N; i++) {
+        xp[i] = shadow_rng_below(&rng, 100000);
+        leaderboard_set(&lb, i, xp[i]);
+    }
+
+    /* A cohort that has kept going well past the range it was sized for */
+    leaderboard_init(&over, 100000);
+    for (uint32_t i = 0; i < N; i++) {
+        over_xp[i] = 200000 + shadow_rng_below(&rng, 200000);
+        leaderboard_set(&over, i, over_xp[i]);
+    }
+    for (uint32_t m = 0; m < N; m += 97) {
+        uint32_t rank = 1;
+        for (uint32_t i = 0; i < N; i++) {
+            rank += over_xp[i] > over_xp[m];
+        }
+        if (rank != leaderboard_rank(&over, m)) {
+            match = 0;
+        }
+    }
+
+    printf("\n  LEADERBOARD (%d hunters, %d buckets)\n", N, LEADERBOARD_BUCKETS);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        uint32_t acc = 0;
+        double start = now_us();
+        for (int q = 0; q < QUERIES / 16; q++) {
+            uint32_t m = shadow_rng_below(&rng, N), rank = 1;
+            for (uint32_t i = 0; i < N; i++) {
+                rank += xp[i] > xp[m];
+            }
+            if (rank != leaderboard_rank(&lb, m)) {
+                match = 0;
+            }
+            acc += rank;
+        }
+        scan_ns[round] = (now_us() - start) * 1e3 / (QUERIES / 16);
+
+        start = now_us();
+        for (int q = 0; q < QUERIES; q++) {
+            acc += leaderboard_rank(&lb, shadow_rng_below(&rng, N));
+        }
+        rank_ns[round] = (now_us() - start) * 1e3 / QUERIES;
+
+        start = now_us();
+        for (int q = 0; q < QUERIES; q++) {
+            uint32_t m = shadow_rng_below(&rng, N);
+            xp[m] += 50 + shadow_rng_below(&rng, 250);
+            leaderboard_set(&lb, m, xp[m]);
+        }
+        update_ns[round] = (now_us() - start) * 1e3 / QUERIES;
+
+        start = now_us();
+        for (int q = 0; q < QUERIES / 16; q++) {
+            acc += (uint32_t)leaderboard_top(&lb, top, 10);
+        }
+        top_ns[round] = (now_us() - start) * 1e3 / (QUERIES / 16);
+
+        start = now_us();
+        for (int q = 0; q < QUERIES; q++) {
+            acc += leaderboard_rank(&over, shadow_rng_below(&rng, N));
+        }
+        over_ns[round] = (now_us() - start) * 1e3 / QUERIES;
+        sink += acc;
+    }
+    (void)sink;
+
+    printf("  ranks match a full scan: %s\n", match ? "yes" : "NO");
+    report("rank by full scan", scan_ns, ROUNDS, "ns");
+    report("leaderboard_rank", rank_ns, ROUNDS, "ns");
+    report("leaderboard_rank (overflow)", over_ns, ROUNDS, "ns");
+    report("leaderboard_set (+XP)", update_ns, ROUNDS, "ns");
+    report("leaderboard_top (k=10)", top_ns, ROUNDS, "ns");
+}
+
+/*
+ * ============================================================================
+ * SKILL TREE
+ * ============================================================================
+ */
+
+/*
+ * bench_skills — Incremental unlocks vs recompiling the tree
+ *
+ * A random 256-skill DAG (a fifth of it milestones), each skill
+ * unlocking a quest. The baseline rebuilds everything after a change,
+ * which is what a SkillNode array without the compiled form needs.
+ */
+static void bench_skills(void)
+{
+    enum { N = SKILL_MAX_NODES, INVESTS = 1 << 12, ROUNDS = 20 };
+    static SkillNode nodes[N];
+    static SkillTree tree;
+    static QuestList ql;
+    static double build_us[ROUNDS], invest_ns[ROUNDS];
+    uint32_t unlocked = 0;
+    ShadowRng rng;
+
+    shadow_rng_seed(&rng, 99, 2);
+    questlist_init(&ql);
+    for (uint32_t i = 0; i < N; i++) {
+        uint32_t prereqs = (i == 0) ? 0 : shadow_rng_below(&rng, 4);
+
+        nodes[i].id = i + 1;
+        nodes[i].max_level = (shadow_rng_below(&rng, 5) == 0) ? 0 : SKILL_MAX_LEVEL;
+        for (uint32_t k = 0; k < prereqs; k++) {
+            nodes[i].prerequisite_ids[k] = shadow_rng_below(&rng, i) + 1;
+        }
+        nodes[i].prerequisite_count = prereqs;
+        nodes[i].unlocks_quest_ids[0] = 1000 + i;
+        nodes[i].unlocks_count = 1;
+        questlist_add(&ql, 1000 + i, "Skill quest", "", QUEST_TYPE_SIDE,
+                      SEASON_FOUNDATION);
+    }
+
+    printf("\n  SKILL TREE (%d skills)\n", N);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        double start = now_us();
+        skill_tree_build(&tree, nodes, N);
+        build_us[round] = now_us() - start;
+
+        for (uint32_t i = 0; i < ql.count; i++) {
+            ql.quests[i].status = QUEST_STATUS_LOCKED;
+        }
+
+        start = now_us();
+        for (int k = 0; k < INVESTS; k++) {
+            SkillCascade c;
+            skill_invest(&tree, shadow_rng_below(&rng, N), 150, &ql, &c);
+            unlocked += c.quests_unlocked;
+        }
+        invest_ns[round] = (now_us() - start) * 1e3 / INVESTS;
+    }
+
+    printf("  %u quests unlocked per round\n", unlocked / ROUNDS);
+    report("skill_tree_build (full)", build_us, ROUNDS, "us");
+    report("skill_invest (cascade)", invest_ns, ROUNDS, "ns");
+}
+
+/*
+ * ============================================================================
+ * MAIN
+ * ============================================================================
+ */
+
+int main(void)
+{
+    if (access("./hunter", X_OK) != 0) {
+        fprintf(stderr, "bench: ./hunter not found (run make first)\n");
+        return 1;
+    }
+
+    if (sandbox_create() != 0) {
+        return 1;
+    }
+
+    printf("THE SYSTEM — BENCHMARKS\n");
+
+    bench_cold_start();
+    bench_roster();
+    bench_rank();
+    bench_replay();
+    bench_shadow();
+    bench_stats();
+    bench_leaderboard();
+    bench_skills();
+
+    sandbox_destroy();
+    return 0;
+}
@@ -0,0 +1,349 @@
+/*
+ * cli.c — Non-Interactive Command Line Mode Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Dispatch tables instead of if/else chains
+ *   - Writing to stdout vs stderr
+ *   - Doing as little as possible on a hot path (cron runs this a lot)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cli.h"
+#include "save.h"
+
+/*
+ * ============================================================================
+ * HELPERS
+ * ============================================================================
+ */
+
+/* Lowercase status names, as accepted by --status= */
+static const char *STATUS_KEYS[] = {
+    "locked",
+    "available",
+    "active",
+    "completed",
+    "failed"
+};
+
+#define STATUS_KEY_COUNT (sizeof(STATUS_KEYS) / sizeof(STATUS_KEYS[0]))
+
+static const char *status_key(QuestStatus status)
+{
+    return ((size_t)status < STATUS_KEY_COUNT) ? STATUS_KEYS[status] : "unknown";
+}
+
+static int load(Hunter *h, QuestList *ql, History *hist)
+{
+    SaveResult result;
+
+    if (!save_exists()) {
+        fprintf(stderr, "hunter: no save found (run 'hunter' to create one)\n");
+        return -1;
+    }
+
+    result = save_read(h, ql, hist);
+    if (result != SAVE_OK) {
+        fprintf(stderr, "hunter: could not load save: %s\n",
+                save_result_string(result));
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * parse_quest_id — Parse a quest id argument (1..UINT32_MAX)
+ */
+static int parse_quest_id(const char *cmd, const char *arg, unsigned long *out)
+{
+    char *end;
+    unsigned long id = strtoul(arg, &end, 10);
+
+    if (end == arg || *end != '\0' || id == 0 || id > UINT32_MAX) {
+        fprintf(stderr, "hunter %s: invalid quest id '%s'\n", cmd, arg);
+        return -1;
+    }
+
+    *out = id;
+    return 0;
+}
+
+/*
+ * json_string — Print s as a JSON string literal
+ *
+ * Quotes, backslashes and control characters must be escaped.
+ * UTF-8 passes through unchanged (JSON text is UTF-8).
+ */
+static void json_string(const char *s)
+{
+    putchar('"');
+    for (; *s != '\0'; s++) {
+        unsigned char c = (unsigned char)*s;
+        switch (c) {
+            case '"':  fputs("\\\"", stdout); break;
+            case '\\': fputs("\\\\", stdout); break;
+            case '\n': fputs("\\n", stdout);  break;
+            case '\t': fputs("\\t", stdout);  break;
+            default:
+                if (c < 0x20) {
+                    printf("\\u%04x", c);
+                } else {
+                    putchar(c);
+                }
+                break;
+        }
+    }
+    putchar('"');
+}
+
+/*
+ * ============================================================================
+ * COMMANDS
+ * ============================================================================
+ */
+
+static int cmd_status(int argc, char *argv[], Hunter *h, QuestList *ql,
+                      History *hist)
+{
+    int json = 0;
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = 1;
+        } else {
+            fprintf(stderr, "hunter status: unknown option '%s'\n", argv[i]);
+            return CLI_ERR_USAGE;
+        }
+    }
+
+    if (load(h, ql, hist) != 0) {
+        return CLI_ERR;
+    }
+
+    if (!json) {
+        printf("%s | Day %u | %s | XP %u/%u | Streak %u\n",
+               h->name, h->current_day, hunter_get_rank_name(h->rank),
+               h->total_xp, h->xp_to_next_rank, h->current_streak);
+        return CLI_OK;
+    }
+
+    printf("{\"name\":");
+    json_string(h->name);
+    printf(",\"title\":");
+    json_string(h->title);
+    printf(",\"rank\":");
+    json_string(hunter_get_rank_name(h->rank));
+    printf(",\"day\":%u,\"xp\":%u,\"xp_next\":%u"
+           ",\"streak\":%u,\"longest_streak\":%u"
+           ",\"quests_completed\":%u,\"deaths\":%u",
+           h->current_day, h->total_xp, h->xp_to_next_rank,
+           h->current_streak, h->longest_streak,
+           h->quests_completed, h->deaths);
+    printf(",\"stats\":{\"str\":%d,\"int\":%d,\"sys\":%d"
+           ",\"gpu\":%d,\"sec\":%d,\"end\":%d}}\n",
+           h->stats.strength, h->stats.intelligence, h->stats.systems,
+           h->stats.gpu, h->stats.security, h->stats.endurance);
+    return CLI_OK;
+}
+
+static int cmd_list(int argc, char *argv[], Hunter *h, QuestList *ql,
+                    History *hist)
+{
+    static const char prefix[] = "--status=";
+    int filter = -1;   /* -1 = all */
+
+    for (int i = 2; i < argc; i++) {
+        if (strncmp(argv[i], prefix, sizeof(prefix) - 1) != 0) {
+            fprintf(stderr, "hunter list: unknown option '%s'\n", argv[i]);
+            return CLI_ERR_USAGE;
+        }
+
+        const char *want = argv[i] + sizeof(prefix) - 1;
+        filter = -1;
+        for (size_t s = 0; s < STATUS_KEY_COUNT; s++) {
+            if (strcmp(want, STATUS_KEYS[s]) == 0) {
+                filter = (int)s;
+                break;
+            }
+        }
+        if (filter < 0 && strcmp(want, "all") != 0) {
+            fprintf(stderr, "hunter list: unknown status '%s'\n", want);
+            return CLI_ERR_USAGE;
+        }
+    }
+
+    if (load(h, ql, hist) != 0) {
+        return CLI_ERR;
+    }
+
+    for (uint32_t i = 0; i < ql->count; i++) {
+        const Quest *q = &ql->quests[i];
+        if (filter >= 0 && (int)q->status != filter) {
+            continue;
+        }
+        printf("%u\t%s\t%s\n", q->id, status_key(q->status), q->name);
+    }
+
+    return CLI_OK;
+}
+
+static int cmd_complete(int argc, char *argv[], Hunter *h, QuestList *ql,
+                        History *hist)
+{
+    unsigned long id;
+    Quest *q;
+    uint32_t xp;
+    SaveResult result;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: hunter complete <quest-id>\n");
+        return CLI_ERR_USAGE;
+    }
+
+    if (parse_quest_id("complete", argv[2], &id) != 0) {
+        return CLI_ERR_USAGE;
+    }
+
+    if (load(h, ql, hist) != 0) {
+        return CLI_ERR;
+    }
+
+    q = questlist_find(ql, (uint32_t)id);
+    if (q == NULL) {
+        fprintf(stderr, "hunter complete: no quest with id %lu\n", id);
+        return CLI_ERR;
+    }
+
+    if (q->status == QUEST_STATUS_AVAILABLE) {
+        quest_accept(q, h);
+    }
+    if (q->status != QUEST_STATUS_ACTIVE) {
+        fprintf(stderr, "hunter complete: quest %lu is %s\n",
+                id, status_key(q->status));
+        return CLI_ERR;
+    }
+
+    xp = quest_complete(q, h);
+
+    result = save_write(h, ql, hist);
+    if (result != SAVE_OK) {
+        fprintf(stderr, "hunter complete: save failed: %s\n",
+                save_result_string(result));
+        return CLI_ERR;
+    }
+
+    printf("%u\t%s\t+%u XP\n", q->id, q->name, xp);
+    return CLI_OK;
+}
+
+static int cmd_fail(int argc, char *argv[], Hunter *h, QuestList *ql,
+                    History *hist)
+{
+    unsigned long id;
+    Quest *q;
+    SaveResult result;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: hunter fail <quest-id>\n");
+        return CLI_ERR_USAGE;
+    }
+
+    if (parse_quest_id("fail", argv[2], &id) != 0) {
+        return CLI_ERR_USAGE;
+    }
+
+    if (load(h, ql, hist) != 0) {
+        return CLI_ERR;
+    }
+
+    q = questlist_find(ql, (uint32_t)id);
+    if (q == NULL) {
+        fprintf(stderr, "hunter fail: no quest with id %lu\n", id);
+        return CLI_ERR;
+    }
+
+    if (q->status == QUEST_STATUS_AVAILABLE) {
+        quest_accept(q, h);
+    }
+    if (q->status != QUEST_STATUS_ACTIVE) {
+        fprintf(stderr, "hunter fail: quest %lu is %s\n",
+                id, status_key(q->status));
+        return CLI_ERR;
+    }
+
+    quest_fail(q, h);
+
+    result = save_write(h, ql, hist);
+    if (result != SAVE_OK) {
+        fprintf(stderr, "hunter fail: save failed: %s\n",
+                save_result_string(result));
+        return CLI_ERR;
+    }
+
+    printf("%u\t%s\tdeaths %u\n", q->id, q->name, h->deaths);
+    return CLI_OK;
+}
+
+/*
+ * ============================================================================
+ * DISPATCH
+ * ============================================================================
+ */
+
+typedef int (*CliCommand)(int argc, char *argv[], Hunter *h, QuestList *ql,
+                          History *hist);
+
+static const struct {
+    const char *name;
+    CliCommand run;
+} COMMANDS[] = {
+    { "status",   cmd_status   },
+    { "list",     cmd_list     },
+    { "complete", cmd_complete },
+    { "fail",     cmd_fail     },
+};
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: hunter                       interactive mode\n"
+            "       hunter status [--json]\n"
+            "       hunter list [--status=locked|available|active|completed|failed|all]\n"
+            "       hunter complete <quest-id>\n"
+            "       hunter fail <quest-id>\n");
+}
+
+int cli_run(int argc, char *argv[], Hunter *h, QuestList *ql, History *hist)
+{
+    if (argc < 2 || argv == NULL || h == NULL || ql == NULL || hist == NULL) {
+        usage();
+        return CLI_ERR_USAGE;
+    }
+
+    for (size_t i = 0; i < sizeof(COMMANDS) / sizeof(COMMANDS[0]); i++) {
+        if (strcmp(argv[1], COMMANDS[i].name) == 0) {
+            int rc = COMMANDS[i].run(argc, argv, h, ql, hist);
+            if (fflush(stdout) != 0 && rc == CLI_OK) {
+                rc = CLI_ERR;   /* e.g. stdout was a closed pipe */
+            }
+            return rc;
+        }
+    }
+
+    if (strcmp(argv[1], "help") == 0 || strcmp(argv[1], "--help") == 0 ||
+        strcmp(argv[1], "-h") == 0) {
+        usage();
+        return CLI_OK;
+    }
+
+    fprintf(stderr, "hunter: unknown command '%s'\n", argv[1]);
+    usage();
+    return CLI_ERR_USAGE;
+}
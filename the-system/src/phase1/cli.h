@@ -0,0 +1,56 @@
+/*
+ * cli.h — Non-Interactive Command Line Mode
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * The interactive menu clears the screen and waits for input, which is
+ * useless for cron jobs and shell prompt hooks. When hunter is started
+ * with arguments it runs a single command instead:
+ *
+ *   hunter status [--json]         Print the Hunter profile
+ *   hunter list [--status=NAME]    One quest per line: id, status, name
+ *   hunter complete <id>           Accept (if needed) and complete a quest
+ *   hunter fail <id>               Accept (if needed) and fail a quest (a death)
+ *
+ * Each command loads the save, acts, saves if something changed and
+ * exits. No terminal setup, no prompts, no colors.
+ *
+ * Exit codes:
+ *   0  success
+ *   1  runtime error (no save, unknown quest, save failed, ...)
+ *   2  usage error
+ *
+ * Learning Focus:
+ *   - argc/argv parsing
+ *   - Exit codes as an interface
+ *   - Machine-readable output (JSON escaping)
+ */
+
+#ifndef CLI_H
+#define CLI_H
+
+#include "hunter.h"
+#include "quest.h"
+#include "history.h"
+
+/* Exit codes */
+#define CLI_OK         0
+#define CLI_ERR        1
+#define CLI_ERR_USAGE  2
+
+/*
+ * cli_run — Execute one subcommand and return an exit code
+ *
+ * Parameters:
+ *   argc, argv — As passed to main (argv[1] is the subcommand)
+ *   h          — Hunter storage (filled from the save)
+ *   ql         — Quest list storage (filled from the save)
+ *   hist       — History storage (filled from the save)
+ *
+ * Returns:
+ *   CLI_OK, CLI_ERR or CLI_ERR_USAGE
+ */
+int cli_run(int argc, char *argv[], Hunter *h, QuestList *ql, History *hist);
+
+#endif /* CLI_H */
@@ -5,8 +5,8 @@
  * Phase 1: The Seed
  * 
  * Learning Focus:
- *   - printf formatting and escape codes
- *   - ANSI terminal control
+ *   - printf formatting
+ *   - Terminal attributes through a state machine (term.h)
  *   - ASCII art and box drawing characters
  */
 
@@ -16,34 +16,8 @@
 #include <ctype.h>
 
 #include "display.h"
-
-/*
- * ============================================================================
- * ANSI ESCAPE CODES
- * ============================================================================
- * 
- * These are special character sequences that control terminal behavior.
- * They start with ESC (0x1B or \033) followed by '[' and a command.
- * 
- * Not all terminals support these, but most modern ones do.
- */
-
-#define ANSI_RESET      "\033[0m"
-#define ANSI_BOLD       "\033[1m"
-#define ANSI_DIM        "\033[2m"
-#define ANSI_UNDERLINE  "\033[4m"
-
-#define ANSI_BLACK      "\033[30m"
-#define ANSI_RED        "\033[31m"
-#define ANSI_GREEN      "\033[32m"
-#define ANSI_YELLOW     "\033[33m"
-#define ANSI_BLUE       "\033[34m"
-#define ANSI_MAGENTA    "\033[35m"
-#define ANSI_CYAN       "\033[36m"
-#define ANSI_WHITE      "\033[37m"
-
-#define ANSI_CLEAR      "\033[2J"
-#define ANSI_HOME       "\033[H"
+#include "term.h"
+#include "textlayout.h"
 
 /*
  * ============================================================================
@@ -53,28 +27,13 @@
 
 void display_clear(void)
 {
-    /*
-     * \033[2J clears the screen
-     * \033[H moves cursor to home position (top-left)
-     * Combined, they reset the terminal view.
-     */
-    printf(ANSI_CLEAR ANSI_HOME);
-    fflush(stdout);
+    /* No-op when stdout isn't a terminal (e.g. piped into a log) */
+    term_clear();
 }
 
 void display_set_title(const char *title)
 {
-    if (title == NULL) {
-        return;
-    }
-    
-    /*
-     * OSC (Operating System Command) sequence for setting window title.
-     * \033]0; starts the title sequence
-     * \007 (BEL) ends it
-     */
-    printf("\033]0;%s\007", title);
-    fflush(stdout);
+    term_set_title(title);
 }
 
 /*
@@ -85,7 +44,7 @@ void display_set_title(const char *title)
 
 void display_banner(void)
 {
-    printf(ANSI_CYAN);
+    TermAttr prev = term_set(TERM_CYAN);
     printf("╔═══════════════════════════════════════════════════════════════════╗\n");
     printf("║                                                                   ║\n");
     printf("║   ████████╗██╗  ██╗███████╗    ███████╗██╗   ██╗███████╗          ║\n");
@@ -98,7 +57,7 @@ void display_banner(void)
     printf("║                  H U N T E R   P R O T O C O L                    ║\n");
     printf("║                                                                   ║\n");
     printf("╚═══════════════════════════════════════════════════════════════════╝\n");
-    printf(ANSI_RESET);
+    term_set(prev);
 }
 
 void display_notification(const char *message)
@@ -107,9 +66,9 @@ void display_notification(const char *message)
         return;
     }
     
-    printf(ANSI_YELLOW ANSI_BOLD);
+    TermAttr prev = term_set(TERM_YELLOW | TERM_BOLD);
     printf("  「 %s 」\n", message);
-    printf(ANSI_RESET);
+    term_set(prev);
 }
 
 void display_alert(const char *message)
@@ -118,12 +77,14 @@ void display_alert(const char *message)
         return;
     }
     
-    printf(ANSI_RED ANSI_BOLD);
+    TermAttr prev = term_set(TERM_RED | TERM_BOLD);
     printf("\n");
     printf("  ╔═══════════════════════════════════════╗\n");
-    printf("  ║ ! ALERT: %-28s ║\n", message);
+    printf("  ║ ! ALERT: ");
+    text_print_fit(message, 28);
+    printf(" ║\n");
     printf("  ╚═══════════════════════════════════════╝\n");
-    printf(ANSI_RESET);
+    term_set(prev);
 }
 
 /*
@@ -210,22 +171,170 @@ void display_xp_bar(uint32_t current, uint32_t target)
     filled = (int)(progress * bar_width);
     
     printf("  XP: ");
-    printf(ANSI_GREEN);
+    TermAttr prev = term_set(TERM_GREEN);
     for (i = 0; i < filled; i++) {
         printf("█");
     }
-    printf(ANSI_DIM);
+    term_set(TERM_DIM);
     for (i = filled; i < bar_width; i++) {
         printf("░");
     }
-    printf(ANSI_RESET);
+    term_set(prev);
     printf(" %u/%u\n", current, target);
 }
 
+/*
+ * chart_window — First bucket tag shown by the charts
+ * 
+ * Until the Protocol is over the window is days 1-210.
+ * After that it slides so the latest day is always on the right.
+ */
+static uint32_t chart_window(const History *hist)
+{
+    uint32_t last = hist->last_day;
+    
+    if (last <= HISTORY_CHART_DAYS) {
+        return 0;
+    }
+    
+    return (last - 1) / HISTORY_BUCKET_DAYS + 1 - HISTORY_BUCKETS;
+}
+
+void display_history_sparkline(const History *hist, uint32_t width)
+{
+    static const char *LEVELS[] = {
+        "▁", "▂", "▃", "▄", "▅", "▆", "▇", "█"
+    };
+    uint32_t group_max[HISTORY_BUCKETS];
+    uint32_t first, peak = 0;
+    
+    if (hist == NULL || width == 0) {
+        return;
+    }
+    if (width > HISTORY_BUCKETS) {
+        width = HISTORY_BUCKETS;
+    }
+    
+    first = chart_window(hist);
+    
+    /* Fold buckets into `width` groups, keeping each group's maximum */
+    for (uint32_t g = 0; g < width; g++) {
+        uint32_t lo = g * HISTORY_BUCKETS / width;
+        uint32_t hi = (g + 1) * HISTORY_BUCKETS / width;
+        group_max[g] = 0;
+        for (uint32_t b = lo; b < hi; b++) {
+            const HistoryBucket *bk = history_bucket(hist, first + b);
+            if (bk != NULL && bk->xp_max > group_max[g]) {
+                group_max[g] = bk->xp_max;
+            }
+        }
+        if (group_max[g] > peak) {
+            peak = group_max[g];
+        }
+    }
+    
+    printf("  XP ");
+    TermAttr prev = term_set(TERM_CYAN);
+    for (uint32_t g = 0; g < width; g++) {
+        if (group_max[g] == 0) {
+            printf(" ");
+        } else {
+            uint32_t level = (uint32_t)(((uint64_t)group_max[g] * 8 - 1) / peak);
+            printf("%s", LEVELS[level]);
+        }
+    }
+    term_set(prev);
+    printf("  (max %u/day)\n", peak);
+}
+
+/*
+ * put_braille — Print braille cell U+2800 + bits as UTF-8
+ * 
+ * Dot numbering (bit = dot - 1):
+ *   1 4
+ *   2 5
+ *   3 6
+ *   7 8
+ */
+static void put_braille(unsigned int bits)
+{
+    putchar(0xE2);
+    putchar((int)(0xA0 | (bits >> 6)));
+    putchar((int)(0x80 | (bits & 0x3F)));
+}
+
+void display_history_chart(const History *hist, uint32_t rows)
+{
+    /* Dot bits by [column][dot row from top] */
+    static const unsigned int DOT[2][4] = {
+        { 0x01, 0x02, 0x04, 0x40 },
+        { 0x08, 0x10, 0x20, 0x80 }
+    };
+    uint32_t lo_dot[HISTORY_BUCKETS], hi_dot[HISTORY_BUCKETS];
+    uint32_t first, peak = 0, levels;
+    
+    if (hist == NULL || rows == 0) {
+        return;
+    }
+    
+    first = chart_window(hist);
+    levels = rows * 4;
+    
+    for (uint32_t b = 0; b < HISTORY_BUCKETS; b++) {
+        const HistoryBucket *bk = history_bucket(hist, first + b);
+        if (bk != NULL && bk->xp_max > peak) {
+            peak = bk->xp_max;
+        }
+    }
+    
+    /*
+     * Convert each bucket's [min, max] into a dot range [lo, hi),
+     * counted from the bottom. Empty buckets get lo == hi.
+     */
+    for (uint32_t b = 0; b < HISTORY_BUCKETS; b++) {
+        const HistoryBucket *bk = history_bucket(hist, first + b);
+        lo_dot[b] = hi_dot[b] = 0;
+        if (bk != NULL && peak > 0) {
+            hi_dot[b] = (uint32_t)(((uint64_t)bk->xp_max * levels + peak - 1) / peak);
+            lo_dot[b] = (uint32_t)((uint64_t)bk->xp_min * levels / peak);
+            if (lo_dot[b] >= hi_dot[b]) {
+                lo_dot[b] = hi_dot[b] - 1;
+            }
+        }
+    }
+    
+    TermAttr prev = term_set(TERM_GREEN);
+    for (uint32_t r = 0; r < rows; r++) {
+        printf("  │");
+        for (uint32_t c = 0; c < (HISTORY_BUCKETS + 1) / 2; c++) {
+            unsigned int bits = 0;
+            for (uint32_t half = 0; half < 2; half++) {
+                uint32_t b = c * 2 + half;
+                if (b >= HISTORY_BUCKETS) {
+                    break;
+                }
+                for (uint32_t dot = 0; dot < 4; dot++) {
+                    uint32_t level = (rows - 1 - r) * 4 + (3 - dot);
+                    if (level >= lo_dot[b] && level < hi_dot[b]) {
+                        bits |= DOT[half][dot];
+                    }
+                }
+            }
+            put_braille(bits);
+        }
+        printf("\n");
+    }
+    term_set(prev);
+    printf("  └ day %u", first * HISTORY_BUCKET_DAYS + 1);
+    printf("%*s", (int)((HISTORY_BUCKETS + 1) / 2 - 12), "");
+    printf("day %u  (peak %u XP)\n",
+           (first + HISTORY_BUCKETS) * HISTORY_BUCKET_DAYS, peak);
+}
+
 void display_rank_up(HunterRank old_rank, HunterRank new_rank)
 {
     printf("\n");
-    printf(ANSI_YELLOW ANSI_BOLD);
+    TermAttr prev = term_set(TERM_YELLOW | TERM_BOLD);
     printf("  ╔═══════════════════════════════════════════════════════════╗\n");
     printf("  ║                                                           ║\n");
     printf("  ║                    「 RANK UP 」                           ║\n");
@@ -236,7 +345,7 @@ void display_rank_up(HunterRank old_rank, HunterRank new_rank)
     printf("  ║              You have grown stronger.                     ║\n");
     printf("  ║                                                           ║\n");
     printf("  ╚═══════════════════════════════════════════════════════════╝\n");
-    printf(ANSI_RESET);
+    term_set(prev);
     printf("\n");
 }
 
@@ -285,6 +394,45 @@ void display_quest_list(Quest **quests, int count, const char *title)
     }
 }
 
+void display_quest_view(const QuestView *v, const char *title)
+{
+    Quest *rows[QUESTVIEW_MAX_HEIGHT];
+    uint32_t n;
+    
+    if (v == NULL) {
+        return;
+    }
+    
+    if (title != NULL) {
+        printf("\n  ═══ %s ═══", title);
+        if (v->query_len > 0) {
+            printf("   search: %s", v->query);
+        }
+        printf("\n\n");
+    }
+    
+    if (v->match_count == 0) {
+        printf("  No matching quests.\n");
+        return;
+    }
+    
+    n = questview_visible(v, rows, QUESTVIEW_MAX_HEIGHT);
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t row = v->top + i;
+        printf("  %s%3u. ", (row == v->cursor) ? "▶" : " ", row + 1);
+        printf("[%s] %s (+%u XP)\n",
+               quest_get_status_name(rows[i]->status),
+               rows[i]->name,
+               rows[i]->rewards.xp);
+    }
+    
+    printf("  ── %u-%u of %u", v->top + 1, v->top + n, v->match_count);
+    if (v->match_count != v->index_count) {
+        printf(" matches (%u total)", v->index_count);
+    }
+    printf(" ──\n");
+}
+
 void display_quest_complete(const Quest *q, uint32_t xp_earned)
 {
     if (q == NULL) {
@@ -292,12 +440,14 @@ void display_quest_complete(const Quest *q, uint32_t xp_earned)
     }
     
     printf("\n");
-    printf(ANSI_GREEN ANSI_BOLD);
+    TermAttr prev = term_set(TERM_GREEN | TERM_BOLD);
     printf("  ╔═══════════════════════════════════════════════════════════╗\n");
     printf("  ║                                                           ║\n");
     printf("  ║                「 QUEST COMPLETE 」                        ║\n");
     printf("  ║                                                           ║\n");
-    printf("  ║  %-55s  ║\n", q->name);
+    printf("  ║  ");
+    text_print_fit(q->name, 55);
+    printf("  ║\n");
     printf("  ║                                                           ║\n");
     printf("  ║  Rewards:                                                 ║\n");
     printf("  ║    +%u XP                                                 \n", xp_earned);
@@ -311,7 +461,7 @@ void display_quest_complete(const Quest *q, uint32_t xp_earned)
     }
     printf("  ║                                                           ║\n");
     printf("  ╚═══════════════════════════════════════════════════════════╝\n");
-    printf(ANSI_RESET);
+    term_set(prev);
     printf("\n");
 }
 
@@ -322,18 +472,20 @@ void display_death(const Quest *q)
     }
     
     printf("\n");
-    printf(ANSI_RED ANSI_BOLD);
+    TermAttr prev = term_set(TERM_RED | TERM_BOLD);
     printf("  ╔═══════════════════════════════════════════════════════════╗\n");
     printf("  ║                                                           ║\n");
     printf("  ║                    「 YOU DIED 」                          ║\n");
     printf("  ║                                                           ║\n");
-    printf("  ║  Quest Failed: %-40s  ║\n", q->name);
+    printf("  ║  Quest Failed: ");
+    text_print_fit(q->name, 40);
+    printf("  ║\n");
     printf("  ║                                                           ║\n");
     printf("  ║            But death is not the end.                      ║\n");
     printf("  ║                 Respawn. Retry. Rise.                     ║\n");
     printf("  ║                                                           ║\n");
     printf("  ╚═══════════════════════════════════════════════════════════╝\n");
-    printf(ANSI_RESET);
+    term_set(prev);
     printf("\n");
 }
 
@@ -390,6 +542,33 @@ int display_confirm(const char *question)
     return (response == 'y');
 }
 
+int display_read_line(const char *prompt, char *buf, size_t bufsize)
+{
+    size_t len;
+    
+    if (buf == NULL || bufsize == 0) {
+        return -1;
+    }
+    
+    if (prompt != NULL) {
+        printf("  %s", prompt);
+    }
+    
+    fflush(stdout);
+    
+    if (fgets(buf, (int)bufsize, stdin) == NULL) {
+        buf[0] = '\0';
+        return -1;
+    }
+    
+    len = strlen(buf);
+    if (len > 0 && buf[len - 1] == '\n') {
+        buf[--len] = '\0';
+    }
+    
+    return (int)len;
+}
+
 /*
  * ============================================================================
  * UTILITY
@@ -18,8 +18,12 @@
 #ifndef DISPLAY_H
 #define DISPLAY_H
 
+#include <stddef.h>
+
 #include "hunter.h"
 #include "quest.h"
+#include "questview.h"
+#include "history.h"
 
 /*
  * ============================================================================
@@ -112,6 +116,25 @@ void display_stat_bar(const char *name, int value, int max_display);
  */
 void display_xp_bar(uint32_t current, uint32_t target);
 
+/*
+ * display_history_sparkline — One-line XP graph of the Protocol
+ * 
+ * Example: XP ▁▂▂▄▃▅▇█▆▅▇  (max 340/day)
+ * 
+ * Reads the precomputed chart buckets only, so the cost depends on
+ * width, not on how many days have been recorded.
+ */
+void display_history_sparkline(const History *hist, uint32_t width);
+
+/*
+ * display_history_chart — Braille min/max chart of daily XP
+ * 
+ * Each braille character packs 2 buckets × 4 dot rows, so
+ * 210 days fit in HISTORY_BUCKETS / 2 columns.
+ * A column is filled from the bucket's lowest to highest day.
+ */
+void display_history_chart(const History *hist, uint32_t rows);
+
 /*
  * display_rank_up — Special animation for rank increase
  * 
@@ -145,6 +168,19 @@ void display_quest_compact(const Quest *q);
  */
 void display_quest_list(Quest **quests, int count, const char *title);
 
+/*
+ * display_quest_view — Draw one page of a virtual quest list
+ * 
+ * Only the rows inside the viewport are formatted, so the cost
+ * depends on the page height, not on how many quests exist.
+ * 
+ *   ═══ AVAILABLE QUESTS ═══   search: mem
+ *   ▶ 12. [Available] Memory Palace (+75 XP)
+ *     13. [Available] Memory Regions (+80 XP)
+ *   ── 1-2 of 2 matches (240 total) ──
+ */
+void display_quest_view(const QuestView *v, const char *title);
+
 /*
  * display_quest_complete — Animation for completing a quest
  */
@@ -185,6 +221,17 @@ char display_prompt(const char *prompt);
  */
 int display_confirm(const char *question);
 
+/*
+ * display_read_line — Show prompt and read a full line
+ * 
+ * The trailing newline is removed.
+ * 
+ * Returns:
+ *   Number of characters read
+ *  -1 on EOF or error
+ */
+int display_read_line(const char *prompt, char *buf, size_t bufsize);
+
 /*
  * ============================================================================
  * UTILITY
@@ -0,0 +1,540 @@
+/*
+ * event.c — Event Log and Replay Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Keeping the reducer free of side effects
+ *   - Append-only files with O_APPEND
+ *   - mmap for read-mostly data
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "event.h"
+#include "progression.h"
+#include "save.h"
+
+/*
+ * ============================================================================
+ * REDUCER
+ * ============================================================================
+ */
+
+/*
+ * grant_stat — Add to one stat by index (caps apply)
+ */
+static void grant_stat(Hunter *h, uint8_t stat, int32_t value)
+{
+    HunterStats bonus = { 0, 0, 0, 0, 0, 0 };
+
+    switch (stat) {
+    case 0: bonus.strength = value; break;
+    case 1: bonus.intelligence = value; break;
+    case 2: bonus.systems = value; break;
+    case 3: bonus.gpu = value; break;
+    case 4: bonus.security = value; break;
+    case 5: bonus.endurance = value; break;
+    default: return;
+    }
+
+    hunter_add_stats(h, &bonus);
+}
+
+void event_apply(Hunter *h, const Event *e)
+{
+    if (h == NULL || e == NULL) {
+        return;
+    }
+
+    switch ((EventType)e->type) {
+    case EVENT_QUEST_ACCEPTED:
+        /* Quest state lives in the QuestList; nothing changes on the Hunter */
+        break;
+
+    case EVENT_QUEST_COMPLETED:
+        hunter_mark_active(h, e->day);
+        h->quests_completed++;
+        if (e->arg == QUEST_TYPE_BOSS) {
+            h->boss_quests_completed++;
+        } else if (e->arg == QUEST_TYPE_SHADOW) {
+            h->shadow_quests_found++;
+        }
+        break;
+
+    case EVENT_QUEST_FAILED:
+        h->deaths++;
+        break;
+
+    case EVENT_XP_GRANTED:
+        if (e->value > 0) {
+            hunter_add_xp(h, (uint32_t)e->value);
+        }
+        break;
+
+    case EVENT_STAT_GRANTED:
+        grant_stat(h, e->arg, e->value);
+        break;
+    }
+}
+
+size_t event_quest_rewards(const Quest *q, uint32_t hunter, uint32_t day,
+                           uint32_t streak, Event *out)
+{
+    size_t n = 0;
+
+    if (q == NULL || out == NULL) {
+        return 0;
+    }
+
+    const HunterStats *sb = &q->rewards.stat_bonus;
+    const int bonus[PROG_STATS] = {
+        sb->strength, sb->intelligence, sb->systems,
+        sb->gpu, sb->security, sb->endurance
+    };
+
+    memset(out, 0, (EVENT_MAX_PER_QUEST - 1) * sizeof(*out));
+
+    out[n].type = EVENT_XP_GRANTED;
+    out[n].day = (uint16_t)day;
+    out[n].hunter = hunter;
+    out[n].quest = q->id;
+    out[n].value = (int32_t)progression_scale_xp(q->rewards.xp, streak);
+    n++;
+
+    for (uint8_t s = 0; s < PROG_STATS; s++) {
+        if (bonus[s] == 0) {
+            continue;
+        }
+        out[n].type = EVENT_STAT_GRANTED;
+        out[n].arg = s;
+        out[n].day = (uint16_t)day;
+        out[n].hunter = hunter;
+        out[n].quest = q->id;
+        out[n].value = bonus[s];
+        n++;
+    }
+
+    return n;
+}
+
+/*
+ * ============================================================================
+ * LOG FILE
+ * ============================================================================
+ */
+
+static int g_log_fd = -1;
+static int g_log_default = 0;   /* Open ~/.hunter-protocol/events.dat on first emit */
+static char g_log_path[EVENT_PATH_MAX];
+
+static struct {
+    EventObserver fn;
+    void *ctx;
+} g_observers[EVENT_MAX_OBSERVERS];
+static size_t g_observer_count = 0;
+
+int event_add_observer(EventObserver fn, void *ctx)
+{
+    if (fn == NULL || g_observer_count >= EVENT_MAX_OBSERVERS) {
+        return -1;
+    }
+
+    g_observers[g_observer_count].fn = fn;
+    g_observers[g_observer_count].ctx = ctx;
+    g_observer_count++;
+    return 0;
+}
+
+/*
+ * write_header — Start an empty log file
+ */
+static int write_header(int fd)
+{
+    EventFileHeader header;
+
+    header.magic = EVENT_MAGIC;
+    header.version = EVENT_VERSION;
+    header.record_size = sizeof(Event);
+    header.reserved = 0;
+
+    if (write(fd, &header, sizeof(header)) != (ssize_t)sizeof(header)) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * rotate_log — Move a log aside as <path><suffix>
+ *
+ * Whatever already had that name is replaced.
+ */
+static int rotate_log(const char *path, const char *suffix)
+{
+    char rotated[EVENT_PATH_MAX + 16];
+    int written;
+
+    written = snprintf(rotated, sizeof(rotated), "%s%s", path, suffix);
+    if (written < 0 || (size_t)written >= sizeof(rotated)) {
+        return -1;
+    }
+
+    if (rename(path, rotated) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * check_header — Is this file a log we can append to?
+ *
+ * Returns:
+ *   0 if it's empty or has our header; otherwise -1, with the name
+ *   suffix to rotate it to (".v1" for an older version, ".bad" for
+ *   anything else) in suffix
+ */
+static int check_header(int fd, const struct stat *st, char *suffix, size_t size)
+{
+    EventFileHeader header;
+
+    if (st->st_size == 0) {
+        return 0;
+    }
+
+    if ((size_t)st->st_size < sizeof(header) ||
+        pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+        header.magic != EVENT_MAGIC) {
+        snprintf(suffix, size, ".bad");
+        return -1;
+    }
+
+    if (header.version != EVENT_VERSION || header.record_size != sizeof(Event)) {
+        snprintf(suffix, size, ".v%u", (unsigned)header.version);
+        return -1;
+    }
+
+    return 0;
+}
+
+int event_log_open(const char *path)
+{
+    char suffix[16];
+    struct stat st;
+    int fd;
+
+    event_log_close();
+    g_log_default = 0;
+
+    if (path == NULL) {
+        return 0;
+    }
+
+    if (strlen(path) >= sizeof(g_log_path)) {
+        return -1;
+    }
+
+    fd = open(path, O_RDWR | O_APPEND | O_CREAT, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    /*
+     * Never append to a log written with another layout: replay would
+     * read our records with the wrong meaning. Move it aside and start
+     * a fresh one.
+     */
+    if (check_header(fd, &st, suffix, sizeof(suffix)) != 0) {
+        close(fd);
+        if (rotate_log(path, suffix) != 0) {
+            return -1;
+        }
+        fd = open(path, O_RDWR | O_APPEND | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return -1;
+        }
+        st.st_size = 0;
+    }
+
+    if (st.st_size == 0 && write_header(fd) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    strcpy(g_log_path, path);
+    g_log_fd = fd;
+    return 0;
+}
+
+void event_log_init(void)
+{
+    event_log_close();
+    g_log_default = 1;
+}
+
+void event_log_close(void)
+{
+    if (g_log_fd >= 0) {
+        close(g_log_fd);
+        g_log_fd = -1;
+    }
+}
+
+/*
+ * default_log_path — ~/.hunter-protocol/events.dat
+ */
+static int default_log_path(char *buf, size_t size)
+{
+    const char *home = getenv("HOME");
+    int written;
+
+    if (home == NULL) {
+        return -1;
+    }
+
+    written = snprintf(buf, size, "%s/%s/%s", home, SAVE_DIR, EVENT_FILE);
+    if (written < 0 || (size_t)written >= size) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * open_default_log — Deferred open for event_log_init()
+ */
+static int open_default_log(void)
+{
+    char path[EVENT_PATH_MAX];
+
+    g_log_default = 0;
+
+    if (default_log_path(path, sizeof(path)) != 0) {
+        return -1;
+    }
+
+    return event_log_open(path);
+}
+
+int event_log_reset(void)
+{
+    char path[EVENT_PATH_MAX];
+    int reopen = (g_log_fd >= 0);
+
+    if (reopen) {
+        strcpy(path, g_log_path);
+        event_log_close();
+    } else if (!g_log_default || default_log_path(path, sizeof(path)) != 0) {
+        return 0;                       /* Logging is off */
+    }
+
+    /* Nothing to keep if there's no log yet */
+    if (rotate_log(path, ".prev") != 0 && access(path, F_OK) == 0) {
+        return -1;
+    }
+
+    return reopen ? event_log_open(path) : 0;
+}
+
+int event_emit(Hunter *h, const Event *events, size_t n)
+{
+    size_t bytes = n * sizeof(*events);
+
+    if (events == NULL) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        event_apply(h, &events[i]);
+        for (size_t j = 0; j < g_observer_count; j++) {
+            g_observers[j].fn(h, &events[i], g_observers[j].ctx);
+        }
+    }
+
+    if (g_log_fd < 0 && g_log_default && open_default_log() != 0) {
+        return -1;
+    }
+
+    if (g_log_fd < 0 || n == 0) {
+        return 0;
+    }
+
+    /* One write per batch: O_APPEND keeps a quest's events together */
+    if (write(g_log_fd, events, bytes) != (ssize_t)bytes) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * REPLAY
+ * ============================================================================
+ */
+
+int event_file_map(const char *path, EventFile *out)
+{
+    const EventFileHeader *header;
+    struct stat st;
+    void *map;
+    int fd;
+
+    if (path == NULL || out == NULL) {
+        return -1;
+    }
+
+    memset(out, 0, sizeof(*out));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(EventFileHeader)) {
+        close(fd);
+        return -1;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   /* The mapping keeps the file alive */
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+
+    header = (const EventFileHeader *)map;
+    if (header->magic != EVENT_MAGIC || header->version != EVENT_VERSION ||
+        header->record_size != sizeof(Event)) {
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+
+#if defined(POSIX_MADV_SEQUENTIAL)
+    posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    out->map = map;
+    out->map_size = (size_t)st.st_size;
+    out->events = (const Event *)(header + 1);
+    out->count = (out->map_size - sizeof(*header)) / sizeof(Event);
+    return 0;
+}
+
+void event_file_unmap(EventFile *f)
+{
+    if (f == NULL || f->map == NULL) {
+        return;
+    }
+
+    munmap(f->map, f->map_size);
+    memset(f, 0, sizeof(*f));
+}
+
+/*
+ * RewardIndex — Quest id → Quest, sorted for binary search
+ *
+ * questlist_find() is a linear scan; a rebalance looks up a quest for
+ * every completion, so the table is indexed once per replay.
+ */
+typedef struct {
+    uint32_t id;
+    const Quest *quest;
+} RewardIndex;
+
+static int cmp_reward(const void *a, const void *b)
+{
+    uint32_t x = ((const RewardIndex *)a)->id;
+    uint32_t y = ((const RewardIndex *)b)->id;
+    return (x > y) - (x < y);
+}
+
+static const Quest *reward_find(const RewardIndex *index, size_t n, uint32_t id)
+{
+    size_t lo = 0, hi = n;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index[mid].id < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return (lo < n && index[lo].id == id) ? index[lo].quest : NULL;
+}
+
+size_t event_replay(Hunter *hunters, size_t n, const Event *events,
+                    size_t count, const QuestList *rewards)
+{
+    RewardIndex *index = NULL;
+    size_t indexed = 0;
+    size_t applied = 0;
+
+    if (hunters == NULL || events == NULL) {
+        return 0;
+    }
+
+    if (rewards != NULL && rewards->count > 0) {
+        index = malloc(rewards->count * sizeof(*index));
+        if (index == NULL) {
+            return 0;
+        }
+        for (uint32_t i = 0; i < rewards->count; i++) {
+            index[indexed].id = rewards->quests[i].id;
+            index[indexed].quest = &rewards->quests[i];
+            indexed++;
+        }
+        qsort(index, indexed, sizeof(index[0]), cmp_reward);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const Event *e = &events[i];
+        Hunter *h;
+
+        if (e->hunter >= n) {
+            continue;
+        }
+        h = &hunters[e->hunter];
+
+        if (rewards != NULL && e->quest != 0 &&
+            (e->type == EVENT_XP_GRANTED || e->type == EVENT_STAT_GRANTED)) {
+            continue;   /* Re-derived below from the new quest table */
+        }
+
+        event_apply(h, e);
+        applied++;
+
+        if (rewards != NULL && e->type == EVENT_QUEST_COMPLETED) {
+            Event derived[EVENT_MAX_PER_QUEST];
+            const Quest *q = reward_find(index, indexed, e->quest);
+            size_t k;
+
+            if (q == NULL) {
+                continue;
+            }
+
+            k = event_quest_rewards(q, e->hunter, e->day, h->current_streak,
+                                    derived);
+            for (size_t j = 0; j < k; j++) {
+                event_apply(h, &derived[j]);
+            }
+            applied += k;
+        }
+    }
+
+    free(index);
+    return applied;
+}
@@ -0,0 +1,262 @@
+/*
+ * event.h — Event Log and Replay
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Every change to a Hunter is first written down as an Event, then
+ * applied by one pure function, the reducer:
+ *
+ *   quest_complete ──▶ [COMPLETED q7 day 12] [XP +55 q7] [STAT STR +1 q7]
+ *                                   │
+ *                                   ▼
+ *                 event_apply(hunter, event)  ──▶ Hunter state
+ *                                   │
+ *                                   ▼
+ *                 ~/.hunter-protocol/events.dat (append-only)
+ *
+ * The Hunter in save.dat is then just a cache: folding the log over a
+ * fresh Hunter gives the same state back. Folding it against a NEW
+ * quest table gives the state the Hunter would have had under the new
+ * rewards — a rebalance is a replay, not a hand edit.
+ *
+ * Events are fixed-size (16 bytes) and the file is just a header plus
+ * an array of them, so replay maps the file and walks it in order: no
+ * parsing, no allocation, no syscalls per event.
+ *
+ * XP and STAT events caused by a quest carry its id. A rebalance replay
+ * drops those and derives fresh ones from each COMPLETED event; grants
+ * with quest 0 (bonuses, corrections) are always replayed as recorded.
+ *
+ * Learning Focus:
+ *   - Event sourcing: state = fold(reducer, events)
+ *   - Pure functions and deterministic replay
+ *   - Memory-mapped files (mmap)
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+#include "quest.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Magic number: ASCII "HEVT" */
+#define EVENT_MAGIC    0x48455654
+
+/* Increment this when the Event layout changes */
+#define EVENT_VERSION  2
+
+/* Event log file name (inside SAVE_DIR) */
+#define EVENT_FILE     "events.dat"
+
+/* Longest event log path */
+#define EVENT_PATH_MAX 512
+
+/* Most events one quest completion produces: COMPLETED, XP, 6 stats */
+#define EVENT_MAX_PER_QUEST  8
+
+/* Callbacks event_emit can notify */
+#define EVENT_MAX_OBSERVERS  4
+
+/*
+ * ============================================================================
+ * ENUMERATIONS
+ * ============================================================================
+ */
+
+typedef enum {
+    EVENT_QUEST_ACCEPTED  = 1,
+    EVENT_QUEST_COMPLETED = 2,
+    EVENT_QUEST_FAILED    = 3,
+    EVENT_XP_GRANTED      = 4,
+    EVENT_STAT_GRANTED    = 5
+} EventType;
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * Event — One thing that happened to one Hunter (16 bytes)
+ *
+ * Written to disk as-is: only fixed-width types, laid out so every
+ * field is naturally aligned and there is no padding.
+ */
+typedef struct {
+    uint8_t type;        /* EventType */
+    uint8_t arg;         /* STAT_GRANTED: stat 0-5 (STR INT SYS GPU SEC END)
+                            COMPLETED/FAILED: QuestType */
+    uint16_t day;        /* Protocol day it happened on */
+    uint32_t hunter;     /* Index in the cohort (0 for a single save) */
+    uint32_t quest;      /* Quest id, 0 if not caused by a quest */
+    int32_t value;       /* XP or stat amount */
+} Event;
+
+/*
+ * EventObserver — Called by event_emit after each event is applied
+ *
+ * For things that react to progress (achievements, leaderboards)
+ * without quest code knowing about them. Not called during replay.
+ */
+typedef void (*EventObserver)(Hunter *h, const Event *e, void *ctx);
+
+/*
+ * EventFileHeader — First 16 bytes of an event file
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_size;   /* sizeof(Event) */
+    uint32_t reserved;
+} EventFileHeader;
+
+/*
+ * EventFile — A read-only mapped event file
+ */
+typedef struct {
+    const Event *events;
+    size_t count;
+    void *map;
+    size_t map_size;
+} EventFile;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * event_apply — The reducer: fold one event into a Hunter
+ *
+ * Pure: depends only on the Hunter, the event and the progression
+ * rules. No clock, no I/O. ACCEPTED changes nothing on the Hunter;
+ * FAILED counts a death; COMPLETED also counts boss and shadow quests.
+ *
+ * Events carry a day, not a time, so last_activity is not replayed:
+ * quest_complete sets it, and a replayed Hunter keeps hunter_init's.
+ */
+void event_apply(Hunter *h, const Event *e);
+
+/*
+ * event_quest_rewards — Events granting a quest's rewards
+ *
+ * The XP event always comes first (value may be 0), followed by one
+ * STAT event per non-zero stat bonus.
+ *
+ * Parameters:
+ *   q      — Completed quest
+ *   hunter — Cohort index to put in the events
+ *   day    — Protocol day of the completion
+ *   streak — Hunter's streak including that day (for the XP bonus)
+ *   out    — Room for EVENT_MAX_PER_QUEST - 1 events
+ *
+ * Returns:
+ *   Number of events written
+ */
+size_t event_quest_rewards(const Quest *q, uint32_t hunter, uint32_t day,
+                           uint32_t streak, Event *out);
+
+/*
+ * event_emit — Apply events to a Hunter and append them to the log
+ *
+ * Observers are notified after each event is applied.
+ *
+ * Returns:
+ *   0 on success (or if logging is off)
+ *  -1 if the log write failed (the Hunter is still updated)
+ */
+int event_emit(Hunter *h, const Event *events, size_t n);
+
+/*
+ * event_add_observer — Register a callback for emitted events
+ *
+ * Returns:
+ *   0 on success, -1 if EVENT_MAX_OBSERVERS are already registered
+ */
+int event_add_observer(EventObserver fn, void *ctx);
+
+/*
+ * event_log_init — Turn on logging to ~/.hunter-protocol/events.dat
+ *
+ * Nothing is opened until the first event_emit, so read-only
+ * commands never touch the file.
+ */
+void event_log_init(void);
+
+/*
+ * event_log_open — Log to a specific file (NULL turns logging off)
+ *
+ * A file written with another version or record size is renamed to
+ * <path>.v<version> (anything unreadable to <path>.bad) and a fresh
+ * log is started in its place.
+ *
+ * Returns:
+ *   0 on success, -1 if the file can't be opened
+ */
+int event_log_open(const char *path);
+
+/*
+ * event_log_reset — Start an empty log for a new Hunter
+ *
+ * The old log is kept as <path>.prev, so replay never mixes two
+ * Hunters' events. Does nothing if logging is off.
+ *
+ * Returns:
+ *   0 on success, -1 if the old log couldn't be moved aside
+ */
+int event_log_reset(void);
+
+/*
+ * event_log_close — Close the log file
+ */
+void event_log_close(void);
+
+/*
+ * event_file_map — Map an event file for replay
+ *
+ * A torn final record (crash mid-append) is ignored.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the file can't be opened or isn't an event file
+ */
+int event_file_map(const char *path, EventFile *out);
+
+/*
+ * event_file_unmap — Release a mapped event file
+ */
+void event_file_unmap(EventFile *f);
+
+/*
+ * event_replay — Fold a stream of events into a cohort
+ *
+ * Hunters must be initialized (hunter_init) by the caller; events for
+ * hunter indices >= n are skipped.
+ *
+ * Parameters:
+ *   hunters — Cohort, indexed by Event.hunter
+ *   n       — Cohort size
+ *   events  — Events in the order they happened
+ *   count   — Number of events
+ *   rewards — NULL to replay as recorded, or a quest table to
+ *             re-derive quest rewards from (rebalance)
+ *
+ * Returns:
+ *   Number of events applied (0 if the rewards index can't be allocated)
+ */
+size_t event_replay(Hunter *hunters, size_t n, const Event *events,
+                    size_t count, const QuestList *rewards);
+
+#endif /* EVENT_H */
@@ -0,0 +1,334 @@
+/*
+ * history.c — Daily Progress Time-Series Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Ring buffer indexing with a power-of-two mask
+ *   - LEB128 varints and zigzag encoding
+ *   - Keeping aggregates up to date incrementally
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "history.h"
+#include "stat.h"
+
+#define DAY_SLOT(day)    ((day) & (HISTORY_DAYS - 1))
+#define BUCKET_OF(day)   (((day) - 1) / HISTORY_BUCKET_DAYS)
+#define BUCKET_SLOT(tag) ((tag) % HISTORY_BUCKETS)
+
+/*
+ * ============================================================================
+ * RING BUFFER
+ * ============================================================================
+ */
+
+void history_init(History *hist)
+{
+    if (hist == NULL) {
+        return;
+    }
+
+    memset(hist, 0, sizeof(*hist));
+}
+
+const HistoryDay *history_get(const History *hist, uint32_t day)
+{
+    const HistoryDay *d;
+
+    if (hist == NULL || day == 0) {
+        return NULL;
+    }
+
+    d = &hist->days[DAY_SLOT(day)];
+    return (d->day == day) ? d : NULL;
+}
+
+const HistoryBucket *history_bucket(const History *hist, uint32_t tag)
+{
+    const HistoryBucket *b;
+
+    if (hist == NULL || hist->last_day == 0) {
+        return NULL;
+    }
+
+    b = &hist->buckets[BUCKET_SLOT(tag)];
+    return (b->tag == tag && b->xp_max > 0) ? b : NULL;
+}
+
+/*
+ * refresh_bucket — Recompute min/max for the bucket holding `day`
+ *
+ * A bucket spans HISTORY_BUCKET_DAYS days, so this is constant work.
+ * Days with no record count as 0 XP, but only once they have passed:
+ * tomorrow hasn't happened yet, so it can't drag the minimum down.
+ */
+static void refresh_bucket(History *hist, uint32_t day)
+{
+    uint32_t tag = BUCKET_OF(day);
+    uint32_t first = tag * HISTORY_BUCKET_DAYS + 1;
+    HistoryBucket *b = &hist->buckets[BUCKET_SLOT(tag)];
+
+    b->tag = tag;
+    b->xp_min = UINT32_MAX;
+    b->xp_max = 0;
+
+    for (uint32_t d = first;
+         d < first + HISTORY_BUCKET_DAYS && d <= hist->last_day;
+         d++) {
+        const HistoryDay *rec = history_get(hist, d);
+        uint32_t xp = (rec != NULL) ? rec->xp : 0;
+        if (xp < b->xp_min) b->xp_min = xp;
+        if (xp > b->xp_max) b->xp_max = xp;
+    }
+
+    if (b->xp_min == UINT32_MAX) {
+        b->xp_min = 0;
+    }
+}
+
+int history_record(History *hist, uint32_t day, uint32_t xp,
+                   const HunterStats *stats, uint32_t quests)
+{
+    HistoryDay *d;
+
+    if (hist == NULL || day == 0) {
+        return -1;
+    }
+
+    /* Too old: the slot now belongs to a newer day */
+    if (hist->last_day >= HISTORY_DAYS && day <= hist->last_day - HISTORY_DAYS) {
+        return -1;
+    }
+
+    d = &hist->days[DAY_SLOT(day)];
+    if (d->day != day) {
+        memset(d, 0, sizeof(*d));
+        d->day = day;
+    }
+
+    d->xp += xp;
+    d->quests = (uint16_t)(d->quests + quests);
+    if (stats != NULL) {
+        d->stats[0] = (int16_t)(d->stats[0] + stats->strength);
+        d->stats[1] = (int16_t)(d->stats[1] + stats->intelligence);
+        d->stats[2] = (int16_t)(d->stats[2] + stats->systems);
+        d->stats[3] = (int16_t)(d->stats[3] + stats->gpu);
+        d->stats[4] = (int16_t)(d->stats[4] + stats->security);
+        d->stats[5] = (int16_t)(d->stats[5] + stats->endurance);
+    }
+
+    if (day > hist->last_day) {
+        uint32_t prev = hist->last_day;
+        hist->last_day = day;
+        /* Days skipped since the last record now count as zero */
+        if (prev != 0 && BUCKET_OF(prev) != BUCKET_OF(day)) {
+            refresh_bucket(hist, prev);
+        }
+    }
+
+    refresh_bucket(hist, day);
+    return 0;
+}
+
+void history_on_event(Hunter *h, const Event *e, void *ctx)
+{
+    HistoryRecorder *rec = ctx;
+    HunterStats gained = { 0, 0, 0, 0, 0, 0 };
+
+    if (h == NULL || e == NULL || rec == NULL) {
+        return;
+    }
+
+    switch ((EventType)e->type) {
+    case EVENT_QUEST_COMPLETED:
+        history_record(rec->hist, e->day, 0, NULL, 1);
+        break;
+    case EVENT_XP_GRANTED:
+        if (e->value > 0) {
+            history_record(rec->hist, e->day, (uint32_t)e->value, NULL, 0);
+        }
+        break;
+    case EVENT_STAT_GRANTED:
+        /*
+         * A grant follows the COMPLETED event of its quest, which
+         * leaves stats alone, so rec->stats is the value before it
+         */
+        if (e->arg < STAT_COUNT) {
+            stat_set(&gained, (StatId)e->arg,
+                     stat_get(&h->stats, (StatId)e->arg) -
+                     stat_get(&rec->stats, (StatId)e->arg));
+            history_record(rec->hist, e->day, 0, &gained, 0);
+        }
+        break;
+    case EVENT_QUEST_ACCEPTED:
+    case EVENT_QUEST_FAILED:
+        break;
+    }
+
+    rec->stats = h->stats;
+}
+
+/*
+ * ============================================================================
+ * SERIALIZATION
+ * ============================================================================
+ *
+ * LEB128: 7 bits per byte, high bit = "more bytes follow".
+ *   300 = 0b1_0010_1100  →  [1010_1100] [0000_0010]
+ *
+ * Zigzag maps signed to unsigned so small negatives stay small:
+ *   0 → 0, -1 → 1, 1 → 2, -2 → 3, ...
+ *
+ * Day numbers are consecutive and daily XP is similar from one day
+ * to the next, so storing differences keeps most values in 1 byte.
+ */
+
+static size_t put_varint(uint8_t *buf, size_t pos, size_t cap, uint32_t v)
+{
+    do {
+        if (pos >= cap) {
+            return 0;
+        }
+        buf[pos++] = (uint8_t)((v & 0x7F) | (v >= 0x80 ? 0x80 : 0));
+        v >>= 7;
+    } while (v != 0);
+
+    return pos;
+}
+
+static int get_varint(const uint8_t *buf, size_t len, size_t *pos,
+                      uint32_t *out)
+{
+    uint32_t v = 0;
+    unsigned int shift = 0;
+
+    while (*pos < len && shift < 35) {
+        uint8_t b = buf[(*pos)++];
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *out = v;
+            return 0;
+        }
+        shift += 7;
+    }
+
+    return -1;
+}
+
+static uint32_t zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static int32_t unzigzag(uint32_t v)
+{
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+size_t history_encode(const History *hist, uint8_t *buf, size_t cap)
+{
+    uint32_t count = 0, first = 1, prev_day = 0, prev_xp = 0;
+    size_t pos;
+
+    if (hist == NULL || buf == NULL) {
+        return 0;
+    }
+
+    if (hist->last_day > HISTORY_DAYS) {
+        first = hist->last_day - HISTORY_DAYS + 1;
+    }
+
+    if (hist->last_day != 0) {
+        for (uint32_t day = first; day <= hist->last_day; day++) {
+            if (history_get(hist, day) != NULL) {
+                count++;
+            }
+        }
+    }
+
+    pos = put_varint(buf, 0, cap, count);
+
+    for (uint32_t day = first; count > 0 && day <= hist->last_day; day++) {
+        const HistoryDay *d = history_get(hist, day);
+        if (d == NULL) {
+            continue;
+        }
+
+        if (pos) pos = put_varint(buf, pos, cap, d->day - prev_day);
+        if (pos) pos = put_varint(buf, pos, cap,
+                                  zigzag((int32_t)(d->xp - prev_xp)));
+        if (pos) pos = put_varint(buf, pos, cap, d->quests);
+        for (int s = 0; s < 6 && pos; s++) {
+            pos = put_varint(buf, pos, cap, zigzag(d->stats[s]));
+        }
+
+        prev_day = d->day;
+        prev_xp = d->xp;
+    }
+
+    return pos;
+}
+
+int history_decode(History *hist, const uint8_t *buf, size_t len)
+{
+    uint32_t count, day = 0, xp = 0, v;
+    size_t pos = 0;
+
+    if (hist == NULL || buf == NULL) {
+        return -1;
+    }
+
+    history_init(hist);
+
+    if (get_varint(buf, len, &pos, &count) != 0 || count > HISTORY_DAYS) {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        HistoryDay *d;
+
+        if (get_varint(buf, len, &pos, &v) != 0 || v == 0) {
+            return -1;  /* Days must strictly increase */
+        }
+        day += v;
+
+        if (get_varint(buf, len, &pos, &v) != 0) {
+            return -1;
+        }
+        xp += (uint32_t)unzigzag(v);
+
+        d = &hist->days[DAY_SLOT(day)];
+        d->day = day;
+        d->xp = xp;
+
+        if (get_varint(buf, len, &pos, &v) != 0) {
+            return -1;
+        }
+        d->quests = (uint16_t)v;
+
+        for (int s = 0; s < 6; s++) {
+            if (get_varint(buf, len, &pos, &v) != 0) {
+                return -1;
+            }
+            d->stats[s] = (int16_t)unzigzag(v);
+        }
+
+        hist->last_day = day;
+    }
+
+    /* Rebuild every bucket the chart can see */
+    if (hist->last_day != 0) {
+        uint32_t first = (hist->last_day > HISTORY_CHART_DAYS)
+                       ? hist->last_day - HISTORY_CHART_DAYS + 1 : 1;
+        for (uint32_t d = first; d <= hist->last_day; d += HISTORY_BUCKET_DAYS) {
+            refresh_bucket(hist, d);
+        }
+        refresh_bucket(hist, hist->last_day);
+    }
+
+    return (pos == len) ? 0 : -1;
+}
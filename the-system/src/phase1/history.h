@@ -0,0 +1,188 @@
+/*
+ * history.h — Daily Progress Time-Series
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * The Hunter struct only knows totals: total_xp, current_streak.
+ * To draw progress graphs we need to know what happened on EACH day.
+ *
+ * History keeps one small record per Protocol day in a ring buffer,
+ * plus precomputed min/max "buckets" for the chart:
+ *
+ *   days (ring, 256 slots)     [d1][d2][d3][d4][d5][d6] ...
+ *                                \__/    \__/    \__/
+ *   buckets (2 days each)        b0      b1      b2   ... b104
+ *                               min/max min/max min/max
+ *
+ * Recording a day updates one bucket (constant work).
+ * Drawing the chart reads 105 buckets (constant work), never the days.
+ *
+ * On disk the days are delta + varint encoded (see history_encode).
+ *
+ * Learning Focus:
+ *   - Ring buffers with tags
+ *   - Variable-length integer encoding
+ *   - Precomputing aggregates
+ */
+
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "hunter.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Ring capacity in days (power of two, >= PROTOCOL_DAYS) */
+#define HISTORY_DAYS         256
+
+/* Days shown by the chart */
+#define HISTORY_CHART_DAYS   PROTOCOL_DAYS
+
+/* Days folded into one chart bucket */
+#define HISTORY_BUCKET_DAYS  2
+
+/* Number of chart buckets (rounded up) */
+#define HISTORY_BUCKETS \
+    ((HISTORY_CHART_DAYS + HISTORY_BUCKET_DAYS - 1) / HISTORY_BUCKET_DAYS)
+
+/* Worst-case size of history_encode() output */
+#define HISTORY_ENCODED_MAX  (5 + HISTORY_DAYS * 45)
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * HistoryDay — What happened on one Protocol day
+ *
+ * day == 0 marks an empty slot (Protocol days start at 1).
+ */
+typedef struct {
+    uint32_t day;
+    uint32_t xp;             /* XP earned that day */
+    uint16_t quests;         /* Quests completed that day */
+    int16_t stats[6];        /* STR INT SYS GPU SEC END gained that day */
+} HistoryDay;
+
+/*
+ * HistoryBucket — Precomputed chart column
+ *
+ * tag is the absolute bucket number ((day - 1) / HISTORY_BUCKET_DAYS);
+ * a slot whose tag doesn't match is stale and reads as zero.
+ */
+typedef struct {
+    uint32_t tag;
+    uint32_t xp_min;
+    uint32_t xp_max;
+} HistoryBucket;
+
+typedef struct {
+    HistoryDay days[HISTORY_DAYS];
+    HistoryBucket buckets[HISTORY_BUCKETS];
+    uint32_t last_day;       /* Most recent day recorded (0 = empty) */
+} History;
+
+/*
+ * HistoryRecorder — Observer context that fills a History from events
+ *
+ * stats is the Hunter's stats as of the last event seen, so a capped
+ * grant is recorded as what it actually added.
+ */
+typedef struct {
+    History *hist;
+    HunterStats stats;
+} HistoryRecorder;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * history_init — Start with an empty history
+ */
+void history_init(History *hist);
+
+/*
+ * history_record — Add activity to a day
+ *
+ * Calling this several times for the same day accumulates.
+ * Days older than the ring (HISTORY_DAYS back) are ignored.
+ *
+ * Parameters:
+ *   hist   — History
+ *   day    — Protocol day (1-based)
+ *   xp     — XP earned
+ *   stats  — Stat gains (may be NULL)
+ *   quests — Quests completed
+ *
+ * Returns:
+ *   0 on success
+ *  -1 on error (NULL, day 0, or day too old)
+ */
+int history_record(History *hist, uint32_t day, uint32_t xp,
+                   const HunterStats *stats, uint32_t quests);
+
+/*
+ * history_on_event — Record an emitted event on its day (EventObserver)
+ *
+ * COMPLETED counts a quest, XP_GRANTED adds its XP, STAT_GRANTED adds
+ * the stat change it made. Register with
+ * event_add_observer(history_on_event, &recorder).
+ */
+void history_on_event(Hunter *h, const Event *e, void *ctx);
+
+/*
+ * history_get — Look up one day
+ *
+ * Returns:
+ *   Pointer to the day's record, or NULL if nothing was recorded
+ */
+const HistoryDay *history_get(const History *hist, uint32_t day);
+
+/*
+ * history_bucket — Read a chart bucket by absolute bucket number
+ *
+ * Returns:
+ *   Pointer to bucket, or NULL if it holds no data
+ */
+const HistoryBucket *history_bucket(const History *hist, uint32_t tag);
+
+/*
+ * history_encode — Serialize for the save file
+ *
+ * Format (all varints are LEB128, signed values zigzag-encoded):
+ *   count
+ *   for each recorded day, oldest first:
+ *     day - previous day
+ *     xp - previous xp        (signed)
+ *     quests
+ *     stats[0..5]             (signed)
+ *
+ * Returns:
+ *   Bytes written, or 0 if buf is too small
+ */
+size_t history_encode(const History *hist, uint8_t *buf, size_t cap);
+
+/*
+ * history_decode — Rebuild a History from history_encode() output
+ *
+ * Returns:
+ *   0 on success
+ *  -1 on malformed input
+ */
+int history_decode(History *hist, const uint8_t *buf, size_t len);
+
+#endif /* HISTORY_H */
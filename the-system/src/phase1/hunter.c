@@ -18,49 +18,44 @@
 #include <string.h>
 #include <time.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "hunter.h"
+#include "progression.h"
+#include "stat.h"
+#include "textlayout.h"
 
 /*
  * ============================================================================
- * RANK DATA
+ * RANK RESOLUTION
  * ============================================================================
+ *
+ * Rank names and XP thresholds come from the progression config
+ * (progression.h), compiled into tables once at startup.
+ *
+ * One Hunter: a lookup table indexed by XP bucket plus one compare.
+ *
+ * Many Hunters: thresholds are sorted, so a rank is simply HOW MANY
+ * of the thresholds D..Shadow Monarch the XP has reached:
+ *
+ *   xp = 8000   thresholds  1000 3000 7000 15000 30000 50000 100000
+ *               reached?       1    1    1     0     0     0      0   → 3 = B
+ *
+ * With SSE2 that count is done for 4 Hunters at once, one compare per
+ * threshold (see promote_block).
+ *
+ * SSE2 only compares SIGNED 32-bit lanes. XORing both sides with
+ * 0x80000000 maps unsigned order onto signed order.
  */
 
-/*
- * Rank names — static array for lookup
- * 
- * Using an array indexed by enum value is a common pattern.
- * Much faster than a switch statement for simple lookups.
- */
-static const char *RANK_NAMES[] = {
-    "E-Rank",
-    "D-Rank",
-    "C-Rank",
-    "B-Rank",
-    "A-Rank",
-    "S-Rank",
-    "National Level",
-    "Shadow Monarch"
-};
+#define SIGN_BIAS 0x80000000u
 
-/*
- * XP thresholds for each rank
- * 
- * XP_THRESHOLDS[rank] = XP needed to reach that rank
- * E-Rank starts at 0 (everyone begins there)
- */
-static const uint32_t XP_THRESHOLDS[] = {
-    0,       /* E-Rank: starting point */
-    1000,    /* D-Rank */
-    3000,    /* C-Rank */
-    7000,    /* B-Rank */
-    15000,   /* A-Rank */
-    30000,   /* S-Rank */
-    50000,   /* National Level */
-    100000   /* Shadow Monarch */
-};
-
-#define NUM_RANKS (sizeof(XP_THRESHOLDS) / sizeof(XP_THRESHOLDS[0]))
+static size_t promote_block(Hunter *hunters, const uint32_t *xp,
+                            const uint32_t *old, size_t n, size_t base,
+                            RankUpEvent *events, size_t max_events,
+                            size_t emitted);
 
 /*
  * ============================================================================
@@ -117,7 +112,7 @@ int hunter_init(Hunter *h, const char *name)
     h->current_day = 1;
     
     /* XP to reach D-Rank */
-    h->xp_to_next_rank = XP_THRESHOLDS[RANK_D];
+    h->xp_to_next_rank = progression_get()->threshold[RANK_D];
     
     /*
      * time(NULL) returns current time as seconds since Unix epoch.
@@ -129,6 +124,8 @@ int hunter_init(Hunter *h, const char *name)
     /* Fresh start, no streaks yet */
     h->current_streak = 1;  /* First day counts! */
     h->longest_streak = 1;
+    activity_init(&h->activity);
+    activity_mark(&h->activity, 1);
     
     return 0;
 }
@@ -147,13 +144,11 @@ int hunter_add_xp(Hunter *h, uint32_t amount)
     
     /*
      * Check for rank-up.
-     * We loop because a large XP gain could skip multiple ranks
-     * (though that would be unusual).
+     * A large XP gain can skip several ranks; hunter_rank_for_xp
+     * counts every threshold crossed. Ranks never drop.
      */
-    new_rank = h->rank;
-    while (new_rank < RANK_SHADOW_MONARCH && 
-           h->total_xp >= XP_THRESHOLDS[new_rank + 1]) {
-        new_rank++;
+    new_rank = hunter_rank_for_xp(h->total_xp);
+    if (new_rank > h->rank) {
         ranked_up = 1;
     }
     
@@ -162,7 +157,7 @@ int hunter_add_xp(Hunter *h, uint32_t amount)
         
         /* Update XP target for next rank */
         if (new_rank < RANK_SHADOW_MONARCH) {
-            h->xp_to_next_rank = XP_THRESHOLDS[new_rank + 1];
+            h->xp_to_next_rank = progression_get()->threshold[new_rank + 1];
         } else {
             h->xp_to_next_rank = h->total_xp; /* Max rank reached */
         }
@@ -173,28 +168,49 @@ int hunter_add_xp(Hunter *h, uint32_t amount)
     return 0;
 }
 
+size_t hunter_add_xp_many(Hunter *hunters, const uint32_t *amounts,
+                          size_t n, RankUpEvent *events, size_t max_events)
+{
+    enum { BLOCK = 64 };
+    uint32_t xp[BLOCK];
+    uint32_t old[BLOCK];
+    size_t emitted = 0;
+    
+    if (hunters == NULL || amounts == NULL) {
+        return 0;
+    }
+    
+    for (size_t base = 0; base < n; base += BLOCK) {
+        size_t len = (n - base < BLOCK) ? n - base : BLOCK;
+        
+        /* Gather new totals and current ranks into contiguous blocks */
+        for (size_t j = 0; j < len; j++) {
+            Hunter *h = &hunters[base + j];
+            h->total_xp += amounts[base + j];
+            xp[j] = h->total_xp;
+            old[j] = (uint32_t)h->rank;
+        }
+        
+        emitted = promote_block(hunters + base, xp, old, len, base,
+                                events, max_events, emitted);
+    }
+    
+    return emitted;
+}
+
 void hunter_add_stats(Hunter *h, const HunterStats *bonus)
 {
     if (h == NULL || bonus == NULL) {
         return;
     }
     
-    /*
-     * Simple addition. Stats have no maximum in Phase 1.
-     * Later phases might add diminishing returns or caps.
-     */
-    h->stats.strength += bonus->strength;
-    h->stats.intelligence += bonus->intelligence;
-    h->stats.systems += bonus->systems;
-    h->stats.gpu += bonus->gpu;
-    h->stats.security += bonus->security;
-    h->stats.endurance += bonus->endurance;
+    /* Caps and diminishing returns come from the progression config */
+    stat_apply(h, bonus);
 }
 
 uint32_t hunter_update_streak(Hunter *h)
 {
     time_t now;
-    double diff;
     
     if (h == NULL) {
         return 0;
@@ -203,39 +219,145 @@ uint32_t hunter_update_streak(Hunter *h)
     now = time(NULL);
     
     /*
-     * difftime returns the difference in seconds as a double.
-     * We check if more than 48 hours have passed (broken streak)
-     * or less than 24 hours (same day, no change).
+     * Streaks are counted in calendar days, not 24-hour windows:
+     * the timestamp becomes a local day number (streak.h), and the
+     * streak is the run of active days ending today.
      */
-    diff = difftime(now, h->last_activity);
-    
-    if (diff > 48 * 60 * 60) {
-        /* More than 48 hours — streak broken */
-        h->current_streak = 1;
-    } else if (diff > 24 * 60 * 60) {
-        /* Between 24-48 hours — streak continues */
-        h->current_streak++;
-        if (h->current_streak > h->longest_streak) {
-            h->longest_streak = h->current_streak;
-        }
-    }
-    /* Less than 24 hours — same day, no streak change */
+    hunter_mark_active(h, streak_protocol_day(h->protocol_start_date, now));
     
     h->last_activity = now;
     return h->current_streak;
 }
 
+uint32_t hunter_mark_active(Hunter *h, uint32_t day)
+{
+    if (h == NULL) {
+        return 0;
+    }
+    
+    activity_mark(&h->activity, day);
+    
+    h->current_streak = activity_current_streak(&h->activity, day);
+    if (h->current_streak > h->longest_streak) {
+        h->longest_streak = h->current_streak;
+    }
+    
+    if (day > h->current_day) {
+        h->current_day = day;
+    }
+    
+    return h->current_streak;
+}
+
+HunterRank hunter_rank_for_xp(uint32_t xp)
+{
+    return (HunterRank)progression_rank_for_xp(xp);
+}
+
+/*
+ * promote_block — Resolve ranks for a block and apply the rank-ups
+ *
+ * Vertical SIMD: 4 Hunters per register, one compare per threshold.
+ * cmpgt gives -1 per lane where a rank is NOT reached, so adding the
+ * masks up counts down from 7. A final compare against the old ranks
+ * tells which lanes were promoted; only those Hunters are touched.
+ *
+ * Parameters:
+ *   hunters — First Hunter of the block
+ *   xp, old — Their new XP totals and current ranks
+ *   n       — Block length
+ *   base    — Index of hunters[0] in the caller's array (for events)
+ */
+static size_t promote_block(Hunter *hunters, const uint32_t *xp,
+                            const uint32_t *old, size_t n, size_t base,
+                            RankUpEvent *events, size_t max_events,
+                            size_t emitted)
+{
+    const Progression *p = progression_get();
+    size_t i = 0;
+    
+#if defined(__SSE2__)
+    __m128i bias = _mm_set1_epi32((int)SIGN_BIAS);
+    __m128i top = _mm_set1_epi32(PROG_RANKS - 1);
+    
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(const void *)&xp[i]), bias);
+        __m128i rank = top;
+        int32_t lanes[4];
+        int promoted;
+        
+        for (int k = 1; k < PROG_RANKS; k++) {
+            __m128i t = _mm_set1_epi32((int)(p->threshold[k] ^ SIGN_BIAS));
+            rank = _mm_add_epi32(rank, _mm_cmpgt_epi32(t, x));
+        }
+        
+        promoted = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(
+                       rank, _mm_loadu_si128((const __m128i *)(const void *)&old[i]))));
+        if (promoted == 0) {
+            continue;   /* The common case: nobody in these 4 ranked up */
+        }
+        
+        _mm_storeu_si128((__m128i *)(void *)lanes, rank);
+        for (int lane = 0; lane < 4; lane++) {
+            if (promoted & (1 << lane)) {
+                size_t j = i + (size_t)lane;
+                Hunter *h = &hunters[j];
+                HunterRank to = (HunterRank)lanes[lane];
+                
+                if (events != NULL && emitted < max_events) {
+                    events[emitted].index = (uint32_t)(base + j);
+                    events[emitted].from = (uint8_t)h->rank;
+                    events[emitted].to = (uint8_t)to;
+                    emitted++;
+                }
+                h->rank = to;
+                h->xp_to_next_rank = (to < RANK_SHADOW_MONARCH)
+                                   ? p->threshold[to + 1] : h->total_xp;
+            }
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        Hunter *h = &hunters[i];
+        HunterRank to = hunter_rank_for_xp(xp[i]);
+        
+        if ((uint32_t)to <= old[i]) {
+            continue;
+        }
+        if (events != NULL && emitted < max_events) {
+            events[emitted].index = (uint32_t)(base + i);
+            events[emitted].from = (uint8_t)h->rank;
+            events[emitted].to = (uint8_t)to;
+            emitted++;
+        }
+        h->rank = to;
+        h->xp_to_next_rank = (to < RANK_SHADOW_MONARCH)
+                           ? p->threshold[to + 1] : h->total_xp;
+    }
+    
+    return emitted;
+}
+
+uint32_t hunter_rank_threshold(HunterRank rank)
+{
+    if (rank < 0 || rank >= PROG_RANKS) {
+        return 0;
+    }
+    
+    return progression_get()->threshold[rank];
+}
+
 const char *hunter_get_rank_name(HunterRank rank)
 {
     /*
      * Bounds check to prevent array overflow.
      * If someone passes an invalid rank, return a safe default.
      */
-    if (rank < 0 || rank >= (int)NUM_RANKS) {
+    if (rank < 0 || rank >= PROG_RANKS) {
         return "Unknown";
     }
     
-    return RANK_NAMES[rank];
+    return progression_get()->rank_name[rank];
 }
 
 void hunter_display(const Hunter *h)
@@ -246,9 +368,16 @@ void hunter_display(const Hunter *h)
     }
     
     printf("╔══════════════════════════════════════════════════════════════╗\n");
-    printf("║  HUNTER: %-20s  RANK: %-16s  ║\n", 
-           h->name, hunter_get_rank_name(h->rank));
-    printf("║  TITLE: %-51s ║\n", h->title);
+    /*
+     * Names and titles may contain multibyte UTF-8, so pad by
+     * terminal columns (text_print_fit) rather than by bytes (%-20s).
+     */
+    printf("║  HUNTER: ");
+    text_print_fit(h->name, 20);
+    printf("  RANK: %-16s  ║\n", hunter_get_rank_name(h->rank));
+    printf("║  TITLE: ");
+    text_print_fit(h->title, 51);
+    printf(" ║\n");
     printf("╠══════════════════════════════════════════════════════════════╣\n");
     printf("║  DAY: %03u/210            SEASON: %-24s ║\n", 
            h->current_day,
@@ -284,5 +413,19 @@ void hunter_display(const Hunter *h)
     }
     printf("║\n");
     
+    /* Active days in the current season (same boundaries as SEASON above) */
+    uint32_t season_first = h->current_day <= 60 ? 1 :
+                            h->current_day <= 105 ? 61 :
+                            h->current_day <= 165 ? 106 : 166;
+    uint32_t active = activity_count(&h->activity, season_first, h->current_day);
+    uint32_t season_days = h->current_day - season_first + 1;
+    printf("║  ACTIVE THIS SEASON: %u / %u days", active, season_days);
+    int active_len = snprintf(NULL, 0, "ACTIVE THIS SEASON: %u / %u days",
+                              active, season_days);
+    for (int i = 0; i < 60 - active_len - 2; i++) {
+        printf(" ");
+    }
+    printf("║\n");
+    
     printf("╚══════════════════════════════════════════════════════════════╝\n");
 }
@@ -20,8 +20,11 @@
 #define HUNTER_H
 
 #include <time.h>      /* For time_t */
+#include <stddef.h>    /* For size_t */
 #include <stdint.h>    /* For uint32_t, etc. */
 
+#include "streak.h"    /* For ActivityMap */
+
 /*
  * ============================================================================
  * CONSTANTS
@@ -85,8 +88,9 @@ typedef enum {
  *   SEC (Security)     — Cybersecurity awareness, defensive coding
  *   END (Endurance)    — Consistency, grinding, showing up daily
  * 
- * Stats start at 1 and grow through quest completion.
- * No theoretical maximum, but 100+ is god-tier.
+ * Stats start at 1 and grow through quest completion, up to cap.<stat>.
+ * Past knee.<stat> gains shrink (diminishing returns, see stat.h), so
+ * 100+ is still god-tier.
  */
 typedef struct {
     int strength;
@@ -121,6 +125,7 @@ typedef struct {
     /* Progression */
     HunterRank rank;
     HunterStats stats;
+    uint16_t stat_frac[6];         /* Fractional stat points, 1/65536ths */
     
     /* Protocol Tracking */
     uint32_t current_day;          /* Day in Protocol (1-210+) */
@@ -129,19 +134,34 @@ typedef struct {
     
     /* Timestamps */
     time_t protocol_start_date;    /* When the journey began */
-    time_t last_activity;          /* For streak calculation */
+    time_t last_activity;          /* Most recent activity (not replayed) */
     
     /* Streak System */
     uint32_t current_streak;       /* Consecutive active days */
     uint32_t longest_streak;       /* Personal record */
+    ActivityMap activity;          /* One bit per active Protocol day */
     
     /* Achievement Counters */
     uint32_t quests_completed;
     uint32_t shadow_quests_found;
     uint32_t deaths;               /* Failed challenges — respawn stronger */
+    uint32_t boss_quests_completed;
+    uint64_t achievements;         /* Bit i = rule i unlocked (achievement.h) */
     
 } Hunter;
 
+/*
+ * RankUpEvent — "Hunter #index went from rank `from` to rank `to`"
+ * 
+ * Produced by hunter_add_xp_many() so the UI can celebrate afterwards
+ * instead of being called in the middle of a batch.
+ */
+typedef struct {
+    uint32_t index;    /* Position in the hunters[] array */
+    uint8_t from;      /* HunterRank before */
+    uint8_t to;        /* HunterRank after */
+} RankUpEvent;
+
 /*
  * ============================================================================
  * FUNCTION PROTOTYPES
@@ -184,6 +204,27 @@ int hunter_init(Hunter *h, const char *name);
  */
 int hunter_add_xp(Hunter *h, uint32_t amount);
 
+/*
+ * hunter_add_xp_many — Award XP to many Hunters at once
+ * 
+ * Same result as calling hunter_add_xp(&hunters[i], amounts[i]) for
+ * each i, but ranks are resolved for a whole block of Hunters with
+ * SIMD compares instead of one threshold loop per call.
+ * 
+ * Parameters:
+ *   hunters    — Array of n Hunters
+ *   amounts    — XP for each Hunter (0 is allowed)
+ *   n          — Number of Hunters
+ *   events     — Filled with one RankUpEvent per rank change (may be NULL)
+ *   max_events — Capacity of events; further rank-ups are still
+ *                applied, just not reported
+ * 
+ * Returns:
+ *   Number of events written
+ */
+size_t hunter_add_xp_many(Hunter *hunters, const uint32_t *amounts,
+                          size_t n, RankUpEvent *events, size_t max_events);
+
 /*
  * hunter_add_stats — Increase Hunter's stats
  * 
@@ -197,7 +238,10 @@ void hunter_add_stats(Hunter *h, const HunterStats *bonus);
  * hunter_update_streak — Update the daily activity streak
  * 
  * Called when Hunter completes any activity.
- * Handles streak continuation and reset logic.
+ * Marks today (local calendar day) as active and recomputes
+ * current_streak and longest_streak from the activity bitmap,
+ * so 23:59 → 00:01 counts as two days and DST shifts don't matter.
+ * Also moves current_day forward to today.
  * 
  * Parameters:
  *   h — Pointer to Hunter
@@ -207,6 +251,35 @@ void hunter_add_stats(Hunter *h, const HunterStats *bonus);
  */
 uint32_t hunter_update_streak(Hunter *h);
 
+/*
+ * hunter_mark_active — Record activity on a given Protocol day
+ * 
+ * The clock-free part of hunter_update_streak(): marks the day and
+ * recomputes the streaks. Replaying events (event.h) uses this so the
+ * result doesn't depend on when the replay runs.
+ * 
+ * Returns:
+ *   Current streak value after update
+ */
+uint32_t hunter_mark_active(Hunter *h, uint32_t day);
+
+/*
+ * hunter_rank_for_xp — Rank earned by a total XP value
+ * 
+ * Pure function of XP: the highest rank whose threshold is <= xp.
+ * One lookup in the progression table (progression_rank_for_xp)
+ * plus one compare against the next threshold.
+ */
+HunterRank hunter_rank_for_xp(uint32_t xp);
+
+/*
+ * hunter_rank_threshold — XP needed to reach a rank
+ * 
+ * Returns:
+ *   Threshold XP, or 0 for an invalid rank
+ */
+uint32_t hunter_rank_threshold(HunterRank rank);
+
 /*
  * hunter_get_rank_name — Get human-readable rank name
  * 
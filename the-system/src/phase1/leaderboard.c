@@ -0,0 +1,428 @@
+/*
+ * leaderboard.c — Cohort Leaderboards Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Fenwick tree update, prefix sum and descent
+ *   - Intrusive linked lists in index arrays
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "leaderboard.h"
+#include "progression.h"
+#include "save.h"
+
+/* End of a bucket's member list */
+#define LIST_END  0xFFFFu
+
+/*
+ * ============================================================================
+ * FENWICK TREE
+ * ============================================================================
+ *
+ * tree[p] holds the count of positions (p - lowbit(p), p]. Position 1 is
+ * the highest bucket, so a prefix sum counts hunters at or above a
+ * bucket.
+ */
+
+static uint32_t position_of(uint32_t bucket)
+{
+    return LEADERBOARD_BUCKETS - bucket;
+}
+
+static uint32_t bucket_at(uint32_t pos)
+{
+    return LEADERBOARD_BUCKETS - pos;
+}
+
+static void tree_add(Leaderboard *lb, uint32_t pos, int32_t delta)
+{
+    for (; pos <= LEADERBOARD_BUCKETS; pos += pos & (0u - pos)) {
+        lb->tree[pos] += (uint32_t)delta;
+    }
+}
+
+static uint32_t tree_prefix(const Leaderboard *lb, uint32_t pos)
+{
+    uint32_t sum = 0;
+
+    for (; pos > 0; pos -= pos & (0u - pos)) {
+        sum += lb->tree[pos];
+    }
+    return sum;
+}
+
+/*
+ * tree_select — Smallest position whose prefix sum reaches j (j >= 1)
+ *
+ * Walks down the implicit tree: at each power of two, skip the whole
+ * range if it holds fewer than j hunters.
+ */
+static uint32_t tree_select(const Leaderboard *lb, uint32_t j)
+{
+    uint32_t pos = 0;
+
+    for (uint32_t step = LEADERBOARD_BUCKETS; step > 0; step >>= 1) {
+        if (pos + step <= LEADERBOARD_BUCKETS && lb->tree[pos + step] < j) {
+            pos += step;
+            j -= lb->tree[pos];
+        }
+    }
+    return pos + 1;
+}
+
+/*
+ * ============================================================================
+ * BOARD
+ * ============================================================================
+ */
+
+void leaderboard_init(Leaderboard *lb, uint32_t max_score)
+{
+    if (lb == NULL) {
+        return;
+    }
+
+    lb->count = 0;
+    lb->shift = 0;
+    while (lb->shift < 31 && (max_score >> lb->shift) >= LEADERBOARD_BUCKETS) {
+        lb->shift++;
+    }
+
+    memset(lb->tree, 0, sizeof(lb->tree));
+    for (uint32_t b = 0; b < LEADERBOARD_BUCKETS; b++) {
+        lb->head[b] = LIST_END;
+    }
+    for (uint32_t m = 0; m < LEADERBOARD_MAX; m++) {
+        lb->bucket_of[m] = LEADERBOARD_BUCKETS;
+    }
+}
+
+static void unlink_member(Leaderboard *lb, uint32_t member)
+{
+    uint32_t b = lb->bucket_of[member];
+
+    if (lb->prev[member] != LIST_END) {
+        lb->next[lb->prev[member]] = lb->next[member];
+    } else {
+        lb->head[b] = lb->next[member];
+    }
+    if (lb->next[member] != LIST_END) {
+        lb->prev[lb->next[member]] = lb->prev[member];
+    }
+
+    tree_add(lb, position_of(b), -1);
+    lb->bucket_of[member] = LEADERBOARD_BUCKETS;
+    lb->count--;
+}
+
+static void link_member(Leaderboard *lb, uint32_t member, uint32_t b)
+{
+    lb->prev[member] = LIST_END;
+    lb->next[member] = lb->head[b];
+    if (lb->head[b] != LIST_END) {
+        lb->prev[lb->head[b]] = (uint16_t)member;
+    }
+    lb->head[b] = (uint16_t)member;
+
+    tree_add(lb, position_of(b), 1);
+    lb->bucket_of[member] = (uint16_t)b;
+    lb->count++;
+}
+
+/*
+ * widen — Grow the shift until score has a bucket, and rebucket everyone
+ *
+ * Each call at least doubles the range, so it happens at most 31 times
+ * over a board's life; in between, every bucket keeps its fixed width.
+ */
+static void widen(Leaderboard *lb, uint32_t score)
+{
+    while ((score >> lb->shift) >= LEADERBOARD_BUCKETS) {
+        lb->shift++;
+    }
+
+    memset(lb->tree, 0, sizeof(lb->tree));
+    for (uint32_t b = 0; b < LEADERBOARD_BUCKETS; b++) {
+        lb->head[b] = LIST_END;
+    }
+    lb->count = 0;
+
+    for (uint32_t m = 0; m < LEADERBOARD_MAX; m++) {
+        if (lb->bucket_of[m] != LEADERBOARD_BUCKETS) {
+            link_member(lb, m, lb->score[m] >> lb->shift);
+        }
+    }
+}
+
+int leaderboard_set(Leaderboard *lb, uint32_t member, uint32_t score)
+{
+    uint32_t b;
+
+    if (lb == NULL || member >= LEADERBOARD_MAX) {
+        return -1;
+    }
+
+    /* Past the range: widen the buckets rather than crowd the top one */
+    if ((score >> lb->shift) >= LEADERBOARD_BUCKETS) {
+        widen(lb, score);
+    }
+
+    b = score >> lb->shift;
+    lb->score[member] = score;
+
+    /* Most XP grants stay inside the bucket: no tree update at all */
+    if (lb->bucket_of[member] == b) {
+        return 0;
+    }
+
+    if (lb->bucket_of[member] != LEADERBOARD_BUCKETS) {
+        unlink_member(lb, member);
+    }
+    link_member(lb, member, b);
+    return 0;
+}
+
+int leaderboard_remove(Leaderboard *lb, uint32_t member)
+{
+    if (lb == NULL || member >= LEADERBOARD_MAX ||
+        lb->bucket_of[member] == LEADERBOARD_BUCKETS) {
+        return -1;
+    }
+
+    unlink_member(lb, member);
+    return 0;
+}
+
+uint32_t leaderboard_rank(const Leaderboard *lb, uint32_t member)
+{
+    uint32_t b, ahead, score;
+
+    if (lb == NULL || member >= LEADERBOARD_MAX ||
+        lb->bucket_of[member] == LEADERBOARD_BUCKETS) {
+        return 0;
+    }
+
+    b = lb->bucket_of[member];
+    score = lb->score[member];
+    ahead = tree_prefix(lb, position_of(b) - 1);
+
+    /* Inside the bucket, count exact scores */
+    for (uint32_t m = lb->head[b]; m != LIST_END; m = lb->next[m]) {
+        if (lb->score[m] > score) {
+            ahead++;
+        }
+    }
+
+    return ahead + 1;
+}
+
+/*
+ * better — Sort order for top-K: higher score, then lower index
+ */
+static int better(const Leaderboard *lb, uint32_t a, uint32_t b)
+{
+    if (lb->score[a] != lb->score[b]) {
+        return lb->score[a] > lb->score[b];
+    }
+    return a < b;
+}
+
+size_t leaderboard_top(const Leaderboard *lb, uint32_t *out, size_t k)
+{
+    size_t written = 0;
+    uint32_t seen = 0;
+
+    if (lb == NULL || out == NULL) {
+        return 0;
+    }
+
+    /* One descent per non-empty bucket, best bucket first */
+    while (written < k && seen < lb->count) {
+        uint32_t b = bucket_at(tree_select(lb, seen + 1));
+        size_t first = written;
+
+        for (uint32_t m = lb->head[b]; m != LIST_END; m = lb->next[m]) {
+            size_t at;
+
+            seen++;
+
+            /* Insertion into out[first..written), keeping the best k */
+            if (written < k) {
+                at = written++;
+            } else if (better(lb, m, out[k - 1])) {
+                at = k - 1;
+            } else {
+                continue;
+            }
+            while (at > first && better(lb, m, out[at - 1])) {
+                out[at] = out[at - 1];
+                at--;
+            }
+            out[at] = m;
+        }
+    }
+
+    return written;
+}
+
+/*
+ * ============================================================================
+ * STANDINGS
+ * ============================================================================
+ */
+
+static uint32_t stat_score(int v)
+{
+    return (v > 0) ? (uint32_t)v : 0;
+}
+
+void standings_init(Standings *s)
+{
+    const Progression *p = progression_get();
+
+    if (s == NULL) {
+        return;
+    }
+
+    /* Twice the top rank leaves room for hunters who keep going */
+    leaderboard_init(&s->board[BOARD_TOTAL_XP], p->threshold[PROG_RANKS - 1] * 2);
+    leaderboard_init(&s->board[BOARD_LONGEST_STREAK], PROTOCOL_DAYS);
+    for (int i = 0; i < PROG_STATS; i++) {
+        leaderboard_init(&s->board[BOARD_STR + i], stat_score(p->stat_cap[i]));
+    }
+}
+
+void standings_update(Standings *s, uint32_t member, const Hunter *h)
+{
+    if (s == NULL || h == NULL) {
+        return;
+    }
+
+    leaderboard_set(&s->board[BOARD_TOTAL_XP], member, h->total_xp);
+    leaderboard_set(&s->board[BOARD_LONGEST_STREAK], member, h->longest_streak);
+    leaderboard_set(&s->board[BOARD_STR], member, stat_score(h->stats.strength));
+    leaderboard_set(&s->board[BOARD_INT], member, stat_score(h->stats.intelligence));
+    leaderboard_set(&s->board[BOARD_SYS], member, stat_score(h->stats.systems));
+    leaderboard_set(&s->board[BOARD_GPU], member, stat_score(h->stats.gpu));
+    leaderboard_set(&s->board[BOARD_SEC], member, stat_score(h->stats.security));
+    leaderboard_set(&s->board[BOARD_END], member, stat_score(h->stats.endurance));
+}
+
+void standings_load_roster(Standings *s, const HunterRoster *r)
+{
+    if (s == NULL || r == NULL) {
+        return;
+    }
+
+    standings_init(s);
+
+    for (uint32_t i = 0; i < r->count; i++) {
+        leaderboard_set(&s->board[BOARD_TOTAL_XP], i, r->xp[i]);
+        leaderboard_set(&s->board[BOARD_LONGEST_STREAK], i, r->longest_streak[i]);
+    }
+    for (int stat = 0; stat < ROSTER_STAT_COUNT; stat++) {
+        for (uint32_t i = 0; i < r->count; i++) {
+            leaderboard_set(&s->board[BOARD_STR + stat], i, stat_score(r->stats[stat][i]));
+        }
+    }
+}
+
+void leaderboard_on_event(Hunter *h, const Event *e, void *ctx)
+{
+    Standings *s = ctx;
+
+    if (h == NULL || e == NULL || s == NULL) {
+        return;
+    }
+
+    switch ((EventType)e->type) {
+    case EVENT_XP_GRANTED:
+        leaderboard_set(&s->board[BOARD_TOTAL_XP], e->hunter, h->total_xp);
+        break;
+    case EVENT_QUEST_COMPLETED:
+        leaderboard_set(&s->board[BOARD_LONGEST_STREAK], e->hunter, h->longest_streak);
+        break;
+    case EVENT_STAT_GRANTED:
+        /* The grant was capped and scaled: read the result, not e->value */
+        standings_update(s, e->hunter, h);
+        break;
+    case EVENT_QUEST_ACCEPTED:
+    case EVENT_QUEST_FAILED:
+        break;
+    }
+}
+
+const char *board_name(BoardMetric metric)
+{
+    static const char *const names[BOARD_COUNT] = {
+        "XP", "STREAK", "STR", "INT", "SYS", "GPU", "SEC", "END"
+    };
+
+    return ((int)metric >= 0 && metric < BOARD_COUNT) ? names[metric] : "?";
+}
+
+/*
+ * ============================================================================
+ * COHORT
+ * ============================================================================
+ */
+
+size_t cohort_load(HunterRoster *r, const Hunter *self)
+{
+    const char *home = getenv("HOME");
+    char dir[512], path[1024];
+    struct dirent *entry;
+    size_t added = 0;
+    DIR *d;
+    int written;
+
+    if (r == NULL || home == NULL) {
+        return 0;
+    }
+
+    written = snprintf(dir, sizeof(dir), "%s/%s/%s", home, SAVE_DIR, COHORT_DIR);
+    if (written < 0 || (size_t)written >= sizeof(dir)) {
+        return 0;
+    }
+
+    d = opendir(dir);
+    if (d == NULL) {
+        return 0;   /* No cohort folder: playing solo */
+    }
+
+    while ((entry = readdir(d)) != NULL) {
+        Hunter h;
+
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+
+        written = snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+        if (written < 0 || (size_t)written >= sizeof(path) ||
+            save_read_hunter(path, &h) != SAVE_OK) {
+            continue;
+        }
+
+        if (self != NULL && h.protocol_start_date == self->protocol_start_date &&
+            strcmp(h.name, self->name) == 0) {
+            continue;
+        }
+
+        if (roster_add(r, &h) == HUNTER_HANDLE_NONE) {
+            break;  /* Roster full */
+        }
+        added++;
+    }
+
+    closedir(d);
+    return added;
+}
@@ -0,0 +1,211 @@
+/*
+ * leaderboard.h — Cohort Leaderboards
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * "Where do I stand?" — by total XP, by longest streak, by each stat.
+ *
+ * Sorting the cohort on every question is O(n log n); keeping one
+ * sorted array makes every XP grant an O(n) shift. A leaderboard keeps
+ * a FENWICK TREE (binary indexed tree) of how many hunters sit in each
+ * score bucket instead. Buckets are ordered best-first, so:
+ *
+ *   hunters ahead of bucket b  = prefix sum up to b - 1     O(log B)
+ *   moving a hunter            = -1 at old bucket, +1 at new O(log B)
+ *   bucket of the k-th best    = descend the tree           O(log B)
+ *
+ *   bucket    best ────────────────────────────▶ worst
+ *   count      0   1   0   3   0   0   2   1  ...
+ *   tree      [ ..partial sums over power-of-two ranges.. ]
+ *
+ * Each bucket also has a linked list of its members, so ties inside a
+ * bucket are settled by exact score. Buckets are score >> shift, with
+ * the shift picked so the expected range fills the table. A score past
+ * the range grows the shift and rebuckets the board, so the top of the
+ * board stays spread out instead of piling into one bucket.
+ *
+ * Members are cohort indices, the same numbers as Event.hunter and a
+ * roster's dense index. Updates arrive through the event observer
+ * (leaderboard_on_event): every hunter_add_xp and hunter_add_stats in
+ * the game goes through an event, so the boards follow them without
+ * those functions knowing about leaderboards.
+ *
+ * Learning Focus:
+ *   - Fenwick trees (prefix sums with O(log n) updates)
+ *   - Order statistics: rank-of and k-th-best
+ *   - Bucketing to bound memory
+ */
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+#include "event.h"
+#include "roster.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Largest cohort (one roster) */
+#define LEADERBOARD_MAX       ROSTER_MAX_HUNTERS
+
+/* Score buckets per board (power of two for the tree descent) */
+#define LEADERBOARD_BUCKETS   1024
+
+/* Other hunters' save files, relative to the save directory */
+#define COHORT_DIR            "cohort"
+
+/*
+ * ============================================================================
+ * ENUMERATIONS
+ * ============================================================================
+ */
+
+typedef enum {
+    BOARD_TOTAL_XP = 0,
+    BOARD_LONGEST_STREAK = 1,
+    BOARD_STR = 2,
+    BOARD_INT = 3,
+    BOARD_SYS = 4,
+    BOARD_GPU = 5,
+    BOARD_SEC = 6,
+    BOARD_END = 7,
+    BOARD_COUNT = 8
+} BoardMetric;
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * Leaderboard — One metric over a cohort
+ *
+ * tree is 1-based; position 1 is the highest bucket.
+ */
+typedef struct {
+    uint32_t count;                              /* Members on the board */
+    uint32_t shift;                              /* bucket = score >> shift */
+    uint32_t tree[LEADERBOARD_BUCKETS + 1];
+    uint16_t head[LEADERBOARD_BUCKETS];          /* First member per bucket */
+    uint16_t next[LEADERBOARD_MAX];
+    uint16_t prev[LEADERBOARD_MAX];
+    uint16_t bucket_of[LEADERBOARD_MAX];         /* LEADERBOARD_BUCKETS = absent */
+    uint32_t score[LEADERBOARD_MAX];
+} Leaderboard;
+
+/*
+ * Standings — Every board for one cohort
+ */
+typedef struct {
+    Leaderboard board[BOARD_COUNT];
+} Standings;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * leaderboard_init — Empty board sized for scores up to max_score
+ *
+ * Larger scores are accepted: the first one past the range widens the
+ * buckets (an O(LEADERBOARD_MAX) rebuild, at most 31 per board).
+ */
+void leaderboard_init(Leaderboard *lb, uint32_t max_score);
+
+/*
+ * leaderboard_set — Put a member on the board, or change its score
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if member is out of range
+ */
+int leaderboard_set(Leaderboard *lb, uint32_t member, uint32_t score);
+
+/*
+ * leaderboard_remove — Take a member off the board
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if member is not on the board
+ */
+int leaderboard_remove(Leaderboard *lb, uint32_t member);
+
+/*
+ * leaderboard_rank — Position of a member, 1 = best
+ *
+ * Equal scores share a position ("1, 2, 2, 4").
+ *
+ * Returns:
+ *   Rank, or 0 if member is not on the board
+ */
+uint32_t leaderboard_rank(const Leaderboard *lb, uint32_t member);
+
+/*
+ * leaderboard_top — The k best members, best first
+ *
+ * Equal scores are listed by member index.
+ *
+ * Parameters:
+ *   out — Receives member indices
+ *   k   — Capacity of out
+ *
+ * Returns:
+ *   Number of members written (less than k if the board is smaller)
+ */
+size_t leaderboard_top(const Leaderboard *lb, uint32_t *out, size_t k);
+
+/*
+ * standings_init — Empty boards, ranges taken from the progression config
+ */
+void standings_init(Standings *s);
+
+/*
+ * standings_update — Set every board for one member from a Hunter
+ */
+void standings_update(Standings *s, uint32_t member, const Hunter *h);
+
+/*
+ * standings_load_roster — Rebuild every board from a roster
+ *
+ * Members are the roster's dense indices. Use after bulk roster
+ * operations, which don't emit events.
+ */
+void standings_load_roster(Standings *s, const HunterRoster *r);
+
+/*
+ * leaderboard_on_event — EventObserver that keeps Standings current
+ *
+ * Register with event_add_observer(leaderboard_on_event, &standings).
+ * Updates only the boards the event can change, for member e->hunter.
+ */
+void leaderboard_on_event(Hunter *h, const Event *e, void *ctx);
+
+/*
+ * board_name — Short label for a metric ("XP", "STREAK", "STR", ...)
+ */
+const char *board_name(BoardMetric metric);
+
+/*
+ * cohort_load — Add the Hunters in ~/.hunter-protocol/cohort/ to a roster
+ *
+ * Any file there is read as a save file (save_read_hunter); ones that
+ * aren't, or are from another save version, are skipped. So is self,
+ * if a copy of your own save is in the folder.
+ *
+ * Returns:
+ *   Number of hunters added
+ */
+size_t cohort_load(HunterRoster *r, const Hunter *self);
+
+#endif /* LEADERBOARD_H */
@@ -7,11 +7,12 @@
  * This is where it all begins.
  * 
  * Program Flow:
- *   1. Initialize save system
- *   2. Load or create Hunter profile
- *   3. Display status
- *   4. Main menu loop
- *   5. Save and exit
+ *   1. Load progression rules (progression.h)
+ *   2. Initialize save system
+ *   3. Load or create Hunter profile
+ *   4. Display status
+ *   5. Main menu loop
+ *   6. Save and exit
  * 
  * Learning Focus:
  *   - Program structure
@@ -23,7 +24,8 @@
  *   make
  * 
  * Run:
- *   ./hunter
+ *   ./hunter                   Interactive mode
+ *   ./hunter status --json     One-shot command (see cli.h)
  * 
  * ============================================================================
  * 
@@ -42,8 +44,17 @@
 
 #include "hunter.h"
 #include "quest.h"
+#include "history.h"
 #include "save.h"
 #include "display.h"
+#include "cli.h"
+#include "progression.h"
+#include "event.h"
+#include "achievement.h"
+#include "shadow.h"
+#include "streak.h"
+#include "leaderboard.h"
+#include "roster.h"
 
 /*
  * ============================================================================
@@ -59,8 +70,14 @@
 
 static Hunter g_hunter;
 static QuestList g_quests;
+static History g_history;
+static HistoryRecorder g_recorder = { &g_history, { 0, 0, 0, 0, 0, 0 } };
 static int g_running = 1;
 
+/* Cohort for the leaderboards; you are member 0 (Event.hunter) */
+static HunterRoster g_cohort;
+static Standings g_standings;
+
 /*
  * ============================================================================
  * FORWARD DECLARATIONS
@@ -72,8 +89,12 @@ static void main_loop(void);
 static void shutdown_game(void);
 static void handle_menu_choice(char choice);
 static void show_status(void);
+static void show_unlocked_achievements(void);
 static void show_quests(void);
 static void add_sample_quests(void);
+static void spawn_shadow_quest(void);
+static void load_cohort(void);
+static void show_standings(void);
 
 /*
  * ============================================================================
@@ -84,17 +105,24 @@ static void add_sample_quests(void);
 int main(int argc, char *argv[])
 {
     /*
-     * Suppress unused parameter warnings.
-     * We'll use argc/argv in later phases for CLI arguments.
+     * Any arguments mean a one-shot command (hunter status --json, ...).
+     * Hand off before touching the terminal: cron and prompt hooks
+     * call this constantly and want output, not a UI.
      */
-    (void)argc;
-    (void)argv;
+    progression_init();
+    event_log_init();
+    achievement_init(NULL, 0);
+    event_add_observer(achievement_on_event, NULL);
+    event_add_observer(history_on_event, &g_recorder);
     
-    /* Seed random number generator (for future shadow quests) */
-    srand((unsigned int)time(NULL));
+    if (argc > 1) {
+        return cli_run(argc, argv, &g_hunter, &g_quests, &g_history);
+    }
     
     /* Initialize and run */
     init_game();
+    load_cohort();
+    spawn_shadow_quest();
     main_loop();
     shutdown_game();
     
@@ -122,7 +150,7 @@ static void init_game(void)
     
     /* Try to load existing save */
     if (save_exists()) {
-        result = save_read(&g_hunter, &g_quests);
+        result = save_read(&g_hunter, &g_quests, &g_history);
         if (result == SAVE_OK) {
             display_clear();
             display_banner();
@@ -136,8 +164,18 @@ static void init_game(void)
             display_wait("Press Enter to continue...");
             return;
         } else {
+            char kept[600];
+            
             fprintf(stderr, "Warning: Could not load save: %s\n",
                     save_result_string(result));
+            
+            /* Never let the new Hunter's saves rotate over the old one */
+            if (save_set_aside(kept, sizeof(kept)) != SAVE_OK) {
+                fprintf(stderr, "Could not set the old save aside; "
+                        "refusing to overwrite it.\n");
+                exit(EXIT_FAILURE);
+            }
+            fprintf(stderr, "Old save kept as %s\n", kept);
             fprintf(stderr, "Starting fresh...\n\n");
         }
     }
@@ -171,15 +209,19 @@ static void init_game(void)
         strcpy(name_buf, "Hunter");
     }
     
-    /* Initialize Hunter */
+    /* Initialize Hunter — a new Hunter gets a new event log */
     hunter_init(&g_hunter, name_buf);
+    if (event_log_reset() != 0) {
+        fprintf(stderr, "Warning: Could not reset the event log\n");
+    }
     
     /* Initialize quest list with sample quests */
     questlist_init(&g_quests);
+    history_init(&g_history);
     add_sample_quests();
     
     /* Save initial state */
-    result = save_write(&g_hunter, &g_quests);
+    result = save_write(&g_hunter, &g_quests, &g_history);
     if (result != SAVE_OK) {
         fprintf(stderr, "Warning: Could not save: %s\n",
                 save_result_string(result));
@@ -230,15 +272,16 @@ static void handle_menu_choice(char choice)
             if (g_quests.count > 0) {
                 Quest *q = &g_quests.quests[0];
                 if (q->status == QUEST_STATUS_AVAILABLE) {
-                    quest_accept(q);
+                    quest_accept(q, &g_hunter);
                 }
                 if (q->status == QUEST_STATUS_ACTIVE) {
                     uint32_t xp = quest_complete(q, &g_hunter);
                     display_quest_complete(q, xp);
+                    show_unlocked_achievements();
                     display_wait("Press Enter to continue...");
                     
                     /* Save after quest completion */
-                    save_write(&g_hunter, &g_quests);
+                    save_write(&g_hunter, &g_quests, &g_history);
                 }
             } else {
                 display_alert("No quests available!");
@@ -266,29 +309,113 @@ static void show_status(void)
     printf("\n");
     display_hunter_status(&g_hunter);
     printf("\n");
+    display_notification("PROGRESS");
+    printf("\n");
+    display_history_sparkline(&g_history, 53);
+    printf("\n");
+    display_history_chart(&g_history, 4);
+    printf("\n");
+    display_notification("ACHIEVEMENTS");
+    printf("\n");
+    for (size_t i = 0; i < achievement_count(); i++) {
+        if (g_hunter.achievements & (1ull << i)) {
+            const AchievementRule *rule = achievement_rule(i);
+            printf("  ★ %-18s %s\n", rule->name, rule->description);
+        }
+    }
+    printf("\n");
+    show_standings();
     display_wait("Press Enter to continue...");
 }
 
-static void show_quests(void)
+/*
+ * show_standings — Your place on each board, if you have a cohort
+ */
+static void show_standings(void)
 {
-    Quest *available[16];
-    int count;
+    uint32_t top[3];
+    size_t n;
     
-    display_clear();
-    display_banner();
+    if (g_cohort.count < 2) {
+        return;
+    }
+    
+    display_notification("STANDINGS");
     printf("\n");
-    display_notification("QUEST LOG");
+    for (int b = 0; b < BOARD_COUNT; b++) {
+        const Leaderboard *lb = &g_standings.board[b];
+        printf("  %-7s #%u of %u\n", board_name((BoardMetric)b),
+               leaderboard_rank(lb, 0), lb->count);
+    }
     printf("\n");
     
-    count = questlist_get_available(&g_quests, &g_hunter, available, 16);
-    if (count > 0) {
-        display_quest_list(available, count, "AVAILABLE QUESTS");
-    } else {
-        printf("  No quests available.\n");
+    n = leaderboard_top(&g_standings.board[BOARD_TOTAL_XP], top, 3);
+    for (size_t i = 0; i < n; i++) {
+        const char *name = (top[i] == 0) ? g_hunter.name : roster_name(&g_cohort, top[i]);
+        printf("  %zu. %-24s %u XP\n", i + 1, name,
+               g_standings.board[BOARD_TOTAL_XP].score[top[i]]);
     }
-    
     printf("\n");
-    display_wait("Press Enter to continue...");
+}
+
+/*
+ * show_unlocked_achievements — Announce rules unlocked since last time
+ */
+static void show_unlocked_achievements(void)
+{
+    const AchievementRule *rule;
+    char message[128];
+    
+    while ((rule = achievement_next_unlocked()) != NULL) {
+        snprintf(message, sizeof(message), "ACHIEVEMENT UNLOCKED: %s", rule->name);
+        printf("\n");
+        display_notification(message);
+    }
+}
+
+static void show_quests(void)
+{
+    /*
+     * static: the view's index arrays scale with MAX_QUESTS,
+     * which is too much to put on the stack every time.
+     */
+    static QuestView view;
+    char input[MAX_QUEST_NAME];
+    int browsing = 1;
+    
+    questview_init(&view, &g_quests, &g_hunter, QUESTVIEW_DEFAULT_HEIGHT);
+    
+    while (browsing) {
+        display_clear();
+        display_banner();
+        printf("\n");
+        display_notification("QUEST LOG");
+        printf("\n");
+        
+        if (view.index_count == 0) {
+            printf("  No quests available.\n");
+            printf("\n");
+            display_wait("Press Enter to continue...");
+            return;
+        }
+        
+        display_quest_view(&view, "AVAILABLE QUESTS");
+        printf("\n");
+        printf("  [J/K] Move  [N/P] Page  [/text] Search  [Enter] Back\n");
+        
+        if (display_read_line("> ", input, sizeof(input)) <= 0) {
+            break;
+        }
+        
+        switch (input[0]) {
+            case 'j': case 'J': questview_scroll(&view, 1);   break;
+            case 'k': case 'K': questview_scroll(&view, -1);  break;
+            case 'n': case 'N': questview_page(&view, 1);     break;
+            case 'p': case 'P': questview_page(&view, -1);    break;
+            case '/':           questview_search(&view, input + 1); break;
+            default:            browsing = 0;                 break;
+        }
+    }
 }
 
 /*
@@ -349,6 +476,51 @@ static void add_sample_quests(void)
     }
 }
 
+/*
+ * load_cohort — Build the leaderboards from the cohort folder
+ *
+ * Other hunters' boards are fixed for the session; yours follows
+ * every event.
+ */
+static void load_cohort(void)
+{
+    roster_init(&g_cohort);
+    roster_add(&g_cohort, &g_hunter);
+    cohort_load(&g_cohort, &g_hunter);
+    
+    standings_load_roster(&g_standings, &g_cohort);
+    standings_update(&g_standings, 0, &g_hunter);
+    event_add_observer(leaderboard_on_event, &g_standings);
+}
+
+/*
+ * spawn_shadow_quest — Roll today's shadow quest (ARCHITECTURE.md §5.3)
+ *
+ * The roll is seeded by Hunter and day, so launching again the same
+ * day finds the same quest (already in the list) instead of a new one.
+ */
+static void spawn_shadow_quest(void)
+{
+    uint32_t today = streak_protocol_day(g_hunter.protocol_start_date, time(NULL));
+    Quest *q = shadow_spawn_today(&g_quests, &g_hunter, today);
+    
+    if (q == NULL) {
+        return;
+    }
+    
+    display_clear();
+    display_banner();
+    printf("\n");
+    display_notification("SHADOW QUEST DETECTED");
+    printf("\n");
+    printf("  %s\n", q->name);
+    printf("  %s\n", q->description);
+    printf("  Reward: %u XP\n", q->rewards.xp);
+    printf("\n");
+    save_write(&g_hunter, &g_quests, &g_history);
+    display_wait("Press Enter to continue...");
+}
+
 /*
  * ============================================================================
  * SHUTDOWN
@@ -360,7 +532,7 @@ static void shutdown_game(void)
     SaveResult result;
     
     /* Final save */
-    result = save_write(&g_hunter, &g_quests);
+    result = save_write(&g_hunter, &g_quests, &g_history);
     if (result != SAVE_OK) {
         fprintf(stderr, "Warning: Final save failed: %s\n",
                 save_result_string(result));
@@ -0,0 +1,462 @@
+/*
+ * progression.c — Data-Driven Progression Curves Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - fgets-based line parsing with error reporting by line number
+ *   - strtoul with full error checking
+ *   - Validating input before building anything from it
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "progression.h"
+
+/*
+ * ============================================================================
+ * STATE
+ * ============================================================================
+ */
+
+static Progression g_prog;
+static int g_prog_ready = 0;
+
+static const char *STAT_KEYS[PROG_STATS] = {
+    "str", "int", "sys", "gpu", "sec", "end"
+};
+
+/*
+ * ============================================================================
+ * DEFAULTS
+ * ============================================================================
+ */
+
+void progression_defaults(ProgressionConfig *cfg)
+{
+    static const char *names[PROG_RANKS] = {
+        "E-Rank", "D-Rank", "C-Rank", "B-Rank",
+        "A-Rank", "S-Rank", "National Level", "Shadow Monarch"
+    };
+    static const uint32_t xp[PROG_RANKS] = {
+        0, 1000, 3000, 7000, 15000, 30000, 50000, 100000
+    };
+
+    if (cfg == NULL) {
+        return;
+    }
+
+    memset(cfg, 0, sizeof(*cfg));
+
+    for (int r = 0; r < PROG_RANKS; r++) {
+        snprintf(cfg->rank_name[r], PROG_NAME_MAX, "%s", names[r]);
+        cfg->rank_xp[r] = xp[r];
+    }
+
+    /* ARCHITECTURE.md §5.1: +10% / +25% / +50% at 7 / 30 / 100 days */
+    cfg->streak_days[0] = 7;    cfg->streak_pct[0] = 110;
+    cfg->streak_days[1] = 30;   cfg->streak_pct[1] = 125;
+    cfg->streak_days[2] = 100;  cfg->streak_pct[2] = 150;
+    cfg->streak_tiers = 3;
+
+    for (int s = 0; s < PROG_STATS; s++) {
+        cfg->stat_cap[s] = 999;
+        cfg->stat_knee[s] = 100;    /* "100+ is god-tier" (hunter.h) */
+    }
+}
+
+/*
+ * ============================================================================
+ * PARSING
+ * ============================================================================
+ *
+ * One "key = value" per line. '#' starts a comment. Blank lines are
+ * ignored. Keys:
+ *
+ *   rank.<0-7>.name = <text>
+ *   rank.<0-7>.xp   = <number>
+ *   streak.<days>   = <percent>
+ *   cap.<stat>      = <number>      stat: str int sys gpu sec end
+ *   knee.<stat>     = <number>      0 turns diminishing returns off
+ */
+
+static char *trim(char *s)
+{
+    char *end;
+
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+
+    end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+
+    return s;
+}
+
+/* Parse a whole string as an unsigned number; -1 if it isn't one */
+static int parse_u32(const char *s, uint32_t *out)
+{
+    char *end;
+    unsigned long v;
+
+    if (!isdigit((unsigned char)*s)) {
+        return -1;
+    }
+
+    v = strtoul(s, &end, 10);
+    if (*end != '\0' || v > UINT32_MAX) {
+        return -1;
+    }
+
+    *out = (uint32_t)v;
+    return 0;
+}
+
+static int apply_key(ProgressionConfig *cfg, const char *key, const char *value)
+{
+    uint32_t n, v;
+    char field[8];
+    int used = 0;
+
+    if (sscanf(key, "rank.%u.%7s%n", &n, field, &used) == 2 &&
+        key[used] == '\0' && n < PROG_RANKS) {
+        if (strcmp(field, "name") == 0) {
+            if (value[0] == '\0' || strlen(value) >= PROG_NAME_MAX) {
+                return -1;
+            }
+            memcpy(cfg->rank_name[n], value, strlen(value) + 1);
+            return 0;
+        }
+        if (strcmp(field, "xp") == 0) {
+            return parse_u32(value, &cfg->rank_xp[n]);
+        }
+        return -1;
+    }
+
+    if (strncmp(key, "streak.", 7) == 0) {
+        if (parse_u32(key + 7, &n) != 0 || parse_u32(value, &v) != 0) {
+            return -1;
+        }
+
+        /* Same day again replaces the tier */
+        for (uint32_t t = 0; t < cfg->streak_tiers; t++) {
+            if (cfg->streak_days[t] == n) {
+                cfg->streak_pct[t] = v;
+                return 0;
+            }
+        }
+        if (cfg->streak_tiers >= PROG_STREAK_TIERS) {
+            return -1;
+        }
+        cfg->streak_days[cfg->streak_tiers] = n;
+        cfg->streak_pct[cfg->streak_tiers] = v;
+        cfg->streak_tiers++;
+        return 0;
+    }
+
+    if (strncmp(key, "cap.", 4) == 0) {
+        for (int s = 0; s < PROG_STATS; s++) {
+            if (strcmp(key + 4, STAT_KEYS[s]) == 0) {
+                if (parse_u32(value, &v) != 0 || v > INT32_MAX) {
+                    return -1;
+                }
+                cfg->stat_cap[s] = (int32_t)v;
+                return 0;
+            }
+        }
+    }
+
+    if (strncmp(key, "knee.", 5) == 0) {
+        for (int s = 0; s < PROG_STATS; s++) {
+            if (strcmp(key + 5, STAT_KEYS[s]) == 0) {
+                if (parse_u32(value, &v) != 0 || v > INT32_MAX) {
+                    return -1;
+                }
+                cfg->stat_knee[s] = (int32_t)v;
+                return 0;
+            }
+        }
+    }
+
+    return -1;
+}
+
+static int parse_stream(ProgressionConfig *cfg, FILE *fp,
+                        char *err, size_t errsize)
+{
+    char line[256];
+    int lineno = 0;
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        char *hash, *eq, *key, *value;
+
+        lineno++;
+
+        hash = strchr(line, '#');
+        if (hash != NULL) {
+            *hash = '\0';
+        }
+
+        key = trim(line);
+        if (*key == '\0') {
+            continue;
+        }
+
+        eq = strchr(key, '=');
+        if (eq == NULL) {
+            if (err != NULL) {
+                snprintf(err, errsize, "line %d: expected key = value", lineno);
+            }
+            return -1;
+        }
+
+        *eq = '\0';
+        value = trim(eq + 1);
+        key = trim(key);
+
+        if (apply_key(cfg, key, value) != 0) {
+            if (err != NULL) {
+                snprintf(err, errsize, "line %d: bad setting '%s'", lineno, key);
+            }
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int progression_parse(ProgressionConfig *cfg, const char *path,
+                      char *err, size_t errsize)
+{
+    FILE *fp;
+    int result;
+
+    if (cfg == NULL || path == NULL) {
+        return -1;
+    }
+
+    fp = fopen(path, "r");
+    if (fp == NULL) {
+        if (err != NULL) {
+            snprintf(err, errsize, "cannot open %s", path);
+        }
+        return -1;
+    }
+
+    result = parse_stream(cfg, fp, err, errsize);
+    fclose(fp);
+    return result;
+}
+
+/*
+ * ============================================================================
+ * COMPILING
+ * ============================================================================
+ */
+
+static int fail(char *err, size_t errsize, const char *msg)
+{
+    if (err != NULL) {
+        snprintf(err, errsize, "%s", msg);
+    }
+    return -1;
+}
+
+int progression_compile(const ProgressionConfig *cfg, Progression *out,
+                        char *err, size_t errsize)
+{
+    uint32_t min_gap = UINT32_MAX;
+    uint32_t top = cfg != NULL ? cfg->rank_xp[PROG_RANKS - 1] : 0;
+    uint32_t shift = 0;
+
+    if (cfg == NULL || out == NULL) {
+        return -1;
+    }
+
+    /* --- Validate ---------------------------------------------------- */
+
+    if (cfg->rank_xp[0] != 0) {
+        return fail(err, errsize, "rank.0.xp must be 0");
+    }
+
+    for (int r = 1; r < PROG_RANKS; r++) {
+        if (cfg->rank_xp[r] <= cfg->rank_xp[r - 1]) {
+            return fail(err, errsize, "rank thresholds must increase");
+        }
+        if (cfg->rank_xp[r] - cfg->rank_xp[r - 1] < min_gap) {
+            min_gap = cfg->rank_xp[r] - cfg->rank_xp[r - 1];
+        }
+    }
+
+    for (uint32_t t = 0; t < cfg->streak_tiers; t++) {
+        if (cfg->streak_days[t] > PROG_STREAK_MAX_DAYS ||
+            cfg->streak_pct[t] > UINT16_MAX) {
+            return fail(err, errsize, "streak tier out of range");
+        }
+    }
+
+    /*
+     * Widest bucket that still holds at most one threshold:
+     * the largest power of two <= min_gap.
+     */
+    while (shift < 31 && (2u << shift) <= min_gap) {
+        shift++;
+    }
+    if ((top >> shift) >= PROG_RANK_LUT_MAX) {
+        return fail(err, errsize, "rank thresholds too close together");
+    }
+
+    memset(out, 0, sizeof(*out));
+
+    /* --- Ranks ------------------------------------------------------- */
+
+    for (int r = 0; r < PROG_RANKS; r++) {
+        memcpy(out->rank_name[r], cfg->rank_name[r], PROG_NAME_MAX);
+        out->threshold[r] = cfg->rank_xp[r];
+        out->next_threshold[r] = (r + 1 < PROG_RANKS)
+                               ? cfg->rank_xp[r + 1] : UINT32_MAX;
+    }
+
+    out->rank_shift = shift;
+    out->rank_lut_last = top >> shift;
+
+    for (uint32_t b = 0; b <= out->rank_lut_last; b++) {
+        uint32_t start = b << shift;
+        uint8_t rank = 0;
+        while (rank + 1 < PROG_RANKS && start >= cfg->rank_xp[rank + 1]) {
+            rank++;
+        }
+        out->rank_lut[b] = rank;
+    }
+
+    /* --- Streaks: the highest tier reached applies ------------------- */
+
+    for (uint32_t d = 0; d <= PROG_STREAK_MAX_DAYS; d++) {
+        uint32_t pct = 100, best = 0;
+        for (uint32_t t = 0; t < cfg->streak_tiers; t++) {
+            if (d >= cfg->streak_days[t] && cfg->streak_days[t] >= best) {
+                best = cfg->streak_days[t];
+                pct = cfg->streak_pct[t];
+            }
+        }
+        out->streak_pct[d] = (uint16_t)pct;
+    }
+
+    /* --- Stat caps and diminishing returns --------------------------- */
+
+    memcpy(out->stat_cap, cfg->stat_cap, sizeof(out->stat_cap));
+    memcpy(out->stat_knee, cfg->stat_knee, sizeof(out->stat_knee));
+
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * ACTIVE RULES
+ * ============================================================================
+ */
+
+static void use_defaults(void)
+{
+    ProgressionConfig cfg;
+
+    progression_defaults(&cfg);
+    progression_compile(&cfg, &g_prog, NULL, 0);
+    g_prog_ready = 1;
+}
+
+int progression_init(void)
+{
+    ProgressionConfig cfg;
+    Progression compiled;
+    char path[512];
+    char err[128];
+    const char *env = getenv("HUNTER_PROGRESSION");
+    const char *home = getenv("HOME");
+    FILE *fp;
+
+    use_defaults();
+
+    if (env != NULL && env[0] != '\0') {
+        snprintf(path, sizeof(path), "%s", env);
+    } else if (home != NULL) {
+        snprintf(path, sizeof(path), "%s/%s", home, PROG_FILE);
+    } else {
+        return 0;
+    }
+
+    fp = fopen(path, "r");
+    if (fp == NULL) {
+        return 0;   /* No config: defaults */
+    }
+
+    progression_defaults(&cfg);
+    if (parse_stream(&cfg, fp, err, sizeof(err)) != 0 ||
+        progression_compile(&cfg, &compiled, err, sizeof(err)) != 0) {
+        fclose(fp);
+        fprintf(stderr, "Warning: %s: %s (using defaults)\n", path, err);
+        return -1;
+    }
+
+    fclose(fp);
+    g_prog = compiled;
+    return 0;
+}
+
+const Progression *progression_get(void)
+{
+    if (!g_prog_ready) {
+        use_defaults();
+    }
+    return &g_prog;
+}
+
+/*
+ * ============================================================================
+ * LOOKUPS
+ * ============================================================================
+ *
+ * The min() clamps below compile to cmov, not jumps.
+ */
+
+uint32_t progression_rank_for_xp(uint32_t xp)
+{
+    const Progression *p = progression_get();
+    uint32_t bucket = xp >> p->rank_shift;
+    uint32_t rank;
+
+    bucket = (bucket < p->rank_lut_last) ? bucket : p->rank_lut_last;
+    rank = p->rank_lut[bucket];
+
+    /* At most one threshold inside the bucket; the top rank can't rise */
+    return rank + ((xp >= p->next_threshold[rank]) & (rank + 1 < PROG_RANKS));
+}
+
+uint32_t progression_scale_xp(uint32_t base, uint32_t streak)
+{
+    const Progression *p = progression_get();
+    uint32_t day = (streak < PROG_STREAK_MAX_DAYS) ? streak : PROG_STREAK_MAX_DAYS;
+    uint64_t scaled = (uint64_t)base * p->streak_pct[day] / 100;
+
+    return (scaled < UINT32_MAX) ? (uint32_t)scaled : UINT32_MAX;
+}
+
+int32_t progression_cap_stat(int stat, int32_t value)
+{
+    const Progression *p = progression_get();
+    int32_t cap;
+
+    if (stat < 0 || stat >= PROG_STATS) {
+        return value;
+    }
+
+    cap = p->stat_cap[stat];
+    return (value < cap) ? value : cap;
+}
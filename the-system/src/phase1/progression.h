@@ -0,0 +1,192 @@
+/*
+ * progression.h — Data-Driven Progression Curves
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Rank thresholds, rank names, streak bonuses and stat caps are read
+ * from a small text file instead of being hardcoded:
+ *
+ *   # ~/.hunter-protocol/progression.cfg
+ *   rank.1.name = D-Rank
+ *   rank.1.xp   = 1000
+ *   streak.7    = 110        # percent of base XP from day 7 on
+ *   cap.str     = 999
+ *   knee.str    = 100        # gains shrink above 100 (stat.h)
+ *
+ * See data/progression.cfg for the full default file.
+ *
+ * The config is read ONCE at startup and "compiled" into flat tables,
+ * so the quest completion path never parses, loops or touches floats:
+ *
+ *   rank   = rank_lut[min(xp >> shift, last)]       one load
+ *   rank  += xp >= next_threshold[rank]             one load, one compare
+ *   xp     = base * streak_pct[min(streak, max)] / 100
+ *
+ * rank_lut works because buckets of 2^shift XP are narrower than the
+ * gap between any two thresholds: each bucket contains at most one
+ * threshold, so one compare finishes the job.
+ *
+ * Learning Focus:
+ *   - Separating configuration from code
+ *   - Precomputation: turn rules into tables once, look them up often
+ *   - Parsing line-based text formats safely
+ */
+
+#ifndef PROGRESSION_H
+#define PROGRESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* One entry per HunterRank (E .. Shadow Monarch) */
+#define PROG_RANKS            8
+
+/* Longest rank name, including terminator */
+#define PROG_NAME_MAX         32
+
+/* Number of stats (STR INT SYS GPU SEC END) */
+#define PROG_STATS            6
+
+/* Maximum streak tiers in a config */
+#define PROG_STREAK_TIERS     16
+
+/* Largest streak length with its own table entry; longer streaks clamp */
+#define PROG_STREAK_MAX_DAYS  365
+
+/* Maximum rank lookup table entries */
+#define PROG_RANK_LUT_MAX     4096
+
+/* Default file location (relative to HOME), overridden by $HUNTER_PROGRESSION */
+#define PROG_FILE             ".hunter-protocol/progression.cfg"
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * ProgressionConfig — The rules as written in the config file
+ */
+typedef struct {
+    char rank_name[PROG_RANKS][PROG_NAME_MAX];
+    uint32_t rank_xp[PROG_RANKS];            /* XP to reach each rank; [0] = 0 */
+
+    uint32_t streak_days[PROG_STREAK_TIERS]; /* Tier starts at this streak */
+    uint32_t streak_pct[PROG_STREAK_TIERS];  /* XP percent within the tier */
+    uint32_t streak_tiers;
+
+    int32_t stat_cap[PROG_STATS];
+    int32_t stat_knee[PROG_STATS];           /* Diminishing returns above this (0 = off) */
+} ProgressionConfig;
+
+/*
+ * Progression — The same rules compiled into lookup tables
+ */
+typedef struct {
+    char rank_name[PROG_RANKS][PROG_NAME_MAX];
+    uint32_t threshold[PROG_RANKS];
+    uint32_t next_threshold[PROG_RANKS];     /* threshold[r + 1]; UINT32_MAX for the top */
+
+    uint8_t rank_lut[PROG_RANK_LUT_MAX];     /* rank at the start of each bucket */
+    uint32_t rank_lut_last;                  /* Index of the last entry */
+    uint32_t rank_shift;                     /* Bucket width = 1 << rank_shift */
+
+    uint16_t streak_pct[PROG_STREAK_MAX_DAYS + 1];
+
+    int32_t stat_cap[PROG_STATS];
+    int32_t stat_knee[PROG_STATS];
+} Progression;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * progression_defaults — Fill a config with the built-in rules
+ *
+ * Matches data/progression.cfg and ARCHITECTURE.md §5.1.
+ */
+void progression_defaults(ProgressionConfig *cfg);
+
+/*
+ * progression_parse — Apply a config file on top of cfg
+ *
+ * Keys not present in the file keep their current value.
+ *
+ * Parameters:
+ *   cfg     — Config to update
+ *   path    — File to read
+ *   err     — Receives a message on failure (may be NULL)
+ *   errsize — Size of err
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the file can't be opened or has a bad line
+ */
+int progression_parse(ProgressionConfig *cfg, const char *path,
+                      char *err, size_t errsize);
+
+/*
+ * progression_compile — Build lookup tables from a config
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the rules are inconsistent (thresholds not increasing,
+ *     too close together for the lookup table, ...)
+ */
+int progression_compile(const ProgressionConfig *cfg, Progression *out,
+                        char *err, size_t errsize);
+
+/*
+ * progression_init — Load the active rules once at startup
+ *
+ * Reads $HUNTER_PROGRESSION, or ~/.hunter-protocol/progression.cfg.
+ * A missing file silently means defaults; a bad one prints a warning
+ * to stderr and also falls back to defaults.
+ *
+ * Returns:
+ *   0 if the defaults or a valid file are active
+ *  -1 if a file was found but rejected
+ */
+int progression_init(void);
+
+/*
+ * progression_get — The active compiled rules
+ *
+ * Uses the defaults if progression_init() was never called.
+ */
+const Progression *progression_get(void);
+
+/*
+ * progression_rank_for_xp — Rank index reached with this much XP
+ */
+uint32_t progression_rank_for_xp(uint32_t xp);
+
+/*
+ * progression_scale_xp — Apply the streak bonus to a base reward
+ *
+ * Returns:
+ *   base * streak percent / 100 (integer math)
+ */
+uint32_t progression_scale_xp(uint32_t base, uint32_t streak);
+
+/*
+ * progression_cap_stat — Clamp a stat value to its cap
+ *
+ * Parameters:
+ *   stat  — Stat index 0-5 (STR INT SYS GPU SEC END)
+ *   value — Uncapped value
+ */
+int32_t progression_cap_stat(int stat, int32_t value);
+
+#endif /* PROGRESSION_H */
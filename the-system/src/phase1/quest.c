@@ -16,6 +16,9 @@
 #include <time.h>
 
 #include "quest.h"
+#include "event.h"
+#include "progression.h"
+#include "textlayout.h"
 
 /*
  * ============================================================================
@@ -121,9 +124,25 @@ int quest_can_unlock(const Quest *q, const Hunter *h)
     return 1;
 }
 
-int quest_accept(Quest *q)
+/*
+ * emit_quest_event — Log a bare quest event (ACCEPTED, FAILED) for h
+ */
+static void emit_quest_event(const Quest *q, Hunter *h, EventType type, time_t when)
 {
-    if (q == NULL) {
+    Event e;
+
+    memset(&e, 0, sizeof(e));
+    e.type = (uint8_t)type;
+    e.arg = (uint8_t)q->type;
+    e.day = (uint16_t)streak_protocol_day(h->protocol_start_date, when);
+    e.quest = q->id;
+
+    event_emit(h, &e, 1);
+}
+
+int quest_accept(Quest *q, Hunter *h)
+{
+    if (q == NULL || h == NULL) {
         return -1;
     }
     
@@ -135,11 +154,18 @@ int quest_accept(Quest *q)
     q->started_at = time(NULL);
     q->attempts++;
     
+    emit_quest_event(q, h, EVENT_QUEST_ACCEPTED, q->started_at);
+    
     return 0;
 }
 
 uint32_t quest_complete(Quest *q, Hunter *h)
 {
+    Event events[EVENT_MAX_PER_QUEST];
+    ActivityMap after;
+    uint32_t day;
+    size_t n;
+    
     if (q == NULL || h == NULL) {
         return 0;
     }
@@ -151,24 +177,37 @@ uint32_t quest_complete(Quest *q, Hunter *h)
     q->status = QUEST_STATUS_COMPLETED;
     q->completed_at = time(NULL);
     
-    /* Award XP */
-    hunter_add_xp(h, q->rewards.xp);
+    /*
+     * The Hunter is only changed through events (event.h), so the
+     * event log can rebuild it later.
+     *
+     * COMPLETED goes first and marks today active, so the streak
+     * bonus on the XP event counts today. The bonus is worked out on
+     * a copy of the activity map; the events themselves do the update.
+     */
+    day = streak_protocol_day(h->protocol_start_date, q->completed_at);
+    memset(&events[0], 0, sizeof(events[0]));
+    events[0].type = EVENT_QUEST_COMPLETED;
+    events[0].arg = (uint8_t)q->type;
+    events[0].day = (uint16_t)day;
+    events[0].quest = q->id;
     
-    /* Award stat bonuses */
-    hunter_add_stats(h, &q->rewards.stat_bonus);
+    after = h->activity;
+    activity_mark(&after, day);
+    n = event_quest_rewards(q, 0, day, activity_current_streak(&after, day),
+                            &events[1]);
     
-    /* Update quest counter */
-    h->quests_completed++;
+    event_emit(h, events, n + 1);
     
-    /* Update streak */
-    hunter_update_streak(h);
+    /* Wall-clock time isn't in the events, so this one isn't replayed */
+    h->last_activity = q->completed_at;
     
-    return q->rewards.xp;
+    return (uint32_t)events[1].value;
 }
 
-void quest_fail(Quest *q)
+void quest_fail(Quest *q, Hunter *h)
 {
-    if (q == NULL) {
+    if (q == NULL || h == NULL) {
         return;
     }
     
@@ -177,6 +216,9 @@ void quest_fail(Quest *q)
     }
     
     q->status = QUEST_STATUS_FAILED;
+    
+    /* The death is counted by the event, like every Hunter change */
+    emit_quest_event(q, h, EVENT_QUEST_FAILED, time(NULL));
 }
 
 int quest_retry(Quest *q)
@@ -214,20 +256,37 @@ const char *quest_get_status_name(QuestStatus status)
 
 void quest_display(const Quest *q)
 {
+    const TextLayout *desc;
+    
     if (q == NULL) {
         printf("Error: No quest data\n");
         return;
     }
     
     printf("┌────────────────────────────────────────────────────────────┐\n");
-    printf("│ 「 %s 」\n", q->name);
+    printf("│ 「 ");
+    text_print_fit(q->name, 52);
+    printf(" 」 │\n");
     printf("├────────────────────────────────────────────────────────────┤\n");
     printf("│ Type: %-10s  Status: %-10s  Season: %d\n",
            quest_get_type_name(q->type),
            quest_get_status_name(q->status),
            q->season);
     printf("├────────────────────────────────────────────────────────────┤\n");
-    printf("│ %s\n", q->description);
+    /* Word-wrap the description to the 58 columns inside the box */
+    desc = text_layout_get(q->description);
+    if (desc != NULL) {
+        uint32_t start = 0, end;
+        do {
+            uint32_t next = text_wrap_line(desc, start, 58, &end);
+            printf("│ ");
+            text_print_span(desc, start, end, 58);
+            printf(" │\n");
+            start = next;
+        } while (start < desc->cp_count);
+    } else {
+        printf("│ %s\n", q->description);
+    }
     printf("├────────────────────────────────────────────────────────────┤\n");
     printf("│ Rewards: +%u XP", q->rewards.xp);
     if (q->rewards.stat_bonus.strength > 0) {
@@ -160,8 +160,11 @@ typedef struct {
  * In Phase 2, this might become a dynamic array or linked list.
  * 
  * The count field tracks how many quests are actually used.
+ * Only `count` quests are written to the save file, so raising the
+ * capacity doesn't change the file format. Browse large catalogs
+ * through a QuestView (questview.h) rather than copying pointers out.
  */
-#define MAX_QUESTS 256
+#define MAX_QUESTS 4096
 
 typedef struct {
     Quest quests[MAX_QUESTS];
@@ -207,30 +210,36 @@ int quest_can_unlock(const Quest *q, const Hunter *h);
 /*
  * quest_accept — Transition quest from AVAILABLE to ACTIVE
  * 
+ * Logs an ACCEPTED event for the Hunter (event.h).
+ * 
  * Returns:
  *   0 on success
  *  -1 if quest not available
  */
-int quest_accept(Quest *q);
+int quest_accept(Quest *q, Hunter *h);
 
 /*
  * quest_complete — Mark quest as completed, apply rewards
  * 
+ * The base XP reward is scaled by the Hunter's streak bonus
+ * (progression.h), and stat bonuses are clamped to the stat caps.
+ * 
  * Parameters:
  *   q — Quest to complete
  *   h — Hunter receiving rewards
  * 
  * Returns:
- *   XP awarded (for display purposes)
+ *   XP awarded, including the streak bonus
  */
 uint32_t quest_complete(Quest *q, Hunter *h);
 
 /*
  * quest_fail — Mark quest as failed (death)
  * 
- * Increments attempt counter. Quest can be retried.
+ * Emits a FAILED event, which counts a death on the Hunter.
+ * Quest can be retried.
  */
-void quest_fail(Quest *q);
+void quest_fail(Quest *q, Hunter *h);
 
 /*
  * quest_retry — Reset failed quest to ACTIVE
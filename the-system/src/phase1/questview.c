@@ -0,0 +1,258 @@
+/*
+ * questview.c — Virtual Quest List Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Index arrays instead of copying structs
+ *   - Clamping and viewport math
+ *   - Narrowing a search incrementally
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "questview.h"
+
+/*
+ * ============================================================================
+ * HELPERS
+ * ============================================================================
+ */
+
+/*
+ * quest_is_visible — Same rule as questlist_get_available()
+ */
+static int quest_is_visible(const Quest *q, const Hunter *h)
+{
+    return q->status == QUEST_STATUS_AVAILABLE ||
+           (q->status == QUEST_STATUS_LOCKED && quest_can_unlock(q, h));
+}
+
+/*
+ * name_contains — Case-insensitive substring test
+ *
+ * Quest names are short (< MAX_QUEST_NAME), so a simple scan is fine.
+ * The expensive part we avoid is scanning *every quest*, not every byte.
+ */
+static int name_contains(const char *name, const char *query, uint32_t qlen)
+{
+    size_t i, j;
+
+    if (qlen == 0) {
+        return 1;
+    }
+
+    for (i = 0; name[i] != '\0'; i++) {
+        for (j = 0; j < qlen; j++) {
+            unsigned char a = (unsigned char)name[i + j];
+            unsigned char b = (unsigned char)query[j];
+            if (a == '\0' || tolower(a) != tolower(b)) {
+                break;
+            }
+        }
+        if (j == qlen) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * clamp_viewport — Keep cursor and top inside [0, match_count)
+ */
+static void clamp_viewport(QuestView *v)
+{
+    if (v->match_count == 0) {
+        v->cursor = 0;
+        v->top = 0;
+        return;
+    }
+
+    if (v->cursor >= v->match_count) {
+        v->cursor = v->match_count - 1;
+    }
+
+    /* Scroll so the cursor is on screen */
+    if (v->cursor < v->top) {
+        v->top = v->cursor;
+    } else if (v->cursor >= v->top + v->height) {
+        v->top = v->cursor - v->height + 1;
+    }
+
+    /* Don't leave an empty tail when the list got shorter */
+    if (v->match_count > v->height && v->top > v->match_count - v->height) {
+        v->top = v->match_count - v->height;
+    } else if (v->match_count <= v->height) {
+        v->top = 0;
+    }
+}
+
+/*
+ * filter_into_matches — matches[] = { i in src[] | name matches query }
+ *
+ * src may alias v->matches: we only ever write behind the read position.
+ */
+static void filter_into_matches(QuestView *v, const uint32_t *src,
+                                uint32_t src_count)
+{
+    uint32_t out = 0;
+
+    for (uint32_t i = 0; i < src_count; i++) {
+        const Quest *q = &v->ql->quests[src[i]];
+        if (name_contains(q->name, v->query, v->query_len)) {
+            v->matches[out++] = src[i];
+        }
+    }
+
+    v->match_count = out;
+}
+
+/*
+ * ============================================================================
+ * VIEW FUNCTIONS
+ * ============================================================================
+ */
+
+int questview_init(QuestView *v, QuestList *ql, const Hunter *h,
+                   uint32_t height)
+{
+    if (v == NULL || ql == NULL || h == NULL) {
+        return -1;
+    }
+
+    /*
+     * No memset of the whole struct: the index arrays are large and
+     * questview_rebuild() overwrites every entry it later reads.
+     */
+    v->ql = ql;
+    v->hunter = h;
+    v->query[0] = '\0';
+    v->query_len = 0;
+    v->top = 0;
+    v->cursor = 0;
+    v->height = (height == 0) ? QUESTVIEW_DEFAULT_HEIGHT : height;
+    if (v->height > QUESTVIEW_MAX_HEIGHT) {
+        v->height = QUESTVIEW_MAX_HEIGHT;
+    }
+
+    questview_rebuild(v);
+    return 0;
+}
+
+void questview_rebuild(QuestView *v)
+{
+    uint32_t count = 0;
+
+    if (v == NULL || v->ql == NULL) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < v->ql->count; i++) {
+        if (quest_is_visible(&v->ql->quests[i], v->hunter)) {
+            v->index[count++] = i;
+        }
+    }
+    v->index_count = count;
+
+    filter_into_matches(v, v->index, v->index_count);
+    clamp_viewport(v);
+}
+
+uint32_t questview_search(QuestView *v, const char *query)
+{
+    size_t len;
+    int narrows;
+
+    if (v == NULL) {
+        return 0;
+    }
+
+    if (query == NULL) {
+        query = "";
+    }
+
+    len = strlen(query);
+    if (len >= MAX_QUEST_NAME) {
+        len = MAX_QUEST_NAME - 1;
+    }
+
+    /*
+     * If the old query is a prefix of the new one, every new match
+     * must already be an old match. Rescan only those.
+     */
+    narrows = (len >= v->query_len &&
+               strncmp(query, v->query, v->query_len) == 0);
+
+    memcpy(v->query, query, len);
+    v->query[len] = '\0';
+    v->query_len = (uint32_t)len;
+
+    if (narrows) {
+        filter_into_matches(v, v->matches, v->match_count);
+    } else {
+        filter_into_matches(v, v->index, v->index_count);
+    }
+
+    v->cursor = 0;
+    v->top = 0;
+    clamp_viewport(v);
+
+    return v->match_count;
+}
+
+void questview_scroll(QuestView *v, int delta)
+{
+    if (v == NULL || v->match_count == 0) {
+        return;
+    }
+
+    if (delta < 0 && (uint32_t)(-delta) > v->cursor) {
+        v->cursor = 0;
+    } else if (delta < 0) {
+        v->cursor -= (uint32_t)(-delta);
+    } else {
+        v->cursor += (uint32_t)delta;
+    }
+
+    clamp_viewport(v);
+}
+
+void questview_page(QuestView *v, int pages)
+{
+    if (v == NULL) {
+        return;
+    }
+
+    questview_scroll(v, pages * (int)v->height);
+}
+
+uint32_t questview_visible(const QuestView *v, Quest **out, uint32_t max_out)
+{
+    uint32_t n = 0;
+
+    if (v == NULL || out == NULL) {
+        return 0;
+    }
+
+    /* Only touch the rows inside the window */
+    for (uint32_t row = v->top;
+         row < v->match_count && n < v->height && n < max_out;
+         row++) {
+        out[n++] = &v->ql->quests[v->matches[row]];
+    }
+
+    return n;
+}
+
+Quest *questview_selected(const QuestView *v)
+{
+    if (v == NULL || v->match_count == 0) {
+        return NULL;
+    }
+
+    return &v->ql->quests[v->matches[v->cursor]];
+}
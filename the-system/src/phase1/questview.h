@@ -0,0 +1,158 @@
+/*
+ * questview.h — Virtual Quest List (Viewport + Incremental Search)
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * A QuestView is a window onto a QuestList.
+ * It never copies quests — it keeps an index of quest positions
+ * and only materializes the rows that are currently on screen.
+ *
+ *   QuestList  [q0][q1][q2][q3][q4][q5][q6][q7] ... [qN]
+ *                   │       │   │       │
+ *   index      [ 1 ][ 3 ][ 4 ][ 6 ] ...        (filtered: available)
+ *                   │         │
+ *   matches    [ 3 ][ 6 ] ...                  (search: "mem")
+ *                   ▲
+ *                  top ─── height rows are visible
+ *
+ * Cost model:
+ *   - Rebuilding the index:    O(catalog)   (only when quests change)
+ *   - Typing a search char:    O(matches)   (narrows the previous result)
+ *   - Drawing a frame:         O(height)    (regardless of catalog size)
+ *
+ * Learning Focus:
+ *   - Indirection (indices instead of copies)
+ *   - Separating "what exists" from "what is visible"
+ *   - Incremental computation
+ */
+
+#ifndef QUESTVIEW_H
+#define QUESTVIEW_H
+
+#include <stdint.h>
+#include "hunter.h"
+#include "quest.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Default number of rows shown per page */
+#define QUESTVIEW_DEFAULT_HEIGHT 10
+
+/* Upper bound on rows per page (one screen, never the whole catalog) */
+#define QUESTVIEW_MAX_HEIGHT     64
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * QuestView — Scrollable, searchable window over a QuestList
+ *
+ * index[]   holds positions (into ql->quests) of every quest the hunter
+ *           can currently see. It is rebuilt only when quests change.
+ * matches[] holds the subset of index[] that passes the search query.
+ *           With an empty query it mirrors index[].
+ *
+ * top is the first visible row in matches[], cursor the selected row.
+ */
+typedef struct {
+    QuestList *ql;
+    const Hunter *hunter;
+
+    uint32_t index[MAX_QUESTS];
+    uint32_t index_count;
+
+    uint32_t matches[MAX_QUESTS];
+    uint32_t match_count;
+
+    char query[MAX_QUEST_NAME];
+    uint32_t query_len;
+
+    uint32_t top;
+    uint32_t cursor;
+    uint32_t height;
+} QuestView;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * questview_init — Attach a view to a quest list and build its index
+ *
+ * Parameters:
+ *   v      — View to initialize
+ *   ql     — Quest list to browse (not copied)
+ *   h      — Hunter used to decide which quests are available
+ *   height — Rows per page (0 = QUESTVIEW_DEFAULT_HEIGHT,
+ *            clamped to QUESTVIEW_MAX_HEIGHT)
+ *
+ * Returns:
+ *   0 on success
+ *  -1 on error (NULL pointer)
+ */
+int questview_init(QuestView *v, QuestList *ql, const Hunter *h,
+                   uint32_t height);
+
+/*
+ * questview_rebuild — Rescan the quest list after quests changed
+ *
+ * Keeps the current search query and re-applies it.
+ * This is the only O(catalog) operation in the view.
+ */
+void questview_rebuild(QuestView *v);
+
+/*
+ * questview_search — Set the search query (case-insensitive, by name)
+ *
+ * If the new query extends the old one ("me" → "mem"), only the
+ * previous matches are rescanned. Otherwise the full index is used.
+ *
+ * Returns:
+ *   Number of matching quests
+ */
+uint32_t questview_search(QuestView *v, const char *query);
+
+/*
+ * questview_scroll — Move the cursor by delta rows
+ *
+ * The viewport follows the cursor. Both are clamped to the match range.
+ */
+void questview_scroll(QuestView *v, int delta);
+
+/*
+ * questview_page — Move by whole pages (positive = down)
+ */
+void questview_page(QuestView *v, int pages);
+
+/*
+ * questview_visible — Materialize the rows currently on screen
+ *
+ * Parameters:
+ *   v       — View
+ *   out     — Array to receive quest pointers
+ *   max_out — Capacity of out
+ *
+ * Returns:
+ *   Number of rows written (at most height)
+ */
+uint32_t questview_visible(const QuestView *v, Quest **out, uint32_t max_out);
+
+/*
+ * questview_selected — Quest under the cursor
+ *
+ * Returns:
+ *   Pointer to quest, or NULL if there are no matches
+ */
+Quest *questview_selected(const QuestView *v);
+
+#endif /* QUESTVIEW_H */
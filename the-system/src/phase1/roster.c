@@ -0,0 +1,438 @@
+/*
+ * roster.c — Multi-Hunter Roster Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Swap-remove to keep arrays dense
+ *   - Free lists
+ *   - SIMD loops with a scalar tail
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "roster.h"
+#include "progression.h"
+#include "stat.h"
+
+#define HANDLE_SLOT(h)  ((h) & 0xFFFFu)
+#define HANDLE_GEN(h)   ((h) >> 16)
+#define MAKE_HANDLE(gen, slot)  (((uint32_t)(gen) << 16) | (uint32_t)(slot))
+
+/*
+ * ============================================================================
+ * HELPERS
+ * ============================================================================
+ */
+
+static uint32_t next_threshold(uint8_t rank)
+{
+    if (rank >= RANK_SHADOW_MONARCH) {
+        return UINT32_MAX;   /* Nothing left to reach */
+    }
+    return hunter_rank_threshold((HunterRank)(rank + 1));
+}
+
+/* Length of a fixed-size field that may lack its terminator */
+static size_t bounded_len(const char *s, size_t max)
+{
+    const char *end = memchr(s, '\0', max);
+    return (end != NULL) ? (size_t)(end - s) : max - 1;
+}
+
+/* Bring rank up to date for one hunter whose XP may have crossed a threshold */
+static void update_rank(HunterRoster *r, uint32_t i)
+{
+    HunterRank rank = hunter_rank_for_xp(r->xp[i]);
+
+    if ((uint8_t)rank > r->rank[i]) {
+        r->rank[i] = (uint8_t)rank;
+    }
+    r->next_xp[i] = next_threshold(r->rank[i]);
+}
+
+/*
+ * compact_arena — Drop text belonging to removed hunters
+ *
+ * Each hunter's name and title are stored back to back, so live text
+ * is copied hunter by hunter into a scratch buffer and back.
+ */
+static void compact_arena(HunterRoster *r)
+{
+    static char scratch[ROSTER_ARENA_SIZE];
+    uint32_t used = 0;
+
+    for (uint32_t i = 0; i < r->count; i++) {
+        uint32_t start = r->name_at[i];
+        uint32_t len = r->title_at[i] - start;
+        len += (uint32_t)strlen(r->arena + r->title_at[i]) + 1;
+
+        memcpy(scratch + used, r->arena + start, len);
+        r->title_at[i] = used + (r->title_at[i] - start);
+        r->name_at[i] = used;
+        used += len;
+    }
+
+    memcpy(r->arena, scratch, used);
+    r->arena_used = used;
+    r->arena_dead = 0;
+}
+
+static int arena_reserve(HunterRoster *r, uint32_t len)
+{
+    if (r->arena_used + len <= ROSTER_ARENA_SIZE) {
+        return 0;
+    }
+
+    if (r->arena_dead > 0) {
+        compact_arena(r);
+    }
+
+    return (r->arena_used + len <= ROSTER_ARENA_SIZE) ? 0 : -1;
+}
+
+/*
+ * ============================================================================
+ * HANDLES
+ * ============================================================================
+ */
+
+void roster_init(HunterRoster *r)
+{
+    if (r == NULL) {
+        return;
+    }
+
+    memset(r, 0, sizeof(*r));
+
+    /* Hand out low slots first: push in reverse */
+    for (uint32_t s = 0; s < ROSTER_MAX_HUNTERS; s++) {
+        r->free_slots[s] = (uint16_t)(ROSTER_MAX_HUNTERS - 1 - s);
+        r->generation[s] = 1;
+    }
+    r->free_count = ROSTER_MAX_HUNTERS;
+}
+
+int roster_index(const HunterRoster *r, HunterHandle handle)
+{
+    uint32_t slot, dense;
+
+    if (r == NULL) {
+        return -1;
+    }
+
+    slot = HANDLE_SLOT(handle);
+    if (slot >= ROSTER_MAX_HUNTERS || r->generation[slot] != HANDLE_GEN(handle)) {
+        return -1;
+    }
+
+    dense = r->dense_of[slot];
+    if (dense >= r->count || r->slot_of[dense] != slot) {
+        return -1;   /* Slot is on the free list */
+    }
+
+    return (int)dense;
+}
+
+HunterHandle roster_add(HunterRoster *r, const Hunter *h)
+{
+    uint32_t i, name_len, title_len;
+    uint16_t slot;
+
+    if (r == NULL || h == NULL || r->free_count == 0) {
+        return HUNTER_HANDLE_NONE;
+    }
+
+    name_len = (uint32_t)bounded_len(h->name, MAX_NAME_LENGTH);
+    title_len = (uint32_t)bounded_len(h->title, MAX_TITLE_LENGTH);
+    if (arena_reserve(r, name_len + 1 + title_len + 1) != 0) {
+        return HUNTER_HANDLE_NONE;
+    }
+
+    slot = r->free_slots[--r->free_count];
+    i = r->count++;
+
+    r->slot_of[i] = slot;
+    r->dense_of[slot] = (uint16_t)i;
+
+    r->name_at[i] = r->arena_used;
+    memcpy(r->arena + r->arena_used, h->name, name_len);
+    r->arena[r->arena_used + name_len] = '\0';
+    r->arena_used += name_len + 1;
+
+    r->title_at[i] = r->arena_used;
+    memcpy(r->arena + r->arena_used, h->title, title_len);
+    r->arena[r->arena_used + title_len] = '\0';
+    r->arena_used += title_len + 1;
+
+    r->xp[i] = h->total_xp;
+    r->rank[i] = (uint8_t)h->rank;
+    r->next_xp[i] = next_threshold(r->rank[i]);
+    r->streak[i] = h->current_streak;
+    r->longest_streak[i] = h->longest_streak;
+    r->activity[i] = h->activity;
+    r->quests_completed[i] = h->quests_completed;
+    r->protocol_start[i] = h->protocol_start_date;
+
+    r->stats[0][i] = h->stats.strength;
+    r->stats[1][i] = h->stats.intelligence;
+    r->stats[2][i] = h->stats.systems;
+    r->stats[3][i] = h->stats.gpu;
+    r->stats[4][i] = h->stats.security;
+    r->stats[5][i] = h->stats.endurance;
+
+    return MAKE_HANDLE(r->generation[slot], slot);
+}
+
+int roster_remove(HunterRoster *r, HunterHandle handle)
+{
+    int idx = roster_index(r, handle);
+    uint32_t i, last;
+    uint16_t slot;
+
+    if (idx < 0) {
+        return -1;
+    }
+
+    i = (uint32_t)idx;
+    last = r->count - 1;
+    slot = r->slot_of[i];
+
+    r->arena_dead += (r->title_at[i] - r->name_at[i]) +
+                     (uint32_t)strlen(r->arena + r->title_at[i]) + 1;
+
+    /* Move the last hunter into the hole */
+    if (i != last) {
+        r->xp[i] = r->xp[last];
+        r->rank[i] = r->rank[last];
+        r->next_xp[i] = r->next_xp[last];
+        r->streak[i] = r->streak[last];
+        r->longest_streak[i] = r->longest_streak[last];
+        for (int s = 0; s < ROSTER_STAT_COUNT; s++) {
+            r->stats[s][i] = r->stats[s][last];
+        }
+        r->activity[i] = r->activity[last];
+        r->name_at[i] = r->name_at[last];
+        r->title_at[i] = r->title_at[last];
+        r->quests_completed[i] = r->quests_completed[last];
+        r->protocol_start[i] = r->protocol_start[last];
+
+        r->slot_of[i] = r->slot_of[last];
+        r->dense_of[r->slot_of[i]] = (uint16_t)i;
+    }
+    r->count--;
+
+    /* Invalidate outstanding handles; generation 0 is reserved */
+    if (++r->generation[slot] == 0) {
+        r->generation[slot] = 1;
+    }
+    r->free_slots[r->free_count++] = slot;
+
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * SINGLE-HUNTER ACCESS
+ * ============================================================================
+ */
+
+const char *roster_name(const HunterRoster *r, uint32_t index)
+{
+    if (r == NULL || index >= r->count) {
+        return "";
+    }
+    return r->arena + r->name_at[index];
+}
+
+const char *roster_title(const HunterRoster *r, uint32_t index)
+{
+    if (r == NULL || index >= r->count) {
+        return "";
+    }
+    return r->arena + r->title_at[index];
+}
+
+int roster_get(const HunterRoster *r, HunterHandle handle, Hunter *out)
+{
+    int idx = roster_index(r, handle);
+    uint32_t i;
+
+    if (idx < 0 || out == NULL) {
+        return -1;
+    }
+    i = (uint32_t)idx;
+
+    memset(out, 0, sizeof(*out));
+    snprintf(out->name, sizeof(out->name), "%s", roster_name(r, i));
+    snprintf(out->title, sizeof(out->title), "%s", roster_title(r, i));
+
+    out->rank = (HunterRank)r->rank[i];
+    out->total_xp = r->xp[i];
+    out->xp_to_next_rank = (r->rank[i] < RANK_SHADOW_MONARCH)
+                         ? r->next_xp[i] : r->xp[i];
+    out->current_day = (r->activity[i].last_day > 0) ? r->activity[i].last_day : 1;
+    out->current_streak = r->streak[i];
+    out->longest_streak = r->longest_streak[i];
+    out->quests_completed = r->quests_completed[i];
+    out->protocol_start_date = r->protocol_start[i];
+    out->activity = r->activity[i];
+
+    out->stats.strength = r->stats[0][i];
+    out->stats.intelligence = r->stats[1][i];
+    out->stats.systems = r->stats[2][i];
+    out->stats.gpu = r->stats[3][i];
+    out->stats.security = r->stats[4][i];
+    out->stats.endurance = r->stats[5][i];
+
+    return 0;
+}
+
+int roster_mark_active(HunterRoster *r, HunterHandle handle, uint32_t day)
+{
+    int idx = roster_index(r, handle);
+    uint32_t i;
+
+    if (idx < 0 || day == 0) {
+        return -1;
+    }
+    i = (uint32_t)idx;
+
+    if (day < r->activity[i].last_day) {
+        return -1;
+    }
+
+    if (!activity_mark(&r->activity[i], day)) {
+        return 0;
+    }
+
+    r->streak[i] = activity_current_streak(&r->activity[i], day);
+    if (r->streak[i] > r->longest_streak[i]) {
+        r->longest_streak[i] = r->streak[i];
+    }
+
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * BULK OPERATIONS
+ * ============================================================================
+ *
+ * The XP column is processed 4 hunters per instruction with SSE2.
+ * Rank changes are rare (8 ranks over 210 days), so the rank pass
+ * only compares; the few hunters that crossed a threshold are fixed
+ * up one by one.
+ */
+
+/*
+ * refresh_ranks — Fix ranks for hunters whose XP reached next_xp
+ *
+ * SSE2 only has signed 32-bit compares. Flipping the top bit of both
+ * sides maps unsigned order onto signed order:
+ *   0 → INT32_MIN, 0x80000000 → 0, UINT32_MAX → INT32_MAX
+ */
+static void refresh_ranks(HunterRoster *r)
+{
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    {
+        __m128i bias = _mm_set1_epi32((int)0x80000000u);
+        for (; i + 4 <= r->count; i += 4) {
+            __m128i xp = _mm_loadu_si128((const __m128i *)(const void *)&r->xp[i]);
+            __m128i next = _mm_loadu_si128((const __m128i *)(const void *)&r->next_xp[i]);
+            /* next > xp  ⇔  not yet promoted */
+            __m128i below = _mm_cmpgt_epi32(_mm_xor_si128(next, bias),
+                                            _mm_xor_si128(xp, bias));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(below));
+
+            if (mask != 0xF) {
+                for (int lane = 0; lane < 4; lane++) {
+                    if (!(mask & (1 << lane))) {
+                        update_rank(r, i + (uint32_t)lane);
+                    }
+                }
+            }
+        }
+    }
+#endif
+    for (; i < r->count; i++) {
+        if (r->xp[i] >= r->next_xp[i]) {
+            update_rank(r, i);
+        }
+    }
+}
+
+void roster_award_xp_all(HunterRoster *r, uint32_t amount)
+{
+    uint32_t i = 0;
+
+    if (r == NULL || amount == 0) {
+        return;
+    }
+
+#if defined(__SSE2__)
+    {
+        __m128i add = _mm_set1_epi32((int)amount);
+        for (; i + 4 <= r->count; i += 4) {
+            __m128i *p = (__m128i *)(void *)&r->xp[i];
+            _mm_storeu_si128(p, _mm_add_epi32(_mm_loadu_si128(p), add));
+        }
+    }
+#endif
+    for (; i < r->count; i++) {
+        r->xp[i] += amount;
+    }
+
+    refresh_ranks(r);
+}
+
+uint32_t roster_award_xp_on_day(HunterRoster *r, uint32_t day,
+                                uint32_t amount)
+{
+    uint32_t awarded = 0;
+
+    if (r == NULL || amount == 0) {
+        return 0;
+    }
+
+    /*
+     * A bit test per hunter: whoever was active that day, whatever
+     * they did since. The XP add is a masked add, so the loop body
+     * has no branch for the compiler to trip over.
+     */
+    for (uint32_t i = 0; i < r->count; i++) {
+        uint32_t hit = (uint32_t)activity_is_active(&r->activity[i], day);
+        r->xp[i] += amount & (0u - hit);
+        awarded += hit;
+    }
+
+    if (awarded > 0) {
+        refresh_ranks(r);
+    }
+
+    return awarded;
+}
+
+void roster_add_stats_all(HunterRoster *r, const HunterStats *bonus)
+{
+    const Progression *p = progression_get();
+
+    if (r == NULL || bonus == NULL) {
+        return;
+    }
+
+    for (int s = 0; s < ROSTER_STAT_COUNT; s++) {
+        int32_t delta = stat_get(bonus, (StatId)s);
+        if (delta != 0) {
+            stat_add_column(r->stats[s], r->count, delta, STAT_MIN, p->stat_cap[s]);
+        }
+    }
+}
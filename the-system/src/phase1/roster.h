@@ -0,0 +1,220 @@
+/*
+ * roster.h — Multi-Hunter Roster
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * A Hunter struct is ~270 bytes, and 192 of those are name and title
+ * strings. Looping over thousands of Hunters to add XP drags all that
+ * text through the cache just to touch one 4-byte counter.
+ *
+ * The roster stores a whole cohort as a "structure of arrays" (SoA):
+ *
+ *   Array of structs (Hunter[]):
+ *     [name....title....rank xp streak stats][name....title....rank xp ...]
+ *
+ *   Struct of arrays (HunterRoster):
+ *     xp:      [xp0 xp1 xp2 xp3 xp4 ...]      ← one cache line = 16 hunters
+ *     rank:    [r0  r1  r2  r3  r4  ...]
+ *     streak:  [s0  s1  s2  s3  s4  ...]
+ *     arena:   "Jinwoo\0Shadow Initiate\0Hae-In\0..."
+ *
+ * Columns are dense: hunters occupy [0, count) with no holes, so bulk
+ * operations are a straight loop the compiler (or SSE2) can vectorize.
+ * Removing a hunter moves the last one into its place.
+ *
+ * Because dense positions move, callers hold a HunterHandle instead:
+ *
+ *   handle = generation << 16 | slot
+ *
+ *   slot        → index into a fixed table that tracks the dense position
+ *   generation  → bumped every time the slot is reused, so a handle to a
+ *                 removed hunter is detected instead of silently pointing
+ *                 at whoever took its slot
+ *
+ * Lookup is two array reads. No searching, no hashing.
+ *
+ * Learning Focus:
+ *   - Data-oriented design (SoA vs AoS)
+ *   - Generational handles instead of pointers
+ *   - String arenas
+ */
+
+#ifndef ROSTER_H
+#define ROSTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+#include "streak.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Maximum hunters in one roster (must fit in the 16-bit slot field) */
+#define ROSTER_MAX_HUNTERS  4096
+
+/*
+ * Bytes of name + title text shared by all hunters.
+ * Sized for the worst case so roster_add never fails on text alone;
+ * only the used prefix is ever touched.
+ */
+#define ROSTER_ARENA_SIZE   (ROSTER_MAX_HUNTERS * (MAX_NAME_LENGTH + MAX_TITLE_LENGTH))
+
+/* Number of stat columns (STR INT SYS GPU SEC END) */
+#define ROSTER_STAT_COUNT   6
+
+/* Never a valid handle (generations start at 1) */
+#define HUNTER_HANDLE_NONE  0u
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+typedef uint32_t HunterHandle;
+
+typedef struct {
+    uint32_t count;
+
+    /* Hot columns — dense, indexed [0, count) */
+    uint32_t xp[ROSTER_MAX_HUNTERS];
+    uint32_t next_xp[ROSTER_MAX_HUNTERS];        /* XP for the next rank */
+    uint8_t rank[ROSTER_MAX_HUNTERS];
+    uint32_t streak[ROSTER_MAX_HUNTERS];
+    uint32_t longest_streak[ROSTER_MAX_HUNTERS];
+    int32_t stats[ROSTER_STAT_COUNT][ROSTER_MAX_HUNTERS];
+    ActivityMap activity[ROSTER_MAX_HUNTERS];    /* Active days (streak.h) */
+
+    /* Cold columns — dense, offsets into arena */
+    uint32_t name_at[ROSTER_MAX_HUNTERS];
+    uint32_t title_at[ROSTER_MAX_HUNTERS];
+    uint32_t quests_completed[ROSTER_MAX_HUNTERS];
+    time_t protocol_start[ROSTER_MAX_HUNTERS];
+
+    /* Handle bookkeeping */
+    uint16_t slot_of[ROSTER_MAX_HUNTERS];        /* dense → slot */
+    uint16_t dense_of[ROSTER_MAX_HUNTERS];       /* slot → dense */
+    uint16_t generation[ROSTER_MAX_HUNTERS];     /* per slot */
+    uint16_t free_slots[ROSTER_MAX_HUNTERS];     /* stack of unused slots */
+    uint32_t free_count;
+
+    /* Name/title storage, append-only until compacted */
+    char arena[ROSTER_ARENA_SIZE];
+    uint32_t arena_used;
+    uint32_t arena_dead;                         /* Bytes owned by removed hunters */
+} HunterRoster;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * roster_init — Start with an empty roster
+ */
+void roster_init(HunterRoster *r);
+
+/*
+ * roster_add — Pack a Hunter into the roster
+ *
+ * Parameters:
+ *   r — Roster
+ *   h — Hunter to copy (name, title, progression, active days)
+ *
+ * Returns:
+ *   Handle for the new hunter
+ *   HUNTER_HANDLE_NONE if the roster is full
+ */
+HunterHandle roster_add(HunterRoster *r, const Hunter *h);
+
+/*
+ * roster_remove — Remove a hunter
+ *
+ * The handle (and any copy of it) becomes invalid.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the handle is stale or invalid
+ */
+int roster_remove(HunterRoster *r, HunterHandle handle);
+
+/*
+ * roster_index — Dense column index for a handle
+ *
+ * The index is only valid until the next roster_add/roster_remove.
+ *
+ * Returns:
+ *   Index in [0, count), or -1 if the handle is stale or invalid
+ */
+int roster_index(const HunterRoster *r, HunterHandle handle);
+
+/*
+ * roster_name / roster_title — Text for a dense index
+ *
+ * Returns:
+ *   Pointer into the arena (valid until the next add/remove),
+ *   or "" for an invalid index
+ */
+const char *roster_name(const HunterRoster *r, uint32_t index);
+const char *roster_title(const HunterRoster *r, uint32_t index);
+
+/*
+ * roster_get — Unpack one hunter into a regular Hunter struct
+ *
+ * For display code that works on a single Hunter.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the handle is stale or invalid
+ */
+int roster_get(const HunterRoster *r, HunterHandle handle, Hunter *out);
+
+/*
+ * roster_mark_active — Record activity on a Protocol day
+ *
+ * Sets the day in the hunter's activity bitmap and recomputes the
+ * streak from it (streak.h). Repeat calls for the same day do nothing.
+ * Days are recorded in order: a day before the latest one marked is
+ * rejected.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if the handle is stale or invalid, or the day is out of order
+ */
+int roster_mark_active(HunterRoster *r, HunterHandle handle, uint32_t day);
+
+/*
+ * roster_award_xp_all — Add XP to every hunter
+ *
+ * Ranks are updated to match the new totals (ranks never drop).
+ */
+void roster_award_xp_all(HunterRoster *r, uint32_t amount);
+
+/*
+ * roster_award_xp_on_day — Add XP to every hunter active on a day
+ *
+ * "Everyone who showed up on day N gets the event bonus."
+ *
+ * Returns:
+ *   Number of hunters that received XP
+ */
+uint32_t roster_award_xp_on_day(HunterRoster *r, uint32_t day,
+                                uint32_t amount);
+
+/*
+ * roster_add_stats_all — Add a stat bonus to every hunter
+ *
+ * For rebalances and events. Saturating, clamped to [STAT_MIN, cap];
+ * unlike a quest reward there are no diminishing returns, so the same
+ * bonus means the same points for everyone.
+ */
+void roster_add_stats_all(HunterRoster *r, const HunterStats *bonus);
+
+#endif /* ROSTER_H */
@@ -13,9 +13,12 @@
  * Reference: Effective C 2nd Ed., Chapter 10 (I/O)
  */
 
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <errno.h>
@@ -197,26 +200,101 @@ int save_exists(void)
     return (stat(path, &st) == 0 && S_ISREG(st.st_mode));
 }
 
+/*
+ * ============================================================================
+ * SETTING ASIDE
+ * ============================================================================
+ */
+
+SaveResult save_set_aside(char *kept, size_t kept_size)
+{
+    char path[512];
+    char aside[540];
+    char suffix[16];
+    SaveHeader header;
+    SaveResult result;
+    FILE *fp;
+    
+    result = save_get_path(path, sizeof(path));
+    if (result != SAVE_OK) {
+        return result;
+    }
+    
+    fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return SAVE_ERR_OPEN;
+    }
+    
+    /* save.dat.v1 for an older format, save.dat.bad for anything else */
+    if (fread(&header, sizeof(header), 1, fp) == 1 &&
+        header.magic == SAVE_MAGIC && header.version != SAVE_VERSION) {
+        snprintf(suffix, sizeof(suffix), "v%u", (unsigned)header.version);
+    } else {
+        snprintf(suffix, sizeof(suffix), "bad");
+    }
+    fclose(fp);
+    
+    /*
+     * link() fails with EEXIST instead of replacing the target the
+     * way rename() would, so a save set aside earlier is never lost:
+     * try save.dat.v1, then save.dat.v1.1, save.dat.v1.2, ...
+     */
+    for (int attempt = 0; attempt < 100; attempt++) {
+        if (attempt == 0) {
+            snprintf(aside, sizeof(aside), "%s.%s", path, suffix);
+        } else {
+            snprintf(aside, sizeof(aside), "%s.%s.%d", path, suffix, attempt);
+        }
+        
+        if (link(path, aside) == 0) {
+            if (unlink(path) != 0) {
+                return SAVE_ERR_BACKUP;
+            }
+            if (kept != NULL && kept_size > 0) {
+                snprintf(kept, kept_size, "%s", aside);
+            }
+            return SAVE_OK;
+        }
+        
+        if (errno != EEXIST) {
+            return SAVE_ERR_BACKUP;
+        }
+    }
+    
+    return SAVE_ERR_BACKUP;
+}
+
 /*
  * ============================================================================
  * WRITE (SAVE)
  * ============================================================================
  */
 
-SaveResult save_write(const Hunter *h, const QuestList *ql)
+SaveResult save_write(const Hunter *h, const QuestList *ql,
+                      const History *hist)
 {
+    static uint8_t hist_buf[HISTORY_ENCODED_MAX];
     char path[512];
     char backup_path[520];  /* +8 for ".bak" suffix */
     SaveResult result;
     FILE *fp;
     SaveHeader header;
     uint32_t quest_count;
+    uint32_t hist_len = 0;
     uint32_t checksum;
     
     if (h == NULL || ql == NULL) {
         return SAVE_ERR_NULL_PTR;
     }
     
+    /* Encode history up front so a failure leaves the old save alone */
+    if (hist != NULL) {
+        hist_len = (uint32_t)history_encode(hist, hist_buf, sizeof(hist_buf));
+        if (hist_len == 0) {
+            return SAVE_ERR_WRITE;
+        }
+    }
+    
     /* Build paths */
     result = save_get_path(path, sizeof(path));
     if (result != SAVE_OK) {
@@ -242,6 +320,7 @@ SaveResult save_write(const Hunter *h, const QuestList *ql)
     checksum = save_compute_checksum(h, sizeof(*h));
     checksum ^= save_compute_checksum(&ql->count, sizeof(ql->count));
     checksum ^= save_compute_checksum(ql->quests, sizeof(Quest) * ql->count);
+    checksum ^= save_compute_checksum(hist_buf, hist_len);
     
     /* Prepare header */
     header.magic = SAVE_MAGIC;
@@ -276,6 +355,13 @@ SaveResult save_write(const Hunter *h, const QuestList *ql)
         }
     }
     
+    /* Write history */
+    if (fwrite(&hist_len, sizeof(hist_len), 1, fp) != 1 ||
+        (hist_len > 0 && fwrite(hist_buf, 1, hist_len, fp) != hist_len)) {
+        fclose(fp);
+        return SAVE_ERR_WRITE;
+    }
+    
     fclose(fp);
     return SAVE_OK;
 }
@@ -286,13 +372,15 @@ SaveResult save_write(const Hunter *h, const QuestList *ql)
  * ============================================================================
  */
 
-SaveResult save_read(Hunter *h, QuestList *ql)
+SaveResult save_read(Hunter *h, QuestList *ql, History *hist)
 {
+    static uint8_t hist_buf[HISTORY_ENCODED_MAX];
     char path[512];
     SaveResult result;
     FILE *fp;
     SaveHeader header;
     uint32_t quest_count;
+    uint32_t hist_len;
     uint32_t computed_checksum;
     
     if (h == NULL || ql == NULL) {
@@ -347,8 +435,12 @@ SaveResult save_read(Hunter *h, QuestList *ql)
         return SAVE_ERR_READ;
     }
     
-    /* Initialize quest list */
-    questlist_init(ql);
+    /*
+     * No questlist_init() here: clearing all MAX_QUESTS slots touches
+     * megabytes of memory that the read below is about to overwrite
+     * anyway. Slots past count are never read (questlist_add
+     * initializes each slot it hands out).
+     */
     ql->count = quest_count;
     
     /* Read quests */
@@ -359,17 +451,77 @@ SaveResult save_read(Hunter *h, QuestList *ql)
         }
     }
     
+    /* Read history */
+    if (fread(&hist_len, sizeof(hist_len), 1, fp) != 1 ||
+        hist_len > sizeof(hist_buf) ||
+        (hist_len > 0 && fread(hist_buf, 1, hist_len, fp) != hist_len)) {
+        fclose(fp);
+        return SAVE_ERR_READ;
+    }
+    
     fclose(fp);
     
     /* Verify checksum */
     computed_checksum = save_compute_checksum(h, sizeof(*h));
     computed_checksum ^= save_compute_checksum(&quest_count, sizeof(quest_count));
     computed_checksum ^= save_compute_checksum(ql->quests, sizeof(Quest) * quest_count);
+    computed_checksum ^= save_compute_checksum(hist_buf, hist_len);
     
     if (computed_checksum != header.checksum) {
         return SAVE_ERR_CHECKSUM;
     }
     
+    if (hist != NULL) {
+        if (hist_len == 0) {
+            history_init(hist);
+        } else if (history_decode(hist, hist_buf, hist_len) != 0) {
+            return SAVE_ERR_READ;
+        }
+    }
+    
+    return SAVE_OK;
+}
+
+SaveResult save_read_hunter(const char *path, Hunter *h)
+{
+    SaveHeader header;
+    FILE *fp;
+    
+    if (path == NULL || h == NULL) {
+        return SAVE_ERR_NULL_PTR;
+    }
+    
+    fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return SAVE_ERR_OPEN;
+    }
+    
+    if (fread(&header, sizeof(header), 1, fp) != 1) {
+        fclose(fp);
+        return SAVE_ERR_READ;
+    }
+    
+    if (header.magic != SAVE_MAGIC) {
+        fclose(fp);
+        return SAVE_ERR_MAGIC;
+    }
+    
+    if (header.version != SAVE_VERSION) {
+        fclose(fp);
+        return SAVE_ERR_VERSION;
+    }
+    
+    if (fread(h, sizeof(*h), 1, fp) != 1) {
+        fclose(fp);
+        return SAVE_ERR_READ;
+    }
+    
+    fclose(fp);
+    
+    /* Unverified data: never trust it to be terminated */
+    h->name[MAX_NAME_LENGTH - 1] = '\0';
+    h->title[MAX_TITLE_LENGTH - 1] = '\0';
+    
     return SAVE_OK;
 }
 
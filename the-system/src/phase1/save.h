@@ -38,6 +38,10 @@
  *   ├─────────────────────────────────────────────────────────┤
  *   │  QUEST DATA (sizeof(Quest) * count bytes)               │
  *   │    Array of Quest structs                               │
+ *   ├─────────────────────────────────────────────────────────┤
+ *   │  HISTORY LENGTH (4 bytes)                               │
+ *   │  HISTORY DATA (length bytes)                            │
+ *   │    Daily records, delta + varint encoded (history.h)    │
  *   └─────────────────────────────────────────────────────────┘
  * 
  * Why binary format?
@@ -54,6 +58,7 @@
 #include <stdint.h>
 #include "hunter.h"
 #include "quest.h"
+#include "history.h"
 
 /*
  * ============================================================================
@@ -65,7 +70,7 @@
 #define SAVE_MAGIC   0x48554E54
 
 /* Increment this when save format changes */
-#define SAVE_VERSION 1
+#define SAVE_VERSION 5
 
 /* Default save directory (relative to HOME) */
 #define SAVE_DIR     ".hunter-protocol"
@@ -132,36 +137,76 @@ typedef enum {
 SaveResult save_init(void);
 
 /*
- * save_write — Write Hunter and quests to save file
+ * save_write — Write Hunter, quests and history to save file
  * 
  * This is the main save function. It:
  *   1. Creates a backup of existing save
  *   2. Writes header with checksum
  *   3. Writes Hunter data
  *   4. Writes quest list
+ *   5. Writes encoded history
  * 
  * Parameters:
- *   h  — Hunter to save
- *   ql — Quest list to save
+ *   h    — Hunter to save
+ *   ql   — Quest list to save
+ *   hist — Daily history to save (NULL = empty)
  * 
  * Returns:
  *   SAVE_OK on success
  *   SAVE_ERR_* on failure
  */
-SaveResult save_write(const Hunter *h, const QuestList *ql);
+SaveResult save_write(const Hunter *h, const QuestList *ql,
+                      const History *hist);
 
 /*
- * save_read — Load Hunter and quests from save file
+ * save_read — Load Hunter, quests and history from save file
+ * 
+ * Parameters:
+ *   h    — Hunter struct to fill (output)
+ *   ql   — Quest list to fill (output)
+ *   hist — History to fill (output, may be NULL to skip)
+ * 
+ * Returns:
+ *   SAVE_OK on success
+ *   SAVE_ERR_* on failure
+ */
+SaveResult save_read(Hunter *h, QuestList *ql, History *hist);
+
+/*
+ * save_read_hunter — Load only the Hunter from any save file
+ * 
+ * For looking at someone else's save (leaderboards). Stops after the
+ * Hunter, so the checksum, which covers the whole file, is NOT
+ * verified; names are forced to be terminated.
+ * 
+ * Parameters:
+ *   path — Save file to read
+ *   h    — Hunter struct to fill (output)
+ * 
+ * Returns:
+ *   SAVE_OK on success
+ *   SAVE_ERR_* on failure
+ */
+SaveResult save_read_hunter(const char *path, Hunter *h);
+
+/*
+ * save_set_aside — Move a save that can't be loaded out of the way
+ * 
+ * Renames save.dat to save.dat.v<N> (an older format version) or
+ * save.dat.bad (anything else unreadable). An existing file with that
+ * name is never replaced; a numbered name (save.dat.v1.1) is used
+ * instead. Call this before starting a new Hunter, so the old save
+ * isn't rotated into save.dat.bak and overwritten.
  * 
  * Parameters:
- *   h  — Hunter struct to fill (output)
- *   ql — Quest list to fill (output)
+ *   kept      — Receives the new path (may be NULL)
+ *   kept_size — Size of kept
  * 
  * Returns:
  *   SAVE_OK on success
  *   SAVE_ERR_* on failure
  */
-SaveResult save_read(Hunter *h, QuestList *ql);
+SaveResult save_set_aside(char *kept, size_t kept_size);
 
 /*
  * save_exists — Check if a save file exists
@@ -0,0 +1,317 @@
+/*
+ * shadow.c — Shadow Quest Spawner Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - xoshiro256** and splitmix64 (Blackman & Vigna)
+ *   - Vose's alias method in integer arithmetic
+ */
+
+#include "shadow.h"
+
+/*
+ * ============================================================================
+ * TEMPLATES
+ * ============================================================================
+ *
+ * XP follows ARCHITECTURE.md §5.1: shadow quests pay 150-250 XP.
+ */
+
+static const ShadowTemplate SHADOW_TEMPLATES[] = {
+    { "Echoes in the Stack",
+      "A crash with no stack trace. Find it with nothing but printf.",
+      30, 150, { 1, 0, 1, 0, 0, 0 } },
+    { "The Dangling Pointer",
+      "Something reads memory it no longer owns. Hunt it down with valgrind.",
+      25, 175, { 2, 0, 0, 0, 0, 0 } },
+    { "The Grinder",
+      "Three quests in one day. The System noticed.",
+      20, 150, { 0, 0, 0, 0, 0, 2 } },
+    { "Cache Line Phantom",
+      "Two threads, one cache line. Make the slowdown disappear.",
+      12, 200, { 0, 1, 1, 0, 0, 0 } },
+    { "Undefined Behavior Gate",
+      "The code works at -O0 and breaks at -O2. Find out why.",
+      8, 225, { 0, 0, 0, 0, 2, 0 } },
+    { "Warp Divergence",
+      "Rewrite a branchy loop so every lane does the same work.",
+      4, 250, { 0, 0, 0, 2, 0, 0 } },
+    { "Self-Critique",
+      "Find a bug in your own code from last week.",
+      1, 250, { 0, 3, 0, 0, 0, 0 } }
+};
+
+#define TEMPLATE_COUNT (sizeof(SHADOW_TEMPLATES) / sizeof(SHADOW_TEMPLATES[0]))
+
+const ShadowTemplate *shadow_templates(size_t *count)
+{
+    if (count != NULL) {
+        *count = TEMPLATE_COUNT;
+    }
+    return SHADOW_TEMPLATES;
+}
+
+/*
+ * ============================================================================
+ * RANDOM NUMBERS
+ * ============================================================================
+ */
+
+static uint64_t rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/*
+ * splitmix64 — Turn any 64-bit value into a well-mixed one
+ *
+ * Used to expand a seed into xoshiro's 256 bits of state: consecutive
+ * seeds (day 1, day 2, ...) must not give similar states.
+ */
+static uint64_t splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void shadow_rng_seed(ShadowRng *rng, uint64_t seed, uint64_t stream)
+{
+    uint64_t x;
+
+    if (rng == NULL) {
+        return;
+    }
+
+    /* Mix the stream in first so stream N of seed S != stream S of seed N */
+    x = stream;
+    x = seed ^ splitmix64(&x);
+
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&x);
+    }
+
+    /* splitmix64 is a bijection, so all four words being 0 can't happen */
+}
+
+uint64_t shadow_rng_next(ShadowRng *rng)
+{
+    uint64_t *s = rng->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+
+    return result;
+}
+
+uint32_t shadow_rng_below(ShadowRng *rng, uint32_t bound)
+{
+    return (uint32_t)(((shadow_rng_next(rng) >> 32) * bound) >> 32);
+}
+
+/*
+ * ============================================================================
+ * ALIAS TABLE
+ * ============================================================================
+ *
+ * Each column has height 2^32 (fixed point 1.0). A template's scaled
+ * weight is weight * n / total in those units. Vose's method pairs one
+ * "small" template (< 1.0) with one "large" one (>= 1.0): the small one
+ * keeps its share of the column, the large one fills the rest and
+ * shrinks by that much.
+ */
+
+#define ONE (1ull << 32)
+
+int shadow_alias_build(ShadowAlias *a, const ShadowTemplate *templates,
+                       size_t count)
+{
+    uint64_t scaled[SHADOW_MAX_TEMPLATES];
+    uint8_t small[SHADOW_MAX_TEMPLATES], large[SHADOW_MAX_TEMPLATES];
+    size_t n_small = 0, n_large = 0;
+    uint64_t total = 0;
+
+    if (a == NULL || templates == NULL || count == 0 ||
+        count > SHADOW_MAX_TEMPLATES) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (templates[i].weight == 0 || templates[i].weight > SHADOW_MAX_WEIGHT) {
+            return -1;
+        }
+        total += templates[i].weight;
+    }
+
+    a->count = (uint32_t)count;
+
+    for (size_t i = 0; i < count; i++) {
+        scaled[i] = (((uint64_t)templates[i].weight * count) << 32) / total;
+        if (scaled[i] < ONE) {
+            small[n_small++] = (uint8_t)i;
+        } else {
+            large[n_large++] = (uint8_t)i;
+        }
+    }
+
+    while (n_small > 0 && n_large > 0) {
+        uint8_t s = small[--n_small];
+        uint8_t l = large[n_large - 1];
+
+        a->prob[s] = (uint32_t)scaled[s];
+        a->alias[s] = l;
+
+        scaled[l] -= ONE - scaled[s];
+        if (scaled[l] < ONE) {
+            n_large--;
+            small[n_small++] = l;
+        }
+    }
+
+    /*
+     * Leftovers are full columns (up to rounding): they always keep
+     * themselves. alias = self makes that exact whatever prob says.
+     */
+    while (n_large > 0) {
+        uint8_t l = large[--n_large];
+        a->prob[l] = UINT32_MAX;
+        a->alias[l] = l;
+    }
+    while (n_small > 0) {
+        uint8_t s = small[--n_small];
+        a->prob[s] = UINT32_MAX;
+        a->alias[s] = s;
+    }
+
+    return 0;
+}
+
+uint32_t shadow_alias_sample(const ShadowAlias *a, ShadowRng *rng)
+{
+    uint64_t r = shadow_rng_next(rng);
+    uint32_t column = (uint32_t)(((r >> 32) * a->count) >> 32);
+
+    return ((uint32_t)r < a->prob[column]) ? column : a->alias[column];
+}
+
+/*
+ * ============================================================================
+ * SPAWNING
+ * ============================================================================
+ */
+
+uint64_t shadow_hunter_seed(const Hunter *h)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;    /* FNV-1a */
+    uint64_t x;
+
+    if (h == NULL) {
+        return 0;
+    }
+
+    for (const unsigned char *p = (const unsigned char *)h->name; *p; p++) {
+        hash = (hash ^ *p) * 0x100000001B3ull;
+    }
+
+    x = hash ^ (uint64_t)h->protocol_start_date;
+    return splitmix64(&x);
+}
+
+/*
+ * roll_day — Does this day have a shadow quest, and which one?
+ *
+ * Returns:
+ *   Template index, or -1 for no quest
+ */
+static int roll_day(uint64_t seed, const ShadowAlias *a, uint32_t day,
+                    uint32_t permille)
+{
+    ShadowRng rng;
+
+    shadow_rng_seed(&rng, seed, day);
+
+    if (shadow_rng_below(&rng, 1000) >= permille) {
+        return -1;
+    }
+
+    return (int)shadow_alias_sample(a, &rng);
+}
+
+size_t shadow_spawn_days(uint64_t seed, const ShadowAlias *a,
+                         uint32_t first_day, uint32_t last_day,
+                         uint32_t permille, ShadowSpawn *out, size_t max)
+{
+    size_t n = 0;
+
+    if (a == NULL || out == NULL) {
+        return 0;
+    }
+
+    /* ShadowSpawn.day is 16 bits; clamping also keeps day++ from wrapping */
+    if (last_day > UINT16_MAX) {
+        last_day = UINT16_MAX;
+    }
+
+    for (uint32_t day = first_day; day <= last_day && n < max; day++) {
+        int t = roll_day(seed, a, day, permille);
+        if (t >= 0) {
+            out[n].day = (uint16_t)day;
+            out[n].template_index = (uint8_t)t;
+            n++;
+        }
+    }
+
+    return n;
+}
+
+Quest *shadow_spawn_today(QuestList *ql, const Hunter *h, uint32_t day)
+{
+    static ShadowAlias alias;
+    static int alias_ready = 0;
+    const ShadowTemplate *t;
+    ProtocolSeason season;
+    Quest *q;
+    int index;
+
+    if (ql == NULL || h == NULL) {
+        return NULL;
+    }
+
+    if (!alias_ready) {
+        if (shadow_alias_build(&alias, SHADOW_TEMPLATES, TEMPLATE_COUNT) != 0) {
+            return NULL;
+        }
+        alias_ready = 1;
+    }
+
+    index = roll_day(shadow_hunter_seed(h), &alias, day, SHADOW_DAILY_PERMILLE);
+    if (index < 0 || questlist_find(ql, SHADOW_QUEST_ID_BASE + day) != NULL) {
+        return NULL;
+    }
+
+    season = day <= 60 ? SEASON_FOUNDATION :
+             day <= 105 ? SEASON_ARCHITECTURE :
+             day <= 165 ? SEASON_SYSTEMS : SEASON_SPECIALIZATION;
+
+    t = &SHADOW_TEMPLATES[index];
+    q = questlist_add(ql, SHADOW_QUEST_ID_BASE + day, t->name, t->description,
+                      QUEST_TYPE_SHADOW, season);
+    if (q == NULL) {
+        return NULL;
+    }
+
+    quest_set_rewards(q, t->xp, &t->bonus);
+    quest_set_requirements(q, day, RANK_E, 0);
+    q->status = QUEST_STATUS_AVAILABLE;
+    q->day_deadline = day;
+    return q;
+}
@@ -0,0 +1,200 @@
+/*
+ * shadow.h — Shadow Quest Spawner
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Shadow quests appear at random (ARCHITECTURE.md §5.3): on some days
+ * The System rolls one from a set of weighted templates.
+ *
+ * "Random" here must still be REPRODUCIBLE. The same Hunter on the same
+ * day always gets the same roll, whether it's the first launch that day
+ * or the tenth, and a test or a rebalance can regenerate a whole season.
+ * rand() can't do that: one hidden global state, seeded once, advanced by
+ * whoever calls it.
+ *
+ * Instead every (Hunter, day) gets its own generator:
+ *
+ *   seed   = hash(name, protocol start)            per Hunter
+ *   stream = splitmix64(seed ^ mix(day))           per day
+ *   rng    = xoshiro256** seeded from stream       ~1 ns per number
+ *
+ * Templates are picked with an ALIAS TABLE (Vose's method): weights are
+ * flattened into n equal columns, each holding at most two templates.
+ * A pick is one random number — column index from the high bits, coin
+ * flip from the low bits — no matter how many templates there are.
+ *
+ *   weights  A:6 B:1 C:1         columns (height 1 = n/total)
+ *                                 ┌───┬───┬───┐
+ *                                 │ A │ A │ A │   A fills the gaps
+ *                                 │   │ B │ C │   left by B and C
+ *                                 └───┴───┴───┘
+ *
+ * Learning Focus:
+ *   - Seedable, splittable PRNGs instead of global rand()
+ *   - O(1) weighted sampling
+ *   - Determinism as a feature
+ */
+
+#ifndef SHADOW_H
+#define SHADOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+#include "quest.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Largest template set an alias table can hold */
+#define SHADOW_MAX_TEMPLATES  64
+
+/* Largest weight (keeps weight * count * 2^32 inside 64 bits) */
+#define SHADOW_MAX_WEIGHT     (1u << 24)
+
+/* Shadow quest ids are SHADOW_QUEST_ID_BASE + Protocol day */
+#define SHADOW_QUEST_ID_BASE  100000
+
+/* Chance that a day has a shadow quest, per mille */
+#define SHADOW_DAILY_PERMILLE 150
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * ShadowRng — xoshiro256** state (never all zero)
+ */
+typedef struct {
+    uint64_t s[4];
+} ShadowRng;
+
+/*
+ * ShadowTemplate — A kind of shadow quest and how often it appears
+ */
+typedef struct {
+    const char *name;
+    const char *description;
+    uint32_t weight;        /* Relative frequency, 1..SHADOW_MAX_WEIGHT */
+    uint32_t xp;
+    HunterStats bonus;
+} ShadowTemplate;
+
+/*
+ * ShadowAlias — Alias table over a template set
+ *
+ * Column i keeps template i with probability prob[i] / 2^32 and
+ * template alias[i] otherwise.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t prob[SHADOW_MAX_TEMPLATES];
+    uint8_t alias[SHADOW_MAX_TEMPLATES];
+} ShadowAlias;
+
+/*
+ * ShadowSpawn — "A shadow quest from template T appears on day D"
+ */
+typedef struct {
+    uint16_t day;
+    uint8_t template_index;
+} ShadowSpawn;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * shadow_rng_seed — Start a generator for (seed, stream)
+ *
+ * Different streams of the same seed are independent sequences
+ * (use the Hunter index, the day, ...). The same pair always gives
+ * the same sequence.
+ */
+void shadow_rng_seed(ShadowRng *rng, uint64_t seed, uint64_t stream);
+
+/*
+ * shadow_rng_next — Next 64 random bits
+ */
+uint64_t shadow_rng_next(ShadowRng *rng);
+
+/*
+ * shadow_rng_below — Uniform number in [0, bound)
+ *
+ * Multiply-shift instead of %, which is slower and biased.
+ */
+uint32_t shadow_rng_below(ShadowRng *rng, uint32_t bound);
+
+/*
+ * shadow_alias_build — Build an alias table from template weights
+ *
+ * Returns:
+ *   0 on success
+ *  -1 if there are no templates, too many, or a weight is out of range
+ */
+int shadow_alias_build(ShadowAlias *a, const ShadowTemplate *templates,
+                       size_t count);
+
+/*
+ * shadow_alias_sample — Pick a template index, weighted
+ */
+uint32_t shadow_alias_sample(const ShadowAlias *a, ShadowRng *rng);
+
+/*
+ * shadow_templates — The built-in template set
+ *
+ * Parameters:
+ *   count — Receives the number of templates
+ */
+const ShadowTemplate *shadow_templates(size_t *count);
+
+/*
+ * shadow_hunter_seed — Stable seed for a Hunter
+ *
+ * Derived from the name and Protocol start, so it needs no extra
+ * field in the save file.
+ */
+uint64_t shadow_hunter_seed(const Hunter *h);
+
+/*
+ * shadow_spawn_days — Roll shadow quests for a range of days
+ *
+ * Uses one stream per day, so any single day gives the same result
+ * as shadow_spawn_today for that day.
+ *
+ * Parameters:
+ *   seed      — Hunter seed (shadow_hunter_seed)
+ *   a         — Template alias table
+ *   first_day — First Protocol day
+ *   last_day  — Last Protocol day (inclusive, clamped to UINT16_MAX)
+ *   permille  — Chance of a shadow quest on a day
+ *   out       — Receives one ShadowSpawn per day that has a quest
+ *   max       — Capacity of out
+ *
+ * Returns:
+ *   Number of spawns written
+ */
+size_t shadow_spawn_days(uint64_t seed, const ShadowAlias *a,
+                         uint32_t first_day, uint32_t last_day,
+                         uint32_t permille, ShadowSpawn *out, size_t max);
+
+/*
+ * shadow_spawn_today — Add today's shadow quest to the quest list
+ *
+ * Does nothing if today doesn't roll one or it's already in the list.
+ *
+ * Returns:
+ *   The new quest, or NULL if none was added
+ */
+Quest *shadow_spawn_today(QuestList *ql, const Hunter *h, uint32_t day);
+
+#endif /* SHADOW_H */
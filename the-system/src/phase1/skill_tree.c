@@ -0,0 +1,386 @@
+/*
+ * skill_tree.c — Skill Tree Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Building CSR arrays: count, prefix sum, fill
+ *   - Kahn's algorithm
+ *   - Worklists for incremental propagation
+ */
+
+#include <string.h>
+
+#include "skill_tree.h"
+
+/* quest_at value for "not looked up yet" */
+#define QUEST_UNRESOLVED  UINT32_MAX
+
+/*
+ * ============================================================================
+ * LEVELS
+ * ============================================================================
+ */
+
+uint32_t skill_xp_for_level(uint32_t level)
+{
+    return SKILL_LEVEL_COST * (level + 1);
+}
+
+/* XP to reach a level from 0: COST * (1 + 2 + ... + level) */
+static uint32_t xp_to_reach(uint32_t level)
+{
+    return SKILL_LEVEL_COST * level * (level + 1) / 2;
+}
+
+int skill_is_available(const SkillTree *t, uint32_t index)
+{
+    return t != NULL && index < t->count && t->unmet[index] == 0;
+}
+
+static int learned(const SkillTree *t, uint32_t i)
+{
+    return t->level[i] >= 1 || (t->max_level[i] == 0 && t->unmet[i] == 0);
+}
+
+int skill_is_learned(const SkillTree *t, uint32_t index)
+{
+    return t != NULL && index < t->count && learned(t, index);
+}
+
+/*
+ * ============================================================================
+ * LOOKUP
+ * ============================================================================
+ */
+
+int skill_find(const SkillTree *t, uint32_t id)
+{
+    uint32_t lo = 0, hi;
+
+    if (t == NULL) {
+        return -1;
+    }
+
+    hi = t->count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (t->by_id[mid] < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return (lo < t->count && t->by_id[lo] == id) ? (int)t->by_id_index[lo] : -1;
+}
+
+/*
+ * ============================================================================
+ * BUILDING
+ * ============================================================================
+ */
+
+/*
+ * sort_ids — Fill by_id / by_id_index (insertion sort: count <= 256)
+ *
+ * Returns:
+ *   0, or -1 on a duplicate id
+ */
+static int sort_ids(SkillTree *t)
+{
+    for (uint32_t i = 0; i < t->count; i++) {
+        uint32_t id = t->nodes[i].id;
+        uint32_t at = i;
+
+        while (at > 0 && t->by_id[at - 1] > id) {
+            t->by_id[at] = t->by_id[at - 1];
+            t->by_id_index[at] = t->by_id_index[at - 1];
+            at--;
+        }
+        if (at > 0 && t->by_id[at - 1] == id) {
+            return -1;
+        }
+        t->by_id[at] = id;
+        t->by_id_index[at] = (uint16_t)i;
+    }
+    return 0;
+}
+
+/*
+ * load_progress — Saved level and XP, made consistent with each other
+ */
+static void load_progress(SkillTree *t, uint32_t i)
+{
+    const SkillNode *n = &t->nodes[i];
+    uint32_t max = (n->max_level < SKILL_MAX_LEVEL) ? n->max_level : SKILL_MAX_LEVEL;
+    uint32_t level = (n->level < max) ? n->level : max;
+    uint32_t xp = n->xp_invested;
+
+    if (xp < xp_to_reach(level)) {
+        xp = xp_to_reach(level);
+    }
+    if (level < max && xp >= xp_to_reach(level + 1)) {
+        xp = xp_to_reach(level + 1) - 1;
+    }
+
+    t->max_level[i] = (uint8_t)max;
+    t->level[i] = (uint8_t)level;
+    t->xp_invested[i] = xp;
+    t->xp_to_next_level[i] = (level < max) ? xp_to_reach(level + 1) - xp : 0;
+}
+
+/*
+ * build_edges — Dependents and quest CSR arrays
+ *
+ * Returns:
+ *   0, or -1 on too many links or an unknown prerequisite
+ */
+static int build_edges(SkillTree *t)
+{
+    uint16_t fill[SKILL_MAX_NODES];
+
+    memset(t->dep_start, 0, sizeof(t->dep_start));
+
+    /* Count: node i is a dependent of each of its prerequisites */
+    for (uint32_t i = 0; i < t->count; i++) {
+        const SkillNode *n = &t->nodes[i];
+
+        if (n->prerequisite_count > SKILL_MAX_LINKS ||
+            n->unlocks_count > SKILL_MAX_LINKS) {
+            return -1;
+        }
+        for (uint32_t k = 0; k < n->prerequisite_count; k++) {
+            int p = skill_find(t, n->prerequisite_ids[k]);
+            if (p < 0) {
+                return -1;
+            }
+            t->dep_start[p + 1]++;
+        }
+    }
+
+    /* Prefix sum: counts become start offsets */
+    t->quest_start[0] = 0;
+    for (uint32_t i = 0; i < t->count; i++) {
+        t->dep_start[i + 1] += t->dep_start[i];
+        fill[i] = t->dep_start[i];
+        t->quest_start[i + 1] = (uint16_t)(t->quest_start[i] + t->nodes[i].unlocks_count);
+    }
+
+    /* Fill, in node order so each list is sorted */
+    for (uint32_t i = 0; i < t->count; i++) {
+        const SkillNode *n = &t->nodes[i];
+
+        for (uint32_t k = 0; k < n->prerequisite_count; k++) {
+            int p = skill_find(t, n->prerequisite_ids[k]);
+            t->dep[fill[p]++] = (uint16_t)i;
+        }
+        for (uint32_t k = 0; k < n->unlocks_count; k++) {
+            t->quest_id[t->quest_start[i] + k] = n->unlocks_quest_ids[k];
+            t->quest_at[t->quest_start[i] + k] = QUEST_UNRESOLVED;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * build_topo — Kahn's algorithm over the dependents lists
+ *
+ * Returns:
+ *   0, or -1 if some nodes never reach in-degree 0 (a cycle)
+ */
+static int build_topo(SkillTree *t)
+{
+    uint8_t indegree[SKILL_MAX_NODES];
+    uint32_t head = 0, tail = 0;
+
+    for (uint32_t i = 0; i < t->count; i++) {
+        indegree[i] = (uint8_t)t->nodes[i].prerequisite_count;
+        if (indegree[i] == 0) {
+            t->topo[tail++] = (uint16_t)i;
+        }
+    }
+
+    /* topo doubles as the queue: [head, tail) are ready, unprocessed */
+    while (head < tail) {
+        uint32_t n = t->topo[head++];
+        for (uint32_t e = t->dep_start[n]; e < t->dep_start[n + 1]; e++) {
+            if (--indegree[t->dep[e]] == 0) {
+                t->topo[tail++] = t->dep[e];
+            }
+        }
+    }
+
+    return (tail == t->count) ? 0 : -1;
+}
+
+int skill_tree_build(SkillTree *t, const SkillNode *nodes, size_t count)
+{
+    if (t == NULL || (nodes == NULL && count > 0) || count > SKILL_MAX_NODES) {
+        return -1;
+    }
+
+    t->count = (uint32_t)count;
+    t->nodes = nodes;
+
+    if (sort_ids(t) != 0 || build_edges(t) != 0 || build_topo(t) != 0) {
+        t->count = 0;
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < t->count; i++) {
+        load_progress(t, i);
+        t->unmet[i] = (uint8_t)nodes[i].prerequisite_count;
+    }
+
+    /*
+     * Unmet counts in topological order: by the time a node is reached,
+     * all its prerequisites have been, so its own count (and with it
+     * whether a milestone is learned) is final.
+     */
+    for (uint32_t k = 0; k < t->count; k++) {
+        uint32_t n = t->topo[k];
+        if (learned(t, n)) {
+            for (uint32_t e = t->dep_start[n]; e < t->dep_start[n + 1]; e++) {
+                t->unmet[t->dep[e]]--;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * ============================================================================
+ * UNLOCKING
+ * ============================================================================
+ */
+
+/*
+ * unlock_quest — Make quest edge e available if it's locked
+ *
+ * The QuestList slot is looked up once and cached. Slots never move
+ * while the list only grows; the id check catches a reloaded list.
+ *
+ * Returns:
+ *   1 if the quest went from LOCKED to AVAILABLE, else 0
+ */
+static int unlock_quest(SkillTree *t, uint32_t e, QuestList *ql)
+{
+    uint32_t at = t->quest_at[e];
+    Quest *q;
+
+    if (at < ql->count && ql->quests[at].id == t->quest_id[e]) {
+        q = &ql->quests[at];
+    } else {
+        q = questlist_find(ql, t->quest_id[e]);
+        if (q == NULL) {
+            return 0;
+        }
+        t->quest_at[e] = (uint32_t)(q - ql->quests);
+    }
+
+    if (q->status != QUEST_STATUS_LOCKED) {
+        return 0;
+    }
+    q->status = QUEST_STATUS_AVAILABLE;
+    return 1;
+}
+
+/*
+ * propagate — A node was just learned: follow the consequences
+ *
+ * Each node enters the worklist at most once (when it's learned), so
+ * the work is proportional to the nodes and edges actually affected.
+ */
+static void propagate(SkillTree *t, uint32_t start, QuestList *ql,
+                      SkillCascade *c)
+{
+    uint16_t stack[SKILL_MAX_NODES];
+    uint32_t top = 0;
+
+    stack[top++] = (uint16_t)start;
+
+    while (top > 0) {
+        uint32_t n = stack[--top];
+
+        if (ql != NULL) {
+            for (uint32_t e = t->quest_start[n]; e < t->quest_start[n + 1]; e++) {
+                c->quests_unlocked += (uint32_t)unlock_quest(t, e, ql);
+            }
+        }
+
+        for (uint32_t e = t->dep_start[n]; e < t->dep_start[n + 1]; e++) {
+            uint32_t d = t->dep[e];
+            if (--t->unmet[d] != 0) {
+                continue;
+            }
+            c->skills_available++;
+            if (t->max_level[d] == 0) {
+                stack[top++] = (uint16_t)d;     /* Milestone: learned now */
+            }
+        }
+    }
+}
+
+int64_t skill_invest(SkillTree *t, uint32_t index, uint32_t xp,
+                     QuestList *ql, SkillCascade *cascade)
+{
+    SkillCascade local = {0, 0, 0};
+    SkillCascade *c = (cascade != NULL) ? cascade : &local;
+    uint32_t used = 0;
+    int was_learned;
+
+    memset(c, 0, sizeof(*c));
+
+    if (t == NULL || index >= t->count || t->unmet[index] != 0 ||
+        t->level[index] >= t->max_level[index]) {
+        return -1;
+    }
+
+    was_learned = learned(t, index);
+
+    while (xp > 0 && t->level[index] < t->max_level[index]) {
+        uint32_t take = (xp < t->xp_to_next_level[index]) ? xp : t->xp_to_next_level[index];
+
+        xp -= take;
+        used += take;
+        t->xp_invested[index] += take;
+        t->xp_to_next_level[index] -= take;
+
+        if (t->xp_to_next_level[index] == 0) {
+            t->level[index]++;
+            c->levels_gained++;
+            t->xp_to_next_level[index] = (t->level[index] < t->max_level[index])
+                                         ? skill_xp_for_level(t->level[index]) : 0;
+        }
+    }
+
+    if (!was_learned && learned(t, index)) {
+        propagate(t, index, ql, c);
+    }
+
+    return used;
+}
+
+uint32_t skill_tree_sync_quests(SkillTree *t, QuestList *ql)
+{
+    uint32_t unlocked = 0;
+
+    if (t == NULL || ql == NULL) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < t->count; i++) {
+        if (!learned(t, i)) {
+            continue;
+        }
+        for (uint32_t e = t->quest_start[i]; e < t->quest_start[i + 1]; e++) {
+            unlocked += (uint32_t)unlock_quest(t, e, ql);
+        }
+    }
+
+    return unlocked;
+}
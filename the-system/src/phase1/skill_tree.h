@@ -0,0 +1,241 @@
+/*
+ * skill_tree.h — The Web of Knowledge
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Skills depend on other skills: Pointers needs C Basics, CUDA needs
+ * Pointers and Parallelism. Learning a skill (reaching level 1) can make
+ * new skills available and unlock quests.
+ *
+ * Skills are written as SkillNode records (ARCHITECTURE.md §4), each
+ * with up to 8 prerequisite ids and 8 quest ids. That's a good format
+ * to author and save, and a poor one to run: "who depends on me?" means
+ * scanning every node's prerequisite list.
+ *
+ * skill_tree_build() compiles the records once into a SkillTree:
+ *
+ *   Dense per-node arrays     level[], xp_to_next_level[], unmet[] ...
+ *                             indexed 0..count-1, ids looked up once
+ *
+ *   CSR adjacency             dependents of node i are
+ *   (compressed sparse row)   dep[dep_start[i] .. dep_start[i + 1])
+ *
+ *     dep_start  [0  2  3  3  5 ...]
+ *     dep        [1  4 |2 |  |5  6 |...]     one flat array, no gaps
+ *
+ *   Topological order         prerequisites always before dependents;
+ *                             building it also proves there's no cycle
+ *
+ *   Unmet counts              unmet[i] = prerequisites of i not learned;
+ *                             i is available when it reaches 0
+ *
+ * Learning a skill then touches only what it affects: decrement each
+ * dependent's count, unlock its own quests. MILESTONE nodes (max_level
+ * 0) count as learned the moment they're available, so one level-up can
+ * cascade down a chain of them. The cascade is a worklist over the
+ * affected nodes, never a rescan of the whole tree.
+ *
+ * Not connected yet: nothing in the game builds a tree or calls
+ * skill_invest (only bench.c does), and skill progress isn't saved.
+ * The Hunter XP per skill level from ARCHITECTURE.md §5.1 belongs to
+ * that wiring, as events (event.h), not to this module.
+ *
+ * Learning Focus:
+ *   - Graphs in flat arrays (CSR)
+ *   - Topological sort (Kahn's algorithm)
+ *   - Incremental updates instead of recomputation
+ */
+
+#ifndef SKILL_TREE_H
+#define SKILL_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "quest.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Maximum skills in one tree (indices fit in uint16_t) */
+#define SKILL_MAX_NODES     256
+
+/* Prerequisites / unlocked quests per SkillNode */
+#define SKILL_MAX_LINKS     8
+
+/* Highest level a skill can have */
+#define SKILL_MAX_LEVEL     5
+
+/* XP to go from level L to L + 1 is SKILL_LEVEL_COST * (L + 1) */
+#define SKILL_LEVEL_COST    100
+
+/*
+ * ============================================================================
+ * ENUMERATIONS
+ * ============================================================================
+ */
+
+typedef enum {
+    SKILL_DOMAIN_C,
+    SKILL_DOMAIN_ARCHITECTURE,
+    SKILL_DOMAIN_LINUX,
+    SKILL_DOMAIN_GPU,
+    SKILL_DOMAIN_SECURITY,
+    SKILL_DOMAIN_TOOLING
+} SkillDomain;
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * SkillNode — One skill as authored (and saved)
+ *
+ * level and xp_invested are the saved progress; skill_tree_build reads
+ * them back. xp_to_next_level is derived and ignored on input.
+ */
+typedef struct SkillNode {
+    unsigned int id;
+    char name[64];
+    char description[256];
+
+    SkillDomain domain;
+    unsigned int level;          /* 0-5, where 5 is mastery */
+    unsigned int max_level;      /* 0 = milestone, learned when available */
+
+    unsigned int xp_invested;
+    unsigned int xp_to_next_level;
+
+    /* Dependencies */
+    unsigned int prerequisite_ids[SKILL_MAX_LINKS];
+    unsigned int prerequisite_count;
+
+    /* Unlocks */
+    unsigned int unlocks_quest_ids[SKILL_MAX_LINKS];
+    unsigned int unlocks_count;
+} SkillNode;
+
+/*
+ * SkillTree — Compiled skill graph and per-node progress
+ *
+ * Everything is indexed by node index (position in the SkillNode array
+ * given to skill_tree_build), not by id.
+ */
+typedef struct {
+    uint32_t count;
+    const SkillNode *nodes;                      /* Names, descriptions */
+
+    /* Hot per-node state */
+    uint8_t level[SKILL_MAX_NODES];
+    uint8_t max_level[SKILL_MAX_NODES];
+    uint8_t unmet[SKILL_MAX_NODES];              /* Prerequisites not learned */
+    uint32_t xp_invested[SKILL_MAX_NODES];       /* Total, all levels */
+    uint32_t xp_to_next_level[SKILL_MAX_NODES];  /* 0 at max level */
+
+    /* Dependents (reverse prerequisite edges), CSR */
+    uint16_t dep_start[SKILL_MAX_NODES + 1];
+    uint16_t dep[SKILL_MAX_NODES * SKILL_MAX_LINKS];
+
+    /* Quests unlocked per node, CSR; quest_at caches the QuestList slot */
+    uint16_t quest_start[SKILL_MAX_NODES + 1];
+    uint32_t quest_id[SKILL_MAX_NODES * SKILL_MAX_LINKS];
+    uint32_t quest_at[SKILL_MAX_NODES * SKILL_MAX_LINKS];
+
+    /* Prerequisites before dependents */
+    uint16_t topo[SKILL_MAX_NODES];
+
+    /* Ids in ascending order with their node index, for skill_find */
+    uint32_t by_id[SKILL_MAX_NODES];
+    uint16_t by_id_index[SKILL_MAX_NODES];
+} SkillTree;
+
+/*
+ * SkillCascade — What one investment set off
+ */
+typedef struct {
+    uint32_t levels_gained;
+    uint32_t skills_available;                   /* Newly available skills */
+    uint32_t quests_unlocked;                    /* LOCKED → AVAILABLE */
+} SkillCascade;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * skill_tree_build — Compile SkillNode records into a tree
+ *
+ * The nodes array must outlive the tree (names are not copied).
+ * Saved levels are clamped to max_level and xp_to_next_level is
+ * recomputed. Quests are not touched; call skill_tree_sync_quests
+ * after loading a save.
+ *
+ * Returns:
+ *   0 on success
+ *  -1 on too many nodes or links, a duplicate id, an unknown
+ *     prerequisite, or a cycle
+ */
+int skill_tree_build(SkillTree *t, const SkillNode *nodes, size_t count);
+
+/*
+ * skill_find — Node index for a skill id
+ *
+ * Returns:
+ *   Index, or -1 if there's no such skill
+ */
+int skill_find(const SkillTree *t, uint32_t id);
+
+/*
+ * skill_xp_for_level — XP to go from level to level + 1
+ */
+uint32_t skill_xp_for_level(uint32_t level);
+
+/*
+ * skill_is_available — All prerequisites learned?
+ */
+int skill_is_available(const SkillTree *t, uint32_t index);
+
+/*
+ * skill_is_learned — Level 1 or more (or an available milestone)?
+ */
+int skill_is_learned(const SkillTree *t, uint32_t index);
+
+/*
+ * skill_invest — Put XP into a skill
+ *
+ * May gain several levels. The first level learns the skill: its
+ * quests unlock and dependents whose last prerequisite it was become
+ * available, cascading through milestones. XP past max level is not
+ * taken.
+ *
+ * Parameters:
+ *   t       — Skill tree
+ *   index   — Node to invest in
+ *   xp      — XP to invest
+ *   ql      — Quest list to unlock into (may be NULL)
+ *   cascade — Receives what happened, zeroed on error (may be NULL)
+ *
+ * Returns:
+ *   XP actually used
+ *  -1 if the node is invalid, unavailable or already mastered
+ */
+int64_t skill_invest(SkillTree *t, uint32_t index, uint32_t xp,
+                     QuestList *ql, SkillCascade *cascade);
+
+/*
+ * skill_tree_sync_quests — Unlock the quests of every learned skill
+ *
+ * Returns:
+ *   Number of quests moved from LOCKED to AVAILABLE
+ */
+uint32_t skill_tree_sync_quests(SkillTree *t, QuestList *ql);
+
+#endif /* SKILL_TREE_H */
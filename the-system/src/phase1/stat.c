@@ -0,0 +1,224 @@
+/*
+ * stat.c — Stat Growth Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Detecting signed overflow without causing it
+ *   - Branch-free select with SSE2 masks
+ */
+
+#include <stdint.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "stat.h"
+#include "progression.h"
+
+/*
+ * ============================================================================
+ * FIELD ACCESS
+ * ============================================================================
+ */
+
+int stat_get(const HunterStats *s, StatId id)
+{
+    if (s == NULL) {
+        return 0;
+    }
+
+    switch (id) {
+    case STAT_STR: return s->strength;
+    case STAT_INT: return s->intelligence;
+    case STAT_SYS: return s->systems;
+    case STAT_GPU: return s->gpu;
+    case STAT_SEC: return s->security;
+    case STAT_END: return s->endurance;
+    case STAT_COUNT: break;
+    }
+    return 0;
+}
+
+void stat_set(HunterStats *s, StatId id, int value)
+{
+    if (s == NULL) {
+        return;
+    }
+
+    switch (id) {
+    case STAT_STR: s->strength = value; break;
+    case STAT_INT: s->intelligence = value; break;
+    case STAT_SYS: s->systems = value; break;
+    case STAT_GPU: s->gpu = value; break;
+    case STAT_SEC: s->security = value; break;
+    case STAT_END: s->endurance = value; break;
+    case STAT_COUNT: break;
+    }
+}
+
+/*
+ * ============================================================================
+ * SCALAR
+ * ============================================================================
+ */
+
+int32_t stat_saturating_add(int32_t a, int32_t b)
+{
+    /* checked_add's tests: compare against the room left, never overflow */
+    if (b > 0 && a > INT32_MAX - b) {
+        return INT32_MAX;
+    }
+    if (b < 0 && a < INT32_MIN - b) {
+        return INT32_MIN;
+    }
+    return a + b;
+}
+
+static int32_t clamp(int32_t v, int32_t lo, int32_t hi)
+{
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+/*
+ * gain_fixed — A positive bonus after diminishing returns, in 16.16
+ *
+ * Below the knee a point is a point. Above it the bonus is scaled by
+ * knee / current. 64-bit intermediates: bonus << 16 alone can need
+ * 47 bits.
+ */
+static int64_t gain_fixed(int32_t current, int32_t bonus, int32_t knee)
+{
+    int64_t gain = (int64_t)bonus << STAT_FRAC_BITS;
+
+    if (knee > 0 && current > knee) {
+        gain = gain * knee / current;
+    }
+
+    return gain;
+}
+
+void stat_apply(Hunter *h, const HunterStats *bonus)
+{
+    const Progression *p = progression_get();
+
+    if (h == NULL || bonus == NULL) {
+        return;
+    }
+
+    for (int s = 0; s < STAT_COUNT; s++) {
+        int32_t current = stat_get(&h->stats, (StatId)s);
+        int32_t b = stat_get(bonus, (StatId)s);
+        int32_t next;
+
+        if (b > 0) {
+            int64_t total = gain_fixed(current, b, p->stat_knee[s]) + h->stat_frac[s];
+            int64_t whole = total >> STAT_FRAC_BITS;
+
+            h->stat_frac[s] = (uint16_t)(total & (STAT_ONE - 1));
+            next = stat_saturating_add(current,
+                                       (whole > INT32_MAX) ? INT32_MAX : (int32_t)whole);
+        } else {
+            next = stat_saturating_add(current, b);
+        }
+
+        next = clamp(next, STAT_MIN, p->stat_cap[s]);
+        if (next >= p->stat_cap[s]) {
+            h->stat_frac[s] = 0;    /* Nothing left to round up to */
+        }
+        stat_set(&h->stats, (StatId)s, next);
+    }
+}
+
+/*
+ * ============================================================================
+ * BULK (SSE2)
+ * ============================================================================
+ *
+ * Signed a + b overflows exactly when a and b have the same sign and
+ * the wrapped sum has the other sign:
+ *
+ *   overflow = ~(a ^ b) & (a ^ sum)          (sign bit)
+ *
+ * The saturated value depends only on a's sign: INT32_MAX if a >= 0,
+ * INT32_MIN if a < 0, i.e. (a >> 31) ^ INT32_MAX. Masks from arithmetic
+ * shifts and compares then select between the candidates.
+ */
+
+#if defined(__SSE2__)
+
+static __m128i select_si128(__m128i mask, __m128i yes, __m128i no)
+{
+    return _mm_or_si128(_mm_and_si128(mask, yes), _mm_andnot_si128(mask, no));
+}
+
+static __m128i add_sat_clamp(__m128i a, __m128i b, __m128i lo, __m128i hi)
+{
+    __m128i sum = _mm_add_epi32(a, b);
+    __m128i ovf = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(a, b),
+                                                  _mm_xor_si128(a, sum)), 31);
+    __m128i sat = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX));
+
+    sum = select_si128(ovf, sat, sum);
+    sum = select_si128(_mm_cmpgt_epi32(sum, hi), hi, sum);
+    sum = select_si128(_mm_cmplt_epi32(sum, lo), lo, sum);
+    return sum;
+}
+
+#endif
+
+void stat_add_column(int32_t *values, size_t n, int32_t delta,
+                     int32_t lo, int32_t hi)
+{
+    size_t i = 0;
+
+    if (values == NULL) {
+        return;
+    }
+
+#if defined(__SSE2__)
+    {
+        __m128i d = _mm_set1_epi32(delta);
+        __m128i vlo = _mm_set1_epi32(lo);
+        __m128i vhi = _mm_set1_epi32(hi);
+
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+            _mm_storeu_si128((__m128i *)(values + i), add_sat_clamp(v, d, vlo, vhi));
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        values[i] = clamp(stat_saturating_add(values[i], delta), lo, hi);
+    }
+}
+
+void stat_add_columns(int32_t *values, const int32_t *deltas, size_t n,
+                      int32_t lo, int32_t hi)
+{
+    size_t i = 0;
+
+    if (values == NULL || deltas == NULL) {
+        return;
+    }
+
+#if defined(__SSE2__)
+    {
+        __m128i vlo = _mm_set1_epi32(lo);
+        __m128i vhi = _mm_set1_epi32(hi);
+
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+            __m128i d = _mm_loadu_si128((const __m128i *)(deltas + i));
+            _mm_storeu_si128((__m128i *)(values + i), add_sat_clamp(v, d, vlo, vhi));
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        values[i] = clamp(stat_saturating_add(values[i], deltas[i]), lo, hi);
+    }
+}
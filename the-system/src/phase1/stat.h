@@ -0,0 +1,119 @@
+/*
+ * stat.h — Stat Growth: Caps, Diminishing Returns, Saturation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Three rules keep stats meaningful:
+ *
+ *   1. CAPS          a stat never exceeds cap.<stat> (progression.cfg)
+ *   2. DIMINISHING   above knee.<stat>, each point is harder to get:
+ *      RETURNS       gain = bonus * knee / current
+ *
+ *                    current   50  100  200  300
+ *                    +2 gives   2    2    1  0.67
+ *
+ *   3. NO OVERFLOW   additions saturate instead of wrapping, so a bad
+ *                    rebalance can't turn 2 billion STR into -2 billion
+ *
+ * Fractions matter for rule 2: +2 at 300 is 0.67 of a point. The
+ * leftover is kept per stat in 16.16 FIXED POINT (Hunter.stat_frac), so
+ * three such quests add up to about 2 points instead of rounding to 0 each
+ * time. Integer math only; same result on every machine.
+ *
+ * Bulk updates over a roster (rebalances, events) use the same
+ * saturating add four lanes at a time with SSE2. SSE2 has saturating
+ * adds for 8- and 16-bit lanes only, so the 32-bit version detects
+ * overflow the way checked_add() does in day-09-defensive — from the
+ * signs of the operands — but on whole vectors, without branches.
+ *
+ * Learning Focus:
+ *   - Fixed-point arithmetic
+ *   - Overflow-safe addition (scalar and SIMD)
+ *   - Saturation vs wrapping
+ */
+
+#ifndef STAT_H
+#define STAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hunter.h"
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Fractional bits in a fixed-point stat gain */
+#define STAT_FRAC_BITS  16
+#define STAT_ONE        (1 << STAT_FRAC_BITS)
+
+/* Lowest value a stat can fall to */
+#define STAT_MIN        0
+
+/*
+ * ============================================================================
+ * ENUMERATIONS
+ * ============================================================================
+ */
+
+typedef enum {
+    STAT_STR = 0,
+    STAT_INT = 1,
+    STAT_SYS = 2,
+    STAT_GPU = 3,
+    STAT_SEC = 4,
+    STAT_END = 5,
+    STAT_COUNT = 6
+} StatId;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * stat_get / stat_set — Access a HunterStats field by StatId
+ */
+int stat_get(const HunterStats *s, StatId id);
+void stat_set(HunterStats *s, StatId id, int value);
+
+/*
+ * stat_saturating_add — a + b, clamped to [INT32_MIN, INT32_MAX]
+ *
+ * Same overflow tests as checked_add(), but saturates instead of
+ * reporting an error.
+ */
+int32_t stat_saturating_add(int32_t a, int32_t b);
+
+/*
+ * stat_apply — Add a quest's stat bonus to a Hunter
+ *
+ * Positive bonuses go through diminishing returns (keeping the
+ * fraction in h->stat_frac); negative ones apply in full. Results are
+ * clamped to [STAT_MIN, cap].
+ */
+void stat_apply(Hunter *h, const HunterStats *bonus);
+
+/*
+ * stat_add_column — Add the same delta to n stat values
+ *
+ * For a roster's stat column: saturating add, then clamp to [lo, hi].
+ * Vectorized with SSE2 where available.
+ */
+void stat_add_column(int32_t *values, size_t n, int32_t delta,
+                     int32_t lo, int32_t hi);
+
+/*
+ * stat_add_columns — Add per-value deltas (values[i] += deltas[i])
+ *
+ * Same saturation and clamping as stat_add_column.
+ */
+void stat_add_columns(int32_t *values, const int32_t *deltas, size_t n,
+                      int32_t lo, int32_t hi);
+
+#endif /* STAT_H */
@@ -0,0 +1,372 @@
+/*
+ * streak.c — Calendar Days and Activity Streaks Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Converting broken-down time back to a day count
+ *   - Direct-mapped caches
+ *   - Bit tricks over multi-word bitmaps
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <string.h>
+#include <time.h>
+
+#include "streak.h"
+
+/*
+ * ============================================================================
+ * BIT COUNTING
+ * ============================================================================
+ *
+ * GCC and Clang turn these builtins into single instructions where the
+ * CPU has them (POPCNT, LZCNT/BSR, TZCNT/BSF). The fallbacks keep the
+ * code portable. clz64/ctz64 return 64 for 0 (the builtins are undefined
+ * there).
+ */
+
+static uint32_t popcount64(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (uint32_t)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+static uint32_t clz64(uint64_t x)
+{
+    if (x == 0) {
+        return 64;
+    }
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_clzll(x);
+#else
+    {
+        uint32_t n = 0;
+        while (!(x & 0x8000000000000000ull)) {
+            x <<= 1;
+            n++;
+        }
+        return n;
+    }
+#endif
+}
+
+static uint32_t ctz64(uint64_t x)
+{
+    if (x == 0) {
+        return 64;
+    }
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctzll(x);
+#else
+    {
+        uint32_t n = 0;
+        while (!(x & 1)) {
+            x >>= 1;
+            n++;
+        }
+        return n;
+    }
+#endif
+}
+
+/*
+ * ============================================================================
+ * LOCAL DAYS
+ * ============================================================================
+ */
+
+#define SECONDS_PER_DAY     86400
+#define OFFSET_BUCKET       900     /* 15 minutes */
+#define OFFSET_CACHE_SLOTS  64      /* 16 hours of distinct buckets */
+
+typedef struct {
+    int64_t bucket;
+    int32_t offset;                 /* Local time minus UTC, seconds */
+    int valid;
+} OffsetEntry;
+
+static OffsetEntry g_offsets[OFFSET_CACHE_SLOTS];
+static int g_tz_loaded = 0;
+
+/*
+ * floor_div — Division rounding toward minus infinity
+ *
+ * C rounds toward zero, which puts -1 s and +1 s in the same day.
+ */
+static int64_t floor_div(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+/*
+ * days_from_civil — Days since 1970-01-01 for a proleptic Gregorian date
+ *
+ * Howard Hinnant's algorithm: shift the year to start in March so the
+ * leap day is last, then count whole 400-year eras.
+ */
+static int64_t days_from_civil(int64_t y, int m, int d)
+{
+    int64_t era;
+    int64_t yoe, doy, doe;
+
+    y -= (m <= 2);
+    era = floor_div(y, 400);
+    yoe = y - era * 400;
+    doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/*
+ * utc_offset — Local offset from UTC at a given instant (cached)
+ */
+static int32_t utc_offset(time_t when)
+{
+    int64_t bucket = floor_div((int64_t)when, OFFSET_BUCKET);
+    OffsetEntry *e = &g_offsets[(uint64_t)bucket % OFFSET_CACHE_SLOTS];
+    struct tm tm;
+    int64_t local;
+
+    if (e->valid && e->bucket == bucket) {
+        return e->offset;
+    }
+
+    if (!g_tz_loaded) {
+        tzset();
+        g_tz_loaded = 1;
+    }
+
+    /* Offsets only change on quarter hours: any instant in the bucket will do */
+    if (localtime_r(&when, &tm) == NULL) {
+        return 0;
+    }
+
+    local = days_from_civil((int64_t)tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday)
+            * SECONDS_PER_DAY
+            + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+
+    e->bucket = bucket;
+    e->offset = (int32_t)(local - (int64_t)when);
+    e->valid = 1;
+    return e->offset;
+}
+
+int32_t streak_local_day(time_t when)
+{
+    return (int32_t)floor_div((int64_t)when + utc_offset(when), SECONDS_PER_DAY);
+}
+
+uint32_t streak_protocol_day(time_t protocol_start, time_t when)
+{
+    int32_t start = streak_local_day(protocol_start);
+    int32_t day = streak_local_day(when);
+
+    if (day < start) {
+        return 1;
+    }
+
+    return (uint32_t)(day - start) + 1;
+}
+
+/*
+ * ============================================================================
+ * ACTIVITY BITMAP
+ * ============================================================================
+ */
+
+void activity_init(ActivityMap *map)
+{
+    if (map == NULL) {
+        return;
+    }
+
+    memset(map, 0, sizeof(*map));
+    map->first_day = 1;
+}
+
+/*
+ * slide — Move the window so that `day` falls inside it
+ */
+static void slide(ActivityMap *map, uint32_t day)
+{
+    uint32_t words = (day - map->first_day - STREAK_DAYS) / 64 + 1;
+
+    if (words >= STREAK_WORDS) {
+        memset(map->bits, 0, sizeof(map->bits));
+    } else {
+        memmove(map->bits, map->bits + words,
+                (STREAK_WORDS - words) * sizeof(map->bits[0]));
+        memset(map->bits + (STREAK_WORDS - words), 0,
+               words * sizeof(map->bits[0]));
+    }
+
+    map->first_day += words * 64;
+}
+
+int activity_mark(ActivityMap *map, uint32_t day)
+{
+    uint32_t pos;
+    uint64_t bit;
+
+    if (map == NULL || day < map->first_day) {
+        return 0;
+    }
+
+    if (day - map->first_day >= STREAK_DAYS) {
+        slide(map, day);
+    }
+
+    pos = day - map->first_day;
+    bit = 1ull << (pos & 63);
+
+    if (day > map->last_day) {
+        map->last_day = day;
+    }
+
+    if (map->bits[pos >> 6] & bit) {
+        return 0;
+    }
+
+    map->bits[pos >> 6] |= bit;
+    return 1;
+}
+
+int activity_is_active(const ActivityMap *map, uint32_t day)
+{
+    uint32_t pos;
+
+    if (map == NULL || day < map->first_day ||
+        day - map->first_day >= STREAK_DAYS) {
+        return 0;
+    }
+
+    pos = day - map->first_day;
+    return (int)((map->bits[pos >> 6] >> (pos & 63)) & 1);
+}
+
+uint32_t activity_current_streak(const ActivityMap *map, uint32_t today)
+{
+    uint32_t end, pos, run = 0;
+    int w, b;
+    uint64_t x;
+
+    if (map == NULL) {
+        return 0;
+    }
+
+    end = activity_is_active(map, today) ? today : today - 1;
+    if (today == 0 || !activity_is_active(map, end)) {
+        return 0;
+    }
+
+    /*
+     * Put the end day in the top bit of the inverted word: the leading
+     * zeros are the active days counting back from it. Bits shifted in
+     * at the bottom are zeros too, so an all-zero result means the run
+     * continues into the previous word.
+     */
+    pos = end - map->first_day;
+    w = (int)(pos >> 6);
+    b = (int)(pos & 63);
+    x = ~map->bits[w] << (63 - b);
+
+    for (;;) {
+        if (x != 0) {
+            return run + clz64(x);
+        }
+        run += (uint32_t)b + 1;
+        if (--w < 0) {
+            return run;
+        }
+        b = 63;
+        x = ~map->bits[w];
+    }
+}
+
+uint32_t activity_longest_streak(const ActivityMap *map)
+{
+    uint32_t best = 0, cur = 0;
+
+    if (map == NULL) {
+        return 0;
+    }
+
+    /* Walk runs oldest day first; cur carries a run across words */
+    for (int w = 0; w < STREAK_WORDS; w++) {
+        uint64_t x = map->bits[w];
+        uint32_t left = 64;
+
+        while (left > 0) {
+            if (x & 1) {
+                uint32_t ones = ctz64(~x);
+                if (ones >= left) {
+                    cur += left;
+                    break;
+                }
+                cur += ones;
+                x >>= ones;
+                left -= ones;
+            } else {
+                uint32_t zeros = ctz64(x);
+                if (cur > best) {
+                    best = cur;
+                }
+                cur = 0;
+                if (zeros >= left) {
+                    break;
+                }
+                x >>= zeros;
+                left -= zeros;
+            }
+        }
+    }
+
+    return (cur > best) ? cur : best;
+}
+
+uint32_t activity_count(const ActivityMap *map, uint32_t first, uint32_t last)
+{
+    uint32_t lo, hi, count = 0;
+    uint32_t window_last;
+
+    if (map == NULL) {
+        return 0;
+    }
+
+    window_last = map->first_day + STREAK_DAYS - 1;
+    if (first < map->first_day) {
+        first = map->first_day;
+    }
+    if (last > window_last) {
+        last = window_last;
+    }
+    if (first > last) {
+        return 0;
+    }
+
+    lo = first - map->first_day;
+    hi = last - map->first_day;
+
+    for (uint32_t w = lo >> 6; w <= hi >> 6; w++) {
+        uint64_t word = map->bits[w];
+        if (w == lo >> 6) {
+            word &= ~0ull << (lo & 63);
+        }
+        if (w == hi >> 6) {
+            word &= ~0ull >> (63 - (hi & 63));
+        }
+        count += popcount64(word);
+    }
+
+    return count;
+}
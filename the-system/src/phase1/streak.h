@@ -0,0 +1,149 @@
+/*
+ * streak.h — Calendar Days and Activity Streaks
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * A streak counts CALENDAR days in the Hunter's own time zone, not
+ * 24-hour windows:
+ *
+ *   23:59 Monday, 00:01 Tuesday   → two days, streak +1
+ *   08:00 Monday, 22:00 Tuesday   → two days, streak +1 (38 hours apart)
+ *   the night clocks go forward   → still just the next day
+ *
+ * Timestamps become LOCAL DAY NUMBERS (days since 1970-01-01 on the
+ * local calendar). That needs the UTC offset in effect at the time,
+ * which normally means a localtime() call. Offsets only change at DST
+ * transitions, so they are cached per 15-minute bucket of UTC time
+ * (every real-world transition happens on a quarter hour): a streak
+ * update or day lookup is a divide and a table hit.
+ *
+ * Activity itself is a bitmap, one bit per Protocol day:
+ *
+ *   day:     1 2 3 4 5 6 7 8 9 ...
+ *   active:  1 1 0 1 1 1 0 1 1 ...
+ *
+ *   current streak   run of 1s ending today (or yesterday)   CLZ
+ *   longest streak   longest run of 1s                       CTZ
+ *   days active      1s between two days                     POPCOUNT
+ *
+ * 256 bits cover the 210-day Protocol with room to spare. Past that the
+ * window slides forward 64 days at a time.
+ *
+ * Learning Focus:
+ *   - Calendar math without localtime() in the hot path
+ *   - Bitmaps as sets of days
+ *   - Bit-counting instructions (popcount, clz, ctz)
+ */
+
+#ifndef STREAK_H
+#define STREAK_H
+
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* 64-bit words in an activity bitmap */
+#define STREAK_WORDS  4
+
+/* Days covered by one bitmap window */
+#define STREAK_DAYS   (STREAK_WORDS * 64)
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * ActivityMap — Which Protocol days had activity
+ *
+ * Bit (day - first_day) of bits[] is set if the Hunter was active
+ * on that day. first_day starts at 1 and only moves in steps of 64.
+ */
+typedef struct {
+    uint32_t first_day;                  /* Protocol day of bit 0 */
+    uint32_t last_day;                   /* Latest day marked (0 = none) */
+    uint64_t bits[STREAK_WORDS];
+} ActivityMap;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * streak_local_day — Local calendar day number of a timestamp
+ *
+ * Days since 1970-01-01 in the local time zone ($TZ). Uses the cached
+ * UTC offset; localtime() runs only for a 15-minute bucket not seen
+ * before.
+ */
+int32_t streak_local_day(time_t when);
+
+/*
+ * streak_protocol_day — Protocol day (1-based) of a timestamp
+ *
+ * Day 1 is the local calendar day the Protocol started on.
+ *
+ * Returns:
+ *   1 or more (timestamps before the start count as day 1)
+ */
+uint32_t streak_protocol_day(time_t protocol_start, time_t when);
+
+/*
+ * activity_init — Start with no active days
+ */
+void activity_init(ActivityMap *map);
+
+/*
+ * activity_mark — Record activity on a Protocol day
+ *
+ * Marking a day past the window slides it forward; days that fall
+ * out of the window are forgotten. Days before the window are ignored.
+ *
+ * Returns:
+ *   1 if the day was newly marked
+ *   0 if it was already marked (or ignored)
+ */
+int activity_mark(ActivityMap *map, uint32_t day);
+
+/*
+ * activity_is_active — Was the Hunter active on a day?
+ */
+int activity_is_active(const ActivityMap *map, uint32_t day);
+
+/*
+ * activity_current_streak — Consecutive active days up to today
+ *
+ * A streak stays alive until the end of the day after the last
+ * activity: if today isn't marked yet, the run ending yesterday counts.
+ *
+ * Parameters:
+ *   map   — Activity bitmap
+ *   today — Current Protocol day
+ *
+ * Returns:
+ *   Streak length in days (0 if neither today nor yesterday is active)
+ */
+uint32_t activity_current_streak(const ActivityMap *map, uint32_t today);
+
+/*
+ * activity_longest_streak — Longest run of active days in the window
+ */
+uint32_t activity_longest_streak(const ActivityMap *map);
+
+/*
+ * activity_count — Active days in [first, last] (inclusive)
+ *
+ * "Days active this season" is activity_count(map, 61, 105).
+ */
+uint32_t activity_count(const ActivityMap *map, uint32_t first, uint32_t last);
+
+#endif /* STREAK_H */
@@ -0,0 +1,204 @@
+/*
+ * term.c — Terminal Capabilities and Attribute State Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Building a small output string instead of many printf calls
+ *   - Choosing the shorter of two encodings
+ *   - Feature test macros (isatty is POSIX, not C99)
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "term.h"
+
+/*
+ * ============================================================================
+ * STATE
+ * ============================================================================
+ */
+
+static int g_initialized = 0;
+static int g_is_tty = 0;
+static int g_color = 0;
+static TermAttr g_current = TERM_PLAIN;
+
+void term_init(void)
+{
+    const char *term;
+    const char *no_color;
+
+    g_initialized = 1;
+    g_current = TERM_PLAIN;
+
+    g_is_tty = isatty(fileno(stdout));
+
+    term = getenv("TERM");
+    no_color = getenv("NO_COLOR");   /* https://no-color.org */
+
+    g_color = g_is_tty &&
+              term != NULL && strcmp(term, "dumb") != 0 &&
+              (no_color == NULL || no_color[0] == '\0');
+}
+
+int term_is_tty(void)
+{
+    if (!g_initialized) {
+        term_init();
+    }
+    return g_is_tty;
+}
+
+int term_color_enabled(void)
+{
+    if (!g_initialized) {
+        term_init();
+    }
+    return g_color;
+}
+
+void term_set_color(int enabled)
+{
+    if (!g_initialized) {
+        term_init();
+    }
+
+    /* Don't leave the terminal colored when switching off */
+    if (!enabled) {
+        term_reset();
+    }
+    g_color = enabled;
+}
+
+/*
+ * ============================================================================
+ * SGR ENCODING
+ * ============================================================================
+ *
+ * SGR = "Select Graphic Rendition": ESC [ p1 ; p2 ; ... m
+ *
+ *   0      reset everything
+ *   1 / 2  bold / dim        22  neither bold nor dim
+ *   4      underline         24  no underline
+ *   30-37  foreground        39  default foreground
+ *
+ * There is no code for "bold off, dim stays", so dropping one of
+ * them means 22 followed by re-adding the other.
+ */
+
+typedef struct {
+    char buf[32];
+    size_t len;
+} SgrBuf;
+
+static void sgr_add(SgrBuf *s, unsigned int param)
+{
+    int n = snprintf(s->buf + s->len, sizeof(s->buf) - s->len,
+                     s->len == 0 ? "%u" : ";%u", param);
+    if (n > 0) {
+        s->len += (size_t)n;
+    }
+}
+
+/* Parameters that turn PLAIN into `to` */
+static void sgr_full(SgrBuf *s, TermAttr to)
+{
+    if (to & TERM_BOLD)      sgr_add(s, 1);
+    if (to & TERM_DIM)       sgr_add(s, 2);
+    if (to & TERM_UNDERLINE) sgr_add(s, 4);
+    if (to & TERM_FG_MASK)   sgr_add(s, 29 + (to & TERM_FG_MASK));
+}
+
+/* Parameters that turn `from` into `to`, touching only what changed */
+static void sgr_delta(SgrBuf *s, TermAttr from, TermAttr to)
+{
+    TermAttr intensity = TERM_BOLD | TERM_DIM;
+
+    if ((from & intensity) & ~to) {
+        sgr_add(s, 22);
+        from &= ~intensity;
+    }
+    if ((to & TERM_BOLD) && !(from & TERM_BOLD)) sgr_add(s, 1);
+    if ((to & TERM_DIM) && !(from & TERM_DIM))   sgr_add(s, 2);
+
+    if ((from & TERM_UNDERLINE) && !(to & TERM_UNDERLINE)) sgr_add(s, 24);
+    if ((to & TERM_UNDERLINE) && !(from & TERM_UNDERLINE)) sgr_add(s, 4);
+
+    if ((from & TERM_FG_MASK) != (to & TERM_FG_MASK)) {
+        unsigned int fg = to & TERM_FG_MASK;
+        sgr_add(s, fg == 0 ? 39 : 29 + fg);
+    }
+}
+
+TermAttr term_set(TermAttr attr)
+{
+    TermAttr prev;
+    SgrBuf delta = { {0}, 0 };
+    SgrBuf full = { {0}, 0 };
+
+    if (!g_initialized) {
+        term_init();
+    }
+
+    prev = g_current;
+    if (!g_color || attr == g_current) {
+        return prev;   /* Nothing to say */
+    }
+
+    /*
+     * Two ways to get there: patch the current state, or reset and
+     * rebuild. Emit whichever sequence is shorter.
+     */
+    sgr_delta(&delta, g_current, attr);
+    sgr_add(&full, 0);
+    sgr_full(&full, attr);
+
+    if (attr == TERM_PLAIN || full.len < delta.len) {
+        printf("\033[%sm", attr == TERM_PLAIN ? "0" : full.buf);
+    } else {
+        printf("\033[%sm", delta.buf);
+    }
+
+    g_current = attr;
+    return prev;
+}
+
+void term_reset(void)
+{
+    term_set(TERM_PLAIN);
+}
+
+/*
+ * ============================================================================
+ * SCREEN CONTROL
+ * ============================================================================
+ */
+
+void term_clear(void)
+{
+    if (!term_is_tty()) {
+        return;
+    }
+
+    /* ESC[2J clears the screen, ESC[H moves the cursor home */
+    fputs("\033[2J\033[H", stdout);
+    fflush(stdout);
+}
+
+void term_set_title(const char *title)
+{
+    if (title == NULL || !term_is_tty()) {
+        return;
+    }
+
+    /* OSC 0 ; title BEL */
+    printf("\033]0;%s\007", title);
+    fflush(stdout);
+}
@@ -0,0 +1,123 @@
+/*
+ * term.h — Terminal Capabilities and Attribute State
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * display.c used to paste raw ANSI codes around everything:
+ *
+ *   ESC[33m ESC[1m  text  ESC[0m   ESC[33m ESC[1m  text  ESC[0m
+ *
+ * This module remembers which attributes are active and only emits
+ * what actually changes, merged into a single sequence:
+ *
+ *   ESC[1;33m  text   text  ESC[0m
+ *
+ * When stdout is not a terminal (piped into a log, a file, another
+ * program) or NO_COLOR is set, it emits nothing at all.
+ *
+ * Learning Focus:
+ *   - Bit flags for sets of options
+ *   - State machines (current state + transition = output)
+ *   - isatty() and environment variables
+ */
+
+#ifndef TERM_H
+#define TERM_H
+
+#include <stdint.h>
+
+/*
+ * ============================================================================
+ * ATTRIBUTES
+ * ============================================================================
+ *
+ * A TermAttr packs a foreground color and style flags:
+ *
+ *   bits 0-3   foreground (0 = terminal default, 1-8 = SGR 30-37)
+ *   bit  8     bold
+ *   bit  9     dim
+ *   bit  10    underline
+ */
+
+typedef uint32_t TermAttr;
+
+#define TERM_PLAIN      0x000u
+
+#define TERM_BLACK      0x001u
+#define TERM_RED        0x002u
+#define TERM_GREEN      0x003u
+#define TERM_YELLOW     0x004u
+#define TERM_BLUE       0x005u
+#define TERM_MAGENTA    0x006u
+#define TERM_CYAN       0x007u
+#define TERM_WHITE      0x008u
+#define TERM_FG_MASK    0x00Fu
+
+#define TERM_BOLD       0x100u
+#define TERM_DIM        0x200u
+#define TERM_UNDERLINE  0x400u
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * term_init — Detect what stdout can do
+ *
+ * Colors are enabled only if stdout is a tty, TERM is set and not
+ * "dumb", and NO_COLOR is unset. Called automatically on first use.
+ */
+void term_init(void);
+
+/*
+ * term_is_tty — Whether stdout is an interactive terminal
+ *
+ * Screen control (clear, title) should be skipped when this is 0.
+ */
+int term_is_tty(void);
+
+/*
+ * term_color_enabled — Whether SGR sequences are being emitted
+ */
+int term_color_enabled(void);
+
+/*
+ * term_set_color — Force colors on (1) or off (0)
+ */
+void term_set_color(int enabled);
+
+/*
+ * term_set — Switch to a new attribute set
+ *
+ * Emits at most one escape sequence containing only the changes.
+ * Nothing is emitted if attr is already active.
+ *
+ * Returns:
+ *   The previously active attributes, so a function can restore
+ *   whatever its caller had:
+ *
+ *     TermAttr prev = term_set(TERM_GREEN);
+ *     ...
+ *     term_set(prev);
+ */
+TermAttr term_set(TermAttr attr);
+
+/*
+ * term_reset — Shorthand for term_set(TERM_PLAIN)
+ */
+void term_reset(void);
+
+/*
+ * term_clear — Clear the screen and home the cursor (tty only)
+ */
+void term_clear(void);
+
+/*
+ * term_set_title — Set the window title (tty only)
+ */
+void term_set_title(const char *title);
+
+#endif /* TERM_H */
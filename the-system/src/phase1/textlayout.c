@@ -0,0 +1,511 @@
+/*
+ * textlayout.c — Width-Aware UTF-8 Text Layout Implementation
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * Learning Focus:
+ *   - Decoding and validating UTF-8 by hand
+ *   - SIMD fast path for runs of printable ASCII
+ *   - One allocation per cache entry
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "textlayout.h"
+
+/*
+ * ============================================================================
+ * CHARACTER WIDTH TABLE
+ * ============================================================================
+ *
+ * A trimmed version of Unicode's East Asian Width property:
+ * ranges not listed here are one column wide.
+ * Sorted by lo so we can binary search.
+ */
+
+typedef struct {
+    uint32_t lo;
+    uint32_t hi;
+    uint8_t width;
+} WidthRange;
+
+static const WidthRange WIDTH_RANGES[] = {
+    { 0x0300,  0x036F,  0 },   /* Combining diacritics */
+    { 0x1100,  0x115F,  2 },   /* Hangul Jamo */
+    { 0x1AB0,  0x1AFF,  0 },
+    { 0x1DC0,  0x1DFF,  0 },
+    { 0x200B,  0x200F,  0 },   /* Zero-width space, joiners, marks */
+    { 0x20D0,  0x20FF,  0 },
+    { 0x2E80,  0x303E,  2 },   /* CJK radicals, punctuation: 「 」 */
+    { 0x3041,  0x33FF,  2 },   /* Kana, CJK compatibility */
+    { 0x3400,  0x4DBF,  2 },   /* CJK extension A */
+    { 0x4E00,  0x9FFF,  2 },   /* CJK unified ideographs */
+    { 0xA000,  0xA4CF,  2 },   /* Yi */
+    { 0xAC00,  0xD7A3,  2 },   /* Hangul syllables */
+    { 0xF900,  0xFAFF,  2 },   /* CJK compatibility ideographs */
+    { 0xFE00,  0xFE0F,  0 },   /* Variation selectors */
+    { 0xFE20,  0xFE2F,  0 },
+    { 0xFE30,  0xFE4F,  2 },   /* CJK compatibility forms */
+    { 0xFF00,  0xFF60,  2 },   /* Fullwidth forms */
+    { 0xFFE0,  0xFFE6,  2 },
+    { 0x1F300, 0x1F64F, 2 },   /* Pictographs, emoticons */
+    { 0x1F900, 0x1F9FF, 2 },
+    { 0x20000, 0x2FFFD, 2 },   /* CJK extension B+ */
+    { 0x30000, 0x3FFFD, 2 }
+};
+
+#define NUM_WIDTH_RANGES (sizeof(WIDTH_RANGES) / sizeof(WIDTH_RANGES[0]))
+
+static uint32_t codepoint_width(uint32_t cp)
+{
+    size_t lo = 0;
+    size_t hi = NUM_WIDTH_RANGES;
+
+    if (cp < 0x20 || (cp >= 0x7F && cp < 0xA0)) {
+        return 0;  /* Control characters take no space */
+    }
+    if (cp < 0x300) {
+        return 1;  /* Latin: skip the search */
+    }
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (cp < WIDTH_RANGES[mid].lo) {
+            hi = mid;
+        } else if (cp > WIDTH_RANGES[mid].hi) {
+            lo = mid + 1;
+        } else {
+            return WIDTH_RANGES[mid].width;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * ============================================================================
+ * UTF-8 DECODER
+ * ============================================================================
+ *
+ *   Bytes  First      Second     Third/Fourth
+ *   1      00-7F
+ *   2      C2-DF      80-BF
+ *   3      E0         A0-BF      80-BF         (no overlongs)
+ *          E1-EC,EE-EF 80-BF     80-BF
+ *          ED         80-9F      80-BF         (no surrogates)
+ *   4      F0         90-BF      80-BF x2
+ *          F1-F3      80-BF      80-BF x2
+ *          F4         80-8F      80-BF x2      (max U+10FFFF)
+ *
+ * Anything else is invalid: we consume one byte and emit U+FFFD.
+ */
+
+#define IS_CONT(b) (((b) & 0xC0) == 0x80)
+
+static size_t decode_utf8(const unsigned char *s, size_t n, uint32_t *cp)
+{
+    unsigned char c = s[0];
+    unsigned char lo = 0x80, hi = 0xBF;
+
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    }
+
+    if (c >= 0xC2 && c <= 0xDF) {
+        if (n >= 2 && IS_CONT(s[1])) {
+            *cp = ((uint32_t)(c & 0x1F) << 6) | (s[1] & 0x3F);
+            return 2;
+        }
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        if (c == 0xE0) lo = 0xA0;
+        if (c == 0xED) hi = 0x9F;
+        if (n >= 3 && s[1] >= lo && s[1] <= hi && IS_CONT(s[2])) {
+            *cp = ((uint32_t)(c & 0x0F) << 12) |
+                  ((uint32_t)(s[1] & 0x3F) << 6) |
+                  (s[2] & 0x3F);
+            return 3;
+        }
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        if (c == 0xF0) lo = 0x90;
+        if (c == 0xF4) hi = 0x8F;
+        if (n >= 4 && s[1] >= lo && s[1] <= hi &&
+            IS_CONT(s[2]) && IS_CONT(s[3])) {
+            *cp = ((uint32_t)(c & 0x07) << 18) |
+                  ((uint32_t)(s[1] & 0x3F) << 12) |
+                  ((uint32_t)(s[2] & 0x3F) << 6) |
+                  (s[3] & 0x3F);
+            return 4;
+        }
+    }
+
+    *cp = 0xFFFD;
+    return 0;  /* Invalid: caller consumes 1 byte */
+}
+
+/*
+ * ============================================================================
+ * LAYOUT COMPUTATION
+ * ============================================================================
+ */
+
+/*
+ * LayoutEntry — Cache entry: header followed by its arrays in one block
+ */
+typedef struct {
+    TextLayout layout;
+    /* uint16_t cp_byte[bytes + 1]; uint16_t cp_col[bytes + 1];
+     * uint16_t breaks[bytes]; char text[bytes + 1]; */
+} LayoutEntry;
+
+#if defined(__SSE2__)
+/*
+ * ctz32 — Index of the lowest set bit (x != 0)
+ */
+static uint32_t ctz32(uint32_t x)
+{
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctz(x);
+#else
+    uint32_t n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+#endif
+
+static void push_break(uint16_t *breaks, uint32_t *count, uint32_t at)
+{
+    if (*count == 0 || breaks[*count - 1] != at) {
+        breaks[(*count)++] = (uint16_t)at;
+    }
+}
+
+static LayoutEntry *layout_compute(const char *s, size_t n, uint32_t hash)
+{
+    const unsigned char *u = (const unsigned char *)s;
+    LayoutEntry *e;
+    uint16_t *cp_byte, *cp_col, *breaks;
+    char *text;
+    uint32_t ncp = 0, nbreaks = 0, col = 0;
+    int valid = 1;
+    size_t i = 0;
+
+    /* Worst case: every byte is its own code point */
+    e = malloc(sizeof(*e) + (n + 1) * 2 * sizeof(uint16_t) +
+               n * sizeof(uint16_t) + n + 1);
+    if (e == NULL) {
+        return NULL;
+    }
+
+    cp_byte = (uint16_t *)(e + 1);
+    cp_col = cp_byte + (n + 1);
+    breaks = cp_col + (n + 1);
+    text = (char *)(breaks + n);
+
+    while (i < n) {
+#if defined(__SSE2__)
+        /*
+         * Fast path: the printable-ASCII prefix of the next 16 bytes.
+         * Each of those bytes is one code point and one column, so
+         * cp_byte and cp_col are just i + lane and col + lane: two
+         * 8-lane stores each, whatever the prefix length (lanes past
+         * it are rewritten by the code points that follow). Spaces
+         * are break opportunities; movemask gives them as bits.
+         */
+        if (i + 16 <= n) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(u + i));
+            __m128i ctrl = _mm_cmplt_epi8(v, _mm_set1_epi8(0x20));
+            unsigned int high = (unsigned int)_mm_movemask_epi8(v);   /* >= 0x80 */
+            unsigned int low = (unsigned int)_mm_movemask_epi8(ctrl); /* < 0x20 (signed) */
+            unsigned int del = (unsigned int)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F)));
+            uint32_t run = ctz32(high | low | del | 0x10000u);
+
+            if (run > 0) {
+                const __m128i lanes = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+                const __m128i eight = _mm_set1_epi16(8);
+                __m128i at = _mm_add_epi16(_mm_set1_epi16((short)i), lanes);
+                __m128i cols = _mm_add_epi16(_mm_set1_epi16((short)col), lanes);
+                unsigned int spaces = (unsigned int)_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(v, _mm_set1_epi8(' '))) & ((1u << run) - 1);
+
+                _mm_storeu_si128((__m128i *)(cp_byte + ncp), at);
+                _mm_storeu_si128((__m128i *)(cp_byte + ncp + 8), _mm_add_epi16(at, eight));
+                _mm_storeu_si128((__m128i *)(cp_col + ncp), cols);
+                _mm_storeu_si128((__m128i *)(cp_col + ncp + 8), _mm_add_epi16(cols, eight));
+
+                while (spaces != 0) {
+                    push_break(breaks, &nbreaks, ncp + ctz32(spaces));
+                    spaces &= spaces - 1;
+                }
+
+                ncp += run;
+                col += run;
+                i += run;
+                continue;
+            }
+        }
+#endif
+        {
+            uint32_t cp;
+            size_t len = decode_utf8(u + i, n - i, &cp);
+            uint32_t w;
+
+            if (len == 0) {
+                valid = 0;
+                len = 1;
+                w = 1;  /* Replacement glyph */
+            } else {
+                w = codepoint_width(cp);
+            }
+
+            if (cp == ' ') {
+                push_break(breaks, &nbreaks, ncp);
+            }
+
+            cp_byte[ncp] = (uint16_t)i;
+            cp_col[ncp] = (uint16_t)col;
+            ncp++;
+            col += w;
+            i += len;
+
+            /* Ideographic text may break after any wide glyph */
+            if (w == 2) {
+                push_break(breaks, &nbreaks, ncp);
+            }
+        }
+    }
+
+    cp_byte[ncp] = (uint16_t)n;
+    cp_col[ncp] = (uint16_t)col;
+
+    memcpy(text, s, n);
+    text[n] = '\0';
+
+    e->layout.hash = hash;
+    e->layout.bytes = (uint32_t)n;
+    e->layout.width = col;
+    e->layout.cp_count = ncp;
+    e->layout.break_count = nbreaks;
+    e->layout.valid_utf8 = valid;
+    e->layout.cp_byte = cp_byte;
+    e->layout.cp_col = cp_col;
+    e->layout.breaks = breaks;
+    e->layout.text = text;
+
+    return e;
+}
+
+/*
+ * ============================================================================
+ * CACHE (open addressing, linear probing)
+ * ============================================================================
+ *
+ * When the table is 3/4 full we drop everything and start over.
+ * The working set (quest names, descriptions, a few labels) is
+ * small, so a full flush is simpler than LRU and just as effective.
+ */
+
+static LayoutEntry *g_cache[TEXT_CACHE_SLOTS];
+static uint32_t g_cache_used = 0;
+
+void text_layout_cache_clear(void)
+{
+    for (uint32_t i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        free(g_cache[i]);
+        g_cache[i] = NULL;
+    }
+    g_cache_used = 0;
+}
+
+const TextLayout *text_layout_get(const char *s)
+{
+    uint32_t hash = 2166136261u;  /* FNV-1a offset basis */
+    size_t n = 0;
+    uint32_t slot;
+    LayoutEntry *e;
+
+    if (s == NULL) {
+        return NULL;
+    }
+
+    /* Hash and measure in the same pass */
+    while (s[n] != '\0') {
+        hash ^= (unsigned char)s[n];
+        hash *= 16777619u;
+        n++;
+    }
+
+    if (n > TEXT_LAYOUT_MAX_BYTES) {
+        return NULL;
+    }
+
+    slot = hash & (TEXT_CACHE_SLOTS - 1);
+    while (g_cache[slot] != NULL) {
+        const TextLayout *l = &g_cache[slot]->layout;
+        if (l->hash == hash && l->bytes == n && memcmp(l->text, s, n) == 0) {
+            return l;
+        }
+        slot = (slot + 1) & (TEXT_CACHE_SLOTS - 1);
+    }
+
+    if (g_cache_used >= TEXT_CACHE_SLOTS * 3 / 4) {
+        text_layout_cache_clear();
+        slot = hash & (TEXT_CACHE_SLOTS - 1);
+    }
+
+    e = layout_compute(s, n, hash);
+    if (e == NULL) {
+        return NULL;
+    }
+
+    g_cache[slot] = e;
+    g_cache_used++;
+
+    return &e->layout;
+}
+
+/*
+ * ============================================================================
+ * QUERIES
+ * ============================================================================
+ */
+
+uint32_t text_width(const char *s)
+{
+    const TextLayout *l = text_layout_get(s);
+
+    if (l == NULL) {
+        return (s == NULL) ? 0 : (uint32_t)strlen(s);
+    }
+
+    return l->width;
+}
+
+/*
+ * last_cp_within — Largest i in [start, cp_count] with cp_col[i] <= limit
+ *
+ * cp_col[] never decreases, so binary search works.
+ * Taking the LARGEST index keeps zero-width marks with their base glyph.
+ */
+static uint32_t last_cp_within(const TextLayout *l, uint32_t start,
+                               uint32_t limit)
+{
+    uint32_t lo = start, hi = l->cp_count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo + 1) / 2;
+        if (l->cp_col[mid] <= limit) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    return lo;
+}
+
+/*
+ * last_break_within — Largest break b with start < b <= limit, or 0
+ */
+static uint32_t last_break_within(const TextLayout *l, uint32_t start,
+                                  uint32_t limit)
+{
+    uint32_t lo = 0, hi = l->break_count;
+
+    /* First break > limit */
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (l->breaks[mid] <= limit) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0 && l->breaks[lo - 1] > start) {
+        return l->breaks[lo - 1];
+    }
+
+    return 0;
+}
+
+static uint32_t skip_spaces(const TextLayout *l, uint32_t i)
+{
+    while (i < l->cp_count && l->text[l->cp_byte[i]] == ' ') {
+        i++;
+    }
+    return i;
+}
+
+uint32_t text_wrap_line(const TextLayout *l, uint32_t start, uint32_t cols,
+                        uint32_t *end)
+{
+    uint32_t fit, brk;
+
+    if (l == NULL || end == NULL) {
+        return 0;
+    }
+
+    if (start >= l->cp_count) {
+        *end = l->cp_count;
+        return l->cp_count;
+    }
+
+    fit = last_cp_within(l, start, l->cp_col[start] + cols);
+
+    if (fit == l->cp_count) {
+        *end = fit;  /* Everything left fits */
+        return fit;
+    }
+
+    brk = last_break_within(l, start, fit);
+    if (brk == 0) {
+        /* One long word: hard break, but always make progress */
+        brk = (fit > start) ? fit : start + 1;
+    }
+
+    *end = brk;
+    return skip_spaces(l, brk);
+}
+
+void text_print_span(const TextLayout *l, uint32_t start, uint32_t end,
+                     uint32_t cols)
+{
+    uint32_t used;
+
+    if (l == NULL || start > end || end > l->cp_count) {
+        return;
+    }
+
+    fwrite(l->text + l->cp_byte[start], 1,
+           l->cp_byte[end] - l->cp_byte[start], stdout);
+
+    used = l->cp_col[end] - l->cp_col[start];
+    for (; used < cols; used++) {
+        putchar(' ');
+    }
+}
+
+void text_print_fit(const char *s, uint32_t cols)
+{
+    const TextLayout *l = text_layout_get(s);
+
+    if (l == NULL) {
+        printf("%-*.*s", (int)cols, (int)cols, s != NULL ? s : "");
+        return;
+    }
+
+    text_print_span(l, 0, last_cp_within(l, 0, cols), cols);
+}
@@ -0,0 +1,138 @@
+/*
+ * textlayout.h — Width-Aware UTF-8 Text Layout (Cached)
+ *
+ * THE SYSTEM: HUNTER PROTOCOL
+ * Phase 1: The Seed
+ *
+ * printf("%-55s") pads by BYTES. A terminal lays out COLUMNS.
+ *
+ *   "First Blood"   11 bytes   11 columns
+ *   "「 Arise 」"    13 bytes    9 columns   (「 and 」 are 3 bytes, 2 columns)
+ *   "影の王"          9 bytes    6 columns
+ *
+ * This module decodes a string once, records where every code point
+ * starts (in bytes and in columns) and where a line may break, and
+ * caches the result keyed by the string's contents (the "interned"
+ * copy lives in the cache). Padding, truncation and word-wrap then
+ * become lookups instead of rescans.
+ *
+ * With SSE2, runs of printable ASCII are laid out 16 bytes at a time.
+ * Everything else, including all UTF-8 validation, is decoded one
+ * code point at a time: each one needs a width lookup anyway.
+ *
+ * Learning Focus:
+ *   - UTF-8 encoding (1-4 byte sequences)
+ *   - Hash tables with open addressing
+ *   - Precomputing once, reading many times
+ */
+
+#ifndef TEXTLAYOUT_H
+#define TEXTLAYOUT_H
+
+#include <stdint.h>
+
+/*
+ * ============================================================================
+ * CONSTANTS
+ * ============================================================================
+ */
+
+/* Number of cache slots (power of two) */
+#define TEXT_CACHE_SLOTS     512
+
+/* Strings longer than this are not laid out (offsets are 16-bit) */
+#define TEXT_LAYOUT_MAX_BYTES 65535
+
+/*
+ * ============================================================================
+ * STRUCTURES
+ * ============================================================================
+ */
+
+/*
+ * TextLayout — Everything the renderer needs to know about one string
+ *
+ * For code point i (0 <= i <= cp_count):
+ *   cp_byte[i] — byte offset where it starts
+ *   cp_col[i]  — terminal column where it starts
+ * Entry cp_count is the end of the string, so
+ *   width == cp_col[cp_count] and bytes == cp_byte[cp_count].
+ *
+ * breaks[] lists code point indices where a line may end,
+ * in increasing order (after a space, or after a wide CJK glyph).
+ *
+ * Invalid UTF-8 bytes are treated as one-column replacement glyphs.
+ */
+typedef struct {
+    uint32_t hash;
+    uint32_t bytes;
+    uint32_t width;
+    uint32_t cp_count;
+    uint32_t break_count;
+    int valid_utf8;
+
+    const uint16_t *cp_byte;
+    const uint16_t *cp_col;
+    const uint16_t *breaks;
+
+    const char *text;        /* Interned copy, owned by the cache */
+} TextLayout;
+
+/*
+ * ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================
+ */
+
+/*
+ * text_layout_get — Look up (or compute and cache) a layout
+ *
+ * The returned pointer stays valid until text_layout_cache_clear()
+ * or until the cache fills up and is recycled. Callers that render
+ * the same string every frame may hold on to it for that long.
+ *
+ * Returns:
+ *   Layout for s, or NULL if s is NULL, too long, or out of memory
+ */
+const TextLayout *text_layout_get(const char *s);
+
+/*
+ * text_width — Display width of s in terminal columns
+ */
+uint32_t text_width(const char *s);
+
+/*
+ * text_wrap_line — Find the next line of at most cols columns
+ *
+ * Parameters:
+ *   l     — Layout
+ *   start — Code point index where the line starts
+ *   cols  — Maximum line width
+ *   end   — Output: code point index where the line ends (exclusive)
+ *
+ * Returns:
+ *   Code point index where the next line starts (spaces skipped).
+ *   Equal to l->cp_count when the text is exhausted.
+ */
+uint32_t text_wrap_line(const TextLayout *l, uint32_t start, uint32_t cols,
+                        uint32_t *end);
+
+/*
+ * text_print_span — Print code points [start, end) padded to cols columns
+ */
+void text_print_span(const TextLayout *l, uint32_t start, uint32_t end,
+                     uint32_t cols);
+
+/*
+ * text_print_fit — Print s truncated or space-padded to exactly cols columns
+ *
+ * Drop-in replacement for printf("%-Ns", s) that counts columns.
+ */
+void text_print_fit(const char *s, uint32_t cols);
+
+/*
+ * text_layout_cache_clear — Free every cached layout
+ */
+void text_layout_cache_clear(void);
+
+#endif /* TEXTLAYOUT_H */